@@ -0,0 +1,223 @@
+/**
+ * EQEmulator: Everquest Server Emulator
+ * Copyright (C) 2001-2018 EQEmulator Development Team (https://github.com/EQEmu/Server)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY except by those people which sell it, which
+ * are required to give you total support for your newly bought product;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+*/
+
+#include "async_log_writer.h"
+
+#include <algorithm>
+#include <chrono>
+
+AsyncLogWriter::AsyncLogWriter()
+	: m_running(false),
+	m_sequence(0),
+	m_queued(0),
+	m_written(0),
+	m_dropped(0),
+	m_batches(0),
+	m_high_water(0),
+	m_reported_dropped(0)
+{
+}
+
+AsyncLogWriter::~AsyncLogWriter()
+{
+	Stop();
+}
+
+/**
+ * The ring outlives its thread until the writer has drained it
+ */
+AsyncLogWriter::ThreadRing::~ThreadRing()
+{
+	if (ring) {
+		ring->closed.store(true, std::memory_order_release);
+	}
+}
+
+/**
+ * One ring per thread for the process, there is only ever the one LogSys writer
+ *
+ * @return
+ */
+std::shared_ptr<AsyncLogWriter::Ring> &AsyncLogWriter::GetThreadRing()
+{
+	static thread_local ThreadRing thread_ring;
+
+	if (!thread_ring.ring) {
+		thread_ring.ring = std::make_shared<Ring>();
+
+		std::unique_lock<std::mutex> lock(m_drain_lock);
+		m_rings.push_back(thread_ring.ring);
+	}
+
+	return thread_ring.ring;
+}
+
+void AsyncLogWriter::Start()
+{
+	// first logs can come from several threads at once, only the one that flips the flag starts the thread
+	bool expected = false;
+	if (!m_running.compare_exchange_strong(expected, true)) {
+		return;
+	}
+
+	m_thread = std::thread(&AsyncLogWriter::Run, this);
+}
+
+void AsyncLogWriter::Stop()
+{
+	if (!m_running) {
+		return;
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(m_wake_lock);
+		m_running = false;
+	}
+
+	m_wake.notify_one();
+
+	if (m_thread.joinable()) {
+		m_thread.join();
+	}
+
+	Drain();
+}
+
+/**
+ * @param record
+ * @return
+ */
+bool AsyncLogWriter::Push(LogRecord &&record)
+{
+	auto &ring = GetThreadRing();
+
+	size_t tail = ring->tail.load(std::memory_order_relaxed);
+	size_t head = ring->head.load(std::memory_order_acquire);
+	if (tail - head >= RingCapacity) {
+		m_dropped.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	record.sequence = m_sequence.fetch_add(1, std::memory_order_relaxed);
+	ring->slots[tail % RingCapacity] = std::move(record);
+	ring->tail.store(tail + 1, std::memory_order_release);
+
+	m_queued.fetch_add(1, std::memory_order_relaxed);
+
+	size_t depth      = tail + 1 - head;
+	size_t high_water = m_high_water.load(std::memory_order_relaxed);
+	while (depth > high_water && !m_high_water.compare_exchange_weak(high_water, depth)) {}
+
+	// don't wait out the interval when a burst is about to fill the ring
+	if (depth == RingCapacity / 2) {
+		m_wake.notify_one();
+	}
+
+	return true;
+}
+
+/**
+ * Called from the crash handler, which may have interrupted a drain on this same thread, so never
+ * block on the drain lock; give the writer thread a moment to finish its batch and otherwise skip
+ */
+void AsyncLogWriter::Flush()
+{
+	std::unique_lock<std::mutex> lock(m_drain_lock, std::defer_lock);
+
+	auto give_up = std::chrono::steady_clock::now() + std::chrono::milliseconds(DrainIntervalMs);
+	while (!lock.try_lock()) {
+		if (std::chrono::steady_clock::now() >= give_up) {
+			return;
+		}
+
+		std::this_thread::yield();
+	}
+
+	DrainRings();
+}
+
+void AsyncLogWriter::Run()
+{
+	while (m_running) {
+		{
+			std::unique_lock<std::mutex> lock(m_wake_lock);
+			m_wake.wait_for(lock, std::chrono::milliseconds(DrainIntervalMs));
+		}
+
+		Drain();
+	}
+}
+
+void AsyncLogWriter::Drain()
+{
+	std::unique_lock<std::mutex> lock(m_drain_lock);
+	DrainRings();
+}
+
+/**
+ * Caller holds m_drain_lock
+ */
+void AsyncLogWriter::DrainRings()
+{
+	auto iter = m_rings.begin();
+	while (iter != m_rings.end()) {
+		auto &ring = *iter;
+
+		// read closed before tail, a closed ring can't receive anything past the tail we see here
+		bool   closed = ring->closed.load(std::memory_order_acquire);
+		size_t head   = ring->head.load(std::memory_order_relaxed);
+		size_t tail   = ring->tail.load(std::memory_order_acquire);
+
+		while (head != tail) {
+			m_batch.push_back(std::move(ring->slots[head % RingCapacity]));
+			++head;
+		}
+
+		ring->head.store(head, std::memory_order_release);
+
+		if (closed) {
+			iter = m_rings.erase(iter);
+			continue;
+		}
+
+		++iter;
+	}
+
+	uint64 dropped = m_dropped.load(std::memory_order_relaxed);
+	uint64 unreported_dropped = dropped - m_reported_dropped;
+	if (m_batch.empty() && unreported_dropped == 0) {
+		return;
+	}
+
+	std::sort(
+		m_batch.begin(), m_batch.end(), [](const LogRecord &a, const LogRecord &b) {
+			return a.sequence < b.sequence;
+		}
+	);
+
+	if (m_sink) {
+		m_sink(m_batch, unreported_dropped);
+	}
+
+	m_reported_dropped = dropped;
+	m_written.fetch_add(m_batch.size(), std::memory_order_relaxed);
+	m_batches.fetch_add(1, std::memory_order_relaxed);
+	m_batch.clear();
+}
@@ -0,0 +1,135 @@
+/**
+ * EQEmulator: Everquest Server Emulator
+ * Copyright (C) 2001-2018 EQEmulator Development Team (https://github.com/EQEmu/Server)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY except by those people which sell it, which
+ * are required to give you total support for your newly bought product;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+*/
+
+#ifndef EQEMU_ASYNC_LOG_WRITER_H
+#define EQEMU_ASYNC_LOG_WRITER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "types.h"
+
+struct LogRecord {
+	uint64      sequence;
+	time_t      time;
+	uint16      debug_level;
+	uint16      log_category;
+	bool        to_console;
+	bool        to_file;
+	std::string message;
+};
+
+/**
+ * Moves console and file log output off the threads that produce it
+ *
+ * Every producing thread gets its own single producer / single consumer ring, so queueing a
+ * record is a couple of atomic loads and a store with no lock shared between threads. A
+ * background thread drains all rings on a short interval (or sooner once a ring passes half
+ * full), puts the batch back in global order and hands it to the sink in one call so the sink
+ * can write and flush once per batch instead of once per line.
+ *
+ * A full ring drops the record and counts it rather than blocking the game thread; the drop
+ * count is reported through the sink on the next batch. Flush() drains everything on the
+ * calling thread and is safe to call from the crash handler; it
+ * skips the drain rather than wait on a drain the crash interrupted.
+ */
+class AsyncLogWriter {
+public:
+	typedef std::function<void(std::vector<LogRecord> &records, uint64 dropped)> Sink;
+
+	static const size_t RingCapacity    = 4096;
+	static const int    DrainIntervalMs = 50;
+
+	AsyncLogWriter();
+	~AsyncLogWriter();
+
+	void SetSink(Sink sink) { m_sink = sink; }
+
+	void Start();
+	void Stop();
+	bool IsRunning() const { return m_running; }
+
+	/**
+	 * Queues a record from the calling thread, returns false when it had to be dropped
+	 *
+	 * @param record
+	 * @return
+	 */
+	bool Push(LogRecord &&record);
+
+	/**
+	 * Drains every ring into the sink on the calling thread
+	 */
+	void Flush();
+
+	uint64 GetQueued() const { return m_queued; }
+	uint64 GetWritten() const { return m_written; }
+	uint64 GetDropped() const { return m_dropped; }
+	uint64 GetBatches() const { return m_batches; }
+	size_t GetHighWater() const { return m_high_water; }
+
+private:
+	struct Ring {
+		Ring() : slots(RingCapacity), head(0), tail(0), closed(false) {}
+
+		std::vector<LogRecord> slots;
+		std::atomic<size_t>    head; // next slot the consumer reads, owned by the consumer
+		std::atomic<size_t>    tail; // next slot the producer writes, owned by the producer
+		std::atomic<bool>      closed;
+	};
+
+	struct ThreadRing {
+		std::shared_ptr<Ring> ring;
+		~ThreadRing();
+	};
+
+	std::shared_ptr<Ring> &GetThreadRing();
+	void Run();
+	void Drain();
+	void DrainRings();
+
+	Sink m_sink;
+
+	std::atomic<bool>   m_running;
+	std::atomic<uint64> m_sequence;
+	std::atomic<uint64> m_queued;
+	std::atomic<uint64> m_written;
+	std::atomic<uint64> m_dropped;
+	std::atomic<uint64> m_batches;
+	std::atomic<size_t> m_high_water;
+	uint64              m_reported_dropped;
+
+	// guards the ring list, and is the single consumer lock for every ring
+	std::mutex                         m_drain_lock;
+	std::vector<std::shared_ptr<Ring>> m_rings;
+	std::vector<LogRecord>             m_batch;
+
+	std::mutex              m_wake_lock;
+	std::condition_variable m_wake;
+	std::thread             m_thread;
+};
+
+#endif
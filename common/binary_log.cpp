@@ -0,0 +1,242 @@
+/**
+ * EQEmulator: Everquest Server Emulator
+ * Copyright (C) 2001-2018 EQEmulator Development Team (https://github.com/EQEmu/Server)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY except by those people which sell it, which
+ * are required to give you total support for your newly bought product;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+*/
+
+#include "binary_log.h"
+
+#include <chrono>
+
+#ifdef _WINDOWS
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+	const size_t BinaryLogBufferSize = 256 * 1024;
+
+	uint64 NowMilliseconds()
+	{
+		return static_cast<uint64>(
+			std::chrono::duration_cast<std::chrono::milliseconds>(
+				std::chrono::system_clock::now().time_since_epoch()
+			).count()
+		);
+	}
+}
+
+BinaryLogWriter::BinaryLogWriter()
+	: m_file(nullptr), m_buffer(nullptr), m_entries(0), m_bytes(0), m_next_format_id(1)
+{
+}
+
+BinaryLogWriter::~BinaryLogWriter()
+{
+	Close();
+}
+
+/**
+ * @param file_name
+ * @param platform_name
+ * @param category_names
+ * @param category_count
+ * @return
+ */
+bool BinaryLogWriter::Open(
+	const std::string &file_name,
+	const std::string &platform_name,
+	const char *const *category_names,
+	int category_count
+)
+{
+	Close();
+
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	m_file = fopen(file_name.c_str(), "wb");
+	if (!m_file) {
+		return false;
+	}
+
+	m_buffer = new char[BinaryLogBufferSize];
+	setvbuf(m_file, m_buffer, _IOFBF, BinaryLogBufferSize);
+
+	char header[sizeof(BinaryLog::Magic) + sizeof(uint16)];
+	memcpy(header, BinaryLog::Magic, sizeof(BinaryLog::Magic));
+	header[4] = static_cast<char>(BinaryLog::Version & 0xFF);
+	header[5] = static_cast<char>(BinaryLog::Version >> 8);
+	fwrite(header, 1, sizeof(header), m_file);
+	m_bytes = sizeof(header);
+
+	std::string payload;
+	BinaryLog::PutVarint(payload, static_cast<uint64>(getpid()));
+	BinaryLog::PutString(payload, platform_name.data(), platform_name.length());
+	BinaryLog::PutVarint(payload, NowMilliseconds());
+	WriteRecord(BinaryLog::RecordProcess, payload);
+
+	// names travel with the file so old logs still decode after categories are added
+	for (int i = 0; i < category_count; ++i) {
+		payload.clear();
+		BinaryLog::PutVarint(payload, static_cast<uint64>(i));
+		BinaryLog::PutString(payload, category_names[i], strlen(category_names[i]));
+		WriteRecord(BinaryLog::RecordCategory, payload);
+	}
+
+	return true;
+}
+
+void BinaryLogWriter::Close()
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	if (m_file) {
+		fclose(m_file);
+		m_file = nullptr;
+	}
+
+	delete[] m_buffer;
+	m_buffer = nullptr;
+
+	// ids are per file, every new file has to carry its own format records
+	m_formats_by_site.clear();
+	m_formats_by_text.clear();
+	m_next_format_id = 1;
+}
+
+void BinaryLogWriter::Flush()
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	if (m_file) {
+		fflush(m_file);
+	}
+}
+
+void BinaryLogWriter::WriteEntry(
+	BinaryLog::FormatStyle style,
+	uint16 debug_level,
+	uint16 log_category,
+	const char *file,
+	const char *func,
+	int line,
+	const char *format,
+	const std::string &args,
+	size_t arg_count
+)
+{
+	uint64 now = NowMilliseconds();
+
+	std::unique_lock<std::mutex> lock(m_lock);
+	if (!m_file) {
+		return;
+	}
+
+	uint32 format_id = GetFormatId(style, file, func, line, format);
+
+	m_record.clear();
+	BinaryLog::PutVarint(m_record, now);
+	BinaryLog::PutVarint(m_record, format_id);
+	BinaryLog::PutVarint(m_record, log_category);
+	m_record.push_back(static_cast<char>(debug_level));
+	m_record.push_back(static_cast<char>(arg_count));
+	m_record.append(args);
+
+	WriteRecord(BinaryLog::RecordEntry, m_record);
+	++m_entries;
+}
+
+/**
+ * Caller holds m_lock
+ *
+ * @param style
+ * @param file
+ * @param func
+ * @param line
+ * @param format
+ * @return
+ */
+uint32 BinaryLogWriter::GetFormatId(
+	BinaryLog::FormatStyle style,
+	const char *file,
+	const char *func,
+	int line,
+	const char *format
+)
+{
+	FormatKey key{format, file, line, static_cast<uint8>(style)};
+
+	auto site = m_formats_by_site.find(key);
+	if (site != m_formats_by_site.end() && site->second.text == format) {
+		return site->second.id;
+	}
+
+	std::string text_key = fmt::format("{}\x1f{}\x1f{}\x1f{}", static_cast<int>(style), file, line, format);
+
+	uint32 id   = 0;
+	auto   text = m_formats_by_text.find(text_key);
+	if (text != m_formats_by_text.end()) {
+		id = text->second;
+	}
+	else {
+		id = m_next_format_id++;
+		m_formats_by_text[text_key] = id;
+
+		std::string payload;
+		BinaryLog::PutVarint(payload, id);
+		payload.push_back(static_cast<char>(style));
+		BinaryLog::PutString(payload, file, strlen(file));
+		BinaryLog::PutString(payload, func, strlen(func));
+		BinaryLog::PutVarint(payload, static_cast<uint64>(line));
+		BinaryLog::PutString(payload, format, strlen(format));
+		WriteRecord(BinaryLog::RecordFormat, payload);
+	}
+
+	FormatEntry &entry = m_formats_by_site[key];
+	entry.id   = id;
+	entry.text = format;
+
+	return id;
+}
+
+/**
+ * Caller holds m_lock
+ *
+ * @param type
+ * @param payload
+ */
+void BinaryLogWriter::WriteRecord(BinaryLog::RecordType type, const std::string &payload)
+{
+	char   header[1 + 10];
+	size_t header_size = 0;
+
+	header[header_size++] = static_cast<char>(type);
+
+	uint64 length = payload.length();
+	while (length >= 0x80) {
+		header[header_size++] = static_cast<char>((length & 0x7F) | 0x80);
+		length >>= 7;
+	}
+	header[header_size++] = static_cast<char>(length);
+
+	fwrite(header, 1, header_size, m_file);
+	fwrite(payload.data(), 1, payload.length(), m_file);
+
+	m_bytes += header_size + payload.length();
+}
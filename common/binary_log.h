@@ -0,0 +1,300 @@
+/**
+ * EQEmulator: Everquest Server Emulator
+ * Copyright (C) 2001-2018 EQEmulator Development Team (https://github.com/EQEmu/Server)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY except by those people which sell it, which
+ * are required to give you total support for your newly bought product;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+*/
+
+#ifndef EQEMU_BINARY_LOG_H
+#define EQEMU_BINARY_LOG_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <fmt/format.h>
+#include "types.h"
+
+/**
+ * Binary log file layout, everything little endian, varints are unsigned LEB128
+ *
+ * header  : "EQBL" u16 version
+ * records : u8 type, varint payload length, payload
+ *
+ * RecordProcess  : varint pid, string platform name, varint start time (ms since epoch)
+ * RecordCategory : varint category id, string category name
+ * RecordFormat   : varint format id, u8 style, string file, string func, varint line, string format
+ * RecordEntry    : varint time (ms since epoch), varint format id, varint category, u8 debug level,
+ *                  u8 argument count, then each argument as u8 ArgType + value
+ *
+ * Format strings are written once, the first time they are seen, and entries refer to them by id.
+ * Strings are a varint length followed by the bytes. Readers skip record types they don't know,
+ * and a record cut short at the end of the file (crash, still being written) is ignored
+ */
+namespace BinaryLog {
+	const char     Magic[4] = {'E', 'Q', 'B', 'L'};
+	const uint16   Version  = 1;
+
+	enum RecordType : uint8 {
+		RecordProcess  = 1,
+		RecordCategory = 2,
+		RecordFormat   = 3,
+		RecordEntry    = 4
+	};
+
+	enum FormatStyle : uint8 {
+		StyleFmt    = 0, // fmt::format, the Log* aliases
+		StylePrintf = 1  // printf, the Log() macro
+	};
+
+	enum ArgType : uint8 {
+		ArgBool   = 1,
+		ArgInt    = 2, // zigzag varint
+		ArgUInt   = 3, // varint
+		ArgDouble = 4, // 8 byte IEEE 754
+		ArgString = 5,
+		ArgChar   = 6
+	};
+
+	inline void PutVarint(std::string &out, uint64 value)
+	{
+		while (value >= 0x80) {
+			out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+			value >>= 7;
+		}
+
+		out.push_back(static_cast<char>(value));
+	}
+
+	inline void PutString(std::string &out, const char *value, size_t length)
+	{
+		PutVarint(out, length);
+		out.append(value, length);
+	}
+
+	inline void EncodeArg(std::string &out, bool value)
+	{
+		out.push_back(static_cast<char>(ArgBool));
+		out.push_back(value ? 1 : 0);
+	}
+
+	inline void EncodeArg(std::string &out, char value)
+	{
+		out.push_back(static_cast<char>(ArgChar));
+		out.push_back(value);
+	}
+
+	inline void EncodeArg(std::string &out, const char *value)
+	{
+		if (!value) {
+			value = "(null)";
+		}
+
+		out.push_back(static_cast<char>(ArgString));
+		PutString(out, value, strlen(value));
+	}
+
+	inline void EncodeArg(std::string &out, const std::string &value)
+	{
+		out.push_back(static_cast<char>(ArgString));
+		PutString(out, value.data(), value.length());
+	}
+
+	template<typename T>
+	typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type
+	EncodeArg(std::string &out, T value)
+	{
+		int64 v = static_cast<int64>(value);
+		out.push_back(static_cast<char>(ArgInt));
+		PutVarint(out, (static_cast<uint64>(v) << 1) ^ static_cast<uint64>(v >> 63));
+	}
+
+	template<typename T>
+	typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type
+	EncodeArg(std::string &out, T value)
+	{
+		out.push_back(static_cast<char>(ArgUInt));
+		PutVarint(out, static_cast<uint64>(value));
+	}
+
+	template<typename T>
+	typename std::enable_if<std::is_floating_point<T>::value>::type
+	EncodeArg(std::string &out, T value)
+	{
+		double v = static_cast<double>(value);
+		char   bytes[sizeof(double)];
+		memcpy(bytes, &v, sizeof(bytes));
+		out.push_back(static_cast<char>(ArgDouble));
+		out.append(bytes, sizeof(bytes));
+	}
+
+	template<typename T>
+	typename std::enable_if<std::is_enum<T>::value>::type
+	EncodeArg(std::string &out, T value)
+	{
+		EncodeArg(out, static_cast<typename std::underlying_type<T>::type>(value));
+	}
+
+	// %p arguments of the printf style Log(), fmt won't print anything but void pointers
+	template<typename T>
+	typename std::enable_if<std::is_pointer<T>::value && !std::is_convertible<T, const char *>::value>::type
+	EncodeArg(std::string &out, T value)
+	{
+		out.push_back(static_cast<char>(ArgUInt));
+		PutVarint(out, static_cast<uint64>(reinterpret_cast<uintptr_t>(value)));
+	}
+
+	// anything else fmt knows how to print is stored already rendered
+	template<typename T>
+	typename std::enable_if<
+		!std::is_arithmetic<T>::value &&
+		!std::is_enum<T>::value &&
+		!std::is_pointer<T>::value &&
+		!std::is_convertible<const T &, const char *>::value &&
+		!std::is_convertible<const T &, const std::string &>::value
+	>::type
+	EncodeArg(std::string &out, const T &value)
+	{
+		EncodeArg(out, fmt::format("{}", value));
+	}
+
+	inline void EncodeArgs(std::string &out) {}
+
+	template<typename T, typename... Args>
+	void EncodeArgs(std::string &out, const T &value, const Args &... args)
+	{
+		EncodeArg(out, value);
+		EncodeArgs(out, args...);
+	}
+}
+
+/**
+ * Writes log entries as a format string id plus the raw arguments instead of the rendered text
+ *
+ * Nothing is formatted on the logging thread; the arguments are packed into a thread local
+ * buffer and appended to a large stdio buffer under a short lock. utils/log_decoder renders the
+ * file back to text offline
+ */
+class BinaryLogWriter {
+public:
+	BinaryLogWriter();
+	~BinaryLogWriter();
+
+	/**
+	 * @param file_name
+	 * @param platform_name
+	 * @param category_names
+	 * @param category_count
+	 * @return
+	 */
+	bool Open(
+		const std::string &file_name,
+		const std::string &platform_name,
+		const char *const *category_names,
+		int category_count
+	);
+	void Close();
+	void Flush();
+	bool IsOpen() const { return m_file != nullptr; }
+
+	uint64 GetEntries() const { return m_entries; }
+	uint64 GetBytes() const { return m_bytes; }
+
+	template<typename Format, typename... Args>
+	void Write(
+		BinaryLog::FormatStyle style,
+		uint16 debug_level,
+		uint16 log_category,
+		const char *file,
+		const char *func,
+		int line,
+		const Format &format,
+		const Args &... args
+	)
+	{
+		if (!m_file) {
+			return;
+		}
+
+		static_assert(sizeof...(Args) < 256, "Too many log arguments");
+
+		static thread_local std::string payload;
+		payload.clear();
+		BinaryLog::EncodeArgs(payload, args...);
+
+		WriteEntry(style, debug_level, log_category, file, func, line, FormatText(format), payload, sizeof...(Args));
+	}
+
+private:
+	struct FormatKey {
+		const char *format;
+		const char *file;
+		int        line;
+		uint8      style;
+
+		bool operator==(const FormatKey &other) const
+		{
+			return format == other.format && file == other.file && line == other.line && style == other.style;
+		}
+	};
+
+	struct FormatKeyHash {
+		size_t operator()(const FormatKey &key) const
+		{
+			return std::hash<const void *>()(key.format) ^ (std::hash<const void *>()(key.file) << 1) ^
+				(static_cast<size_t>(key.line) << 8) ^ key.style;
+		}
+	};
+
+	struct FormatEntry {
+		uint32      id;
+		std::string text;
+	};
+
+	static const char *FormatText(const char *format) { return format ? format : ""; }
+	static const char *FormatText(const std::string &format) { return format.c_str(); }
+
+	void WriteEntry(
+		BinaryLog::FormatStyle style,
+		uint16 debug_level,
+		uint16 log_category,
+		const char *file,
+		const char *func,
+		int line,
+		const char *format,
+		const std::string &args,
+		size_t arg_count
+	);
+	uint32 GetFormatId(BinaryLog::FormatStyle style, const char *file, const char *func, int line, const char *format);
+	void WriteRecord(BinaryLog::RecordType type, const std::string &payload);
+
+	std::mutex m_lock;
+	FILE       *m_file;
+	char       *m_buffer;
+	uint64     m_entries;
+	uint64     m_bytes;
+	uint32     m_next_format_id;
+
+	// by call site first, the stored text catches non literal formats that change between calls
+	std::unordered_map<FormatKey, FormatEntry, FormatKeyHash> m_formats_by_site;
+	std::unordered_map<std::string, uint32>                   m_formats_by_text;
+	std::string                                               m_record;
+};
+
+#endif
@@ -0,0 +1,267 @@
+/**
+ * EQEmulator: Everquest Server Emulator
+ * Copyright (C) 2001-2018 EQEmulator Development Team (https://github.com/EQEmu/Server)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY except by those people which sell it, which
+ * are required to give you total support for your newly bought product;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+*/
+
+#include "binary_log_reader.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fmt/format.h>
+
+namespace {
+	template<typename T>
+	std::string FormatValue(const std::string &spec, const T &value)
+	{
+		try {
+			return fmt::vformat(spec, fmt::make_format_args(value));
+		}
+		catch (const std::exception &) {
+			return fmt::format("{}", value);
+		}
+	}
+
+	/**
+	 * @param spec everything between the braces after the colon
+	 * @param arg
+	 * @return
+	 */
+	std::string FormatFmtArg(const std::string &spec, const BinaryLog::LogArg &arg)
+	{
+		std::string format = spec.empty() ? "{}" : "{:" + spec + "}";
+
+		switch (arg.type) {
+			case BinaryLog::ArgBool:
+				return FormatValue(format, arg.u != 0);
+			case BinaryLog::ArgInt:
+				return FormatValue(format, arg.i);
+			case BinaryLog::ArgUInt:
+				return FormatValue(format, arg.u);
+			case BinaryLog::ArgDouble:
+				return FormatValue(format, arg.d);
+			case BinaryLog::ArgChar: {
+				char c = static_cast<char>(arg.u);
+				return FormatValue(format, c);
+			}
+			default:
+				return FormatValue(format, arg.s);
+		}
+	}
+
+	std::string PlainArg(const BinaryLog::LogArg &arg)
+	{
+		return FormatFmtArg("", arg);
+	}
+}
+
+std::string BinaryLog::RenderFmt(const std::string &format, const std::vector<BinaryLog::LogArg> &args)
+{
+	std::string out;
+	size_t      next_arg = 0;
+
+	for (size_t i = 0; i < format.length(); ++i) {
+		char c = format[i];
+		if (c == '}' && i + 1 < format.length() && format[i + 1] == '}') {
+			out.push_back('}');
+			++i;
+			continue;
+		}
+
+		if (c != '{') {
+			out.push_back(c);
+			continue;
+		}
+
+		if (i + 1 < format.length() && format[i + 1] == '{') {
+			out.push_back('{');
+			++i;
+			continue;
+		}
+
+		size_t close = format.find('}', i);
+		if (close == std::string::npos) {
+			out.append(format, i, std::string::npos);
+			break;
+		}
+
+		std::string field = format.substr(i + 1, close - i - 1);
+		std::string id    = field.substr(0, field.find(':'));
+		std::string spec  = id.length() < field.length() ? field.substr(id.length() + 1) : "";
+
+		size_t index = next_arg++;
+		if (!id.empty()) {
+			index = static_cast<size_t>(strtoul(id.c_str(), nullptr, 10));
+		}
+
+		if (index < args.size()) {
+			out += FormatFmtArg(spec, args[index]);
+		}
+		else {
+			out.append(format, i, close - i + 1);
+		}
+
+		i = close;
+	}
+
+	return out;
+}
+
+std::string BinaryLog::RenderPrintf(const std::string &format, const std::vector<BinaryLog::LogArg> &args)
+{
+	std::string out;
+	size_t      next_arg = 0;
+	char        buffer[512];
+
+	for (size_t i = 0; i < format.length(); ++i) {
+		if (format[i] != '%') {
+			out.push_back(format[i]);
+			continue;
+		}
+
+		if (i + 1 < format.length() && format[i + 1] == '%') {
+			out.push_back('%');
+			++i;
+			continue;
+		}
+
+		// flags, width and precision are kept, length modifiers are replaced to match the stored width
+		std::string spec = "%";
+		size_t      j    = i + 1;
+		while (j < format.length() && strchr("-+ #0123456789.*", format[j])) {
+			if (format[j] == '*') {
+				if (next_arg < args.size()) {
+					const BinaryLog::LogArg &width = args[next_arg];
+					spec += std::to_string(width.type == BinaryLog::ArgInt ? width.i : static_cast<int64>(width.u));
+				}
+				++next_arg;
+			}
+			else {
+				spec.push_back(format[j]);
+			}
+			++j;
+		}
+
+		while (j < format.length() && strchr("hlLqjzt", format[j])) {
+			++j;
+		}
+
+		if (j >= format.length()) {
+			out.append(format, i, std::string::npos);
+			break;
+		}
+
+		char conversion = format[j];
+		i = j;
+
+		if (next_arg >= args.size()) {
+			out += spec;
+			out.push_back(conversion);
+			continue;
+		}
+
+		const BinaryLog::LogArg &arg     = args[next_arg++];
+		bool         numeric = arg.type != BinaryLog::ArgString;
+
+		switch (conversion) {
+			case 'd':
+			case 'i':
+				if (!numeric) {
+					out += arg.s;
+					continue;
+				}
+				snprintf(buffer, sizeof(buffer), (spec + "lld").c_str(),
+					arg.type == BinaryLog::ArgInt ? static_cast<long long>(arg.i) : static_cast<long long>(arg.u));
+				break;
+			case 'u':
+			case 'o':
+			case 'x':
+			case 'X':
+				if (!numeric) {
+					out += arg.s;
+					continue;
+				}
+				snprintf(buffer, sizeof(buffer), (spec + "ll" + conversion).c_str(),
+					arg.type == BinaryLog::ArgInt ? static_cast<unsigned long long>(arg.i) : static_cast<unsigned long long>(arg.u));
+				break;
+			case 'e':
+			case 'E':
+			case 'f':
+			case 'F':
+			case 'g':
+			case 'G':
+			case 'a':
+			case 'A':
+				if (arg.type != BinaryLog::ArgDouble) {
+					out += PlainArg(arg);
+					continue;
+				}
+				snprintf(buffer, sizeof(buffer), (spec + conversion).c_str(), arg.d);
+				break;
+			case 'c':
+				snprintf(buffer, sizeof(buffer), (spec + "c").c_str(), static_cast<int>(arg.u));
+				break;
+			case 's':
+				snprintf(buffer, sizeof(buffer), (spec + "s").c_str(), PlainArg(arg).c_str());
+				break;
+			case 'p':
+				snprintf(buffer, sizeof(buffer), "0x%llx", static_cast<unsigned long long>(arg.u));
+				break;
+			default:
+				out += PlainArg(arg);
+				continue;
+		}
+
+		out += buffer;
+	}
+
+	return out;
+}
+
+bool BinaryLog::ReadArg(BinaryLog::RecordReader &reader, BinaryLog::LogArg &arg)
+{
+	arg.type = reader.GetByte();
+	arg.i    = 0;
+	arg.u    = 0;
+	arg.d    = 0.0;
+	arg.s.clear();
+
+	switch (arg.type) {
+		case BinaryLog::ArgBool:
+		case BinaryLog::ArgChar:
+			arg.u = reader.GetByte();
+			break;
+		case BinaryLog::ArgInt: {
+			uint64 v = reader.GetVarint();
+			arg.i = static_cast<int64>(v >> 1) ^ -static_cast<int64>(v & 1);
+			break;
+		}
+		case BinaryLog::ArgUInt:
+			arg.u = reader.GetVarint();
+			break;
+		case BinaryLog::ArgDouble:
+			arg.d = reader.GetDouble();
+			break;
+		case BinaryLog::ArgString:
+			arg.s = reader.GetString();
+			break;
+		default:
+			return false;
+	}
+
+	return reader.Ok();
+}
@@ -0,0 +1,135 @@
+/**
+ * EQEmulator: Everquest Server Emulator
+ * Copyright (C) 2001-2018 EQEmulator Development Team (https://github.com/EQEmu/Server)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY except by those people which sell it, which
+ * are required to give you total support for your newly bought product;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+*/
+
+#ifndef EQEMU_BINARY_LOG_READER_H
+#define EQEMU_BINARY_LOG_READER_H
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include "binary_log.h"
+
+/**
+ * Reading side of the binary log format described in binary_log.h, shared by utils/log_decoder
+ * and the tests
+ */
+namespace BinaryLog {
+	struct LogArg {
+		uint8       type;
+		int64       i;
+		uint64      u;
+		double      d;
+		std::string s;
+	};
+
+	class RecordReader {
+	public:
+		RecordReader(const char *data, size_t size) : m_data(data), m_size(size), m_pos(0), m_ok(true) {}
+
+		bool Ok() const { return m_ok; }
+		size_t Position() const { return m_pos; }
+
+		uint8 GetByte()
+		{
+			if (m_pos >= m_size) {
+				m_ok = false;
+				return 0;
+			}
+
+			return static_cast<uint8>(m_data[m_pos++]);
+		}
+
+		uint64 GetVarint()
+		{
+			uint64 value = 0;
+			for (int shift = 0; shift < 64; shift += 7) {
+				uint8 b = GetByte();
+				value |= static_cast<uint64>(b & 0x7F) << shift;
+				if (!(b & 0x80)) {
+					return value;
+				}
+			}
+
+			m_ok = false;
+			return value;
+		}
+
+		std::string GetString()
+		{
+			uint64 length = GetVarint();
+			if (!m_ok || length > m_size - m_pos) {
+				m_ok = false;
+				return "";
+			}
+
+			std::string value(m_data + m_pos, static_cast<size_t>(length));
+			m_pos += static_cast<size_t>(length);
+			return value;
+		}
+
+		double GetDouble()
+		{
+			if (m_size - m_pos < sizeof(double)) {
+				m_ok = false;
+				return 0.0;
+			}
+
+			double value;
+			memcpy(&value, m_data + m_pos, sizeof(double));
+			m_pos += sizeof(double);
+			return value;
+		}
+
+	private:
+		const char *m_data;
+		size_t     m_size;
+		size_t     m_pos;
+		bool       m_ok;
+	};
+
+	/**
+	 * Reads one ArgType tagged argument of a RecordEntry
+	 *
+	 * @param reader
+	 * @param arg
+	 * @return
+	 */
+	bool ReadArg(RecordReader &reader, LogArg &arg);
+
+	/**
+	 * Renders a StyleFmt format string with decoded arguments
+	 *
+	 * @param format
+	 * @param args
+	 * @return
+	 */
+	std::string RenderFmt(const std::string &format, const std::vector<LogArg> &args);
+
+	/**
+	 * Renders a StylePrintf format string with decoded arguments
+	 *
+	 * @param format
+	 * @param args
+	 * @return
+	 */
+	std::string RenderPrintf(const std::string &format, const std::vector<LogArg> &args);
+}
+
+#endif
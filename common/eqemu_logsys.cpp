@@ -33,7 +33,6 @@
 #include <sys/stat.h>
 #include <algorithm>
 
-std::ofstream process_log;
 
 #ifdef _WINDOWS
 #include <direct.h>
@@ -90,12 +89,22 @@ EQEmuLogSys::EQEmuLogSys()
 {
 	on_log_gmsay_hook   = [](uint16 log_type, const std::string &) {};
 	on_log_console_hook = [](uint16 debug_level, uint16 log_type, const std::string &) {};
+
+	m_writer.SetSink(
+		[this](std::vector<LogRecord> &records, uint64 dropped) {
+			WriteRecords(records, dropped);
+		}
+	);
 }
 
 /**
  * EQEmuLogSys Deconstructor
  */
-EQEmuLogSys::~EQEmuLogSys() = default;
+EQEmuLogSys::~EQEmuLogSys()
+{
+	// drained here while process_log is still open
+	m_writer.Stop();
+}
 
 EQEmuLogSys *EQEmuLogSys::LoadLogSettingsDefaults()
 {
@@ -108,10 +117,12 @@ EQEmuLogSys *EQEmuLogSys::LoadLogSettingsDefaults()
 		log_settings[log_category_id].log_to_console      = 0;
 		log_settings[log_category_id].log_to_file         = 0;
 		log_settings[log_category_id].log_to_gmsay        = 0;
+		log_settings[log_category_id].log_to_binary       = 0;
 		log_settings[log_category_id].is_category_enabled = 0;
 	}
 
-	file_logs_enabled = false;
+	file_logs_enabled   = false;
+	binary_logs_enabled = false;
 
 	/**
 	 * Set Defaults
@@ -151,7 +162,8 @@ EQEmuLogSys *EQEmuLogSys::LoadLogSettingsDefaults()
 		const bool log_to_console      = log_settings[log_category_id].log_to_console > 0;
 		const bool log_to_file         = log_settings[log_category_id].log_to_file > 0;
 		const bool log_to_gmsay        = log_settings[log_category_id].log_to_gmsay > 0;
-		const bool is_category_enabled = log_to_console || log_to_file || log_to_gmsay;
+		const bool log_to_binary       = log_settings[log_category_id].log_to_binary > 0;
+		const bool is_category_enabled = log_to_console || log_to_file || log_to_gmsay || log_to_binary;
 		if (is_category_enabled) {
 			log_settings[log_category_id].is_category_enabled = 1;
 		}
@@ -273,11 +285,75 @@ void EQEmuLogSys::ProcessLogWrite(
 	char time_stamp[80];
 	EQEmuLogSys::SetCurrentTimeStamp(time_stamp);
 
+	std::unique_lock<std::mutex> lock(m_output_lock);
 	if (process_log) {
 		process_log << time_stamp << " " << message << std::endl;
 	}
 }
 
+/**
+ * Writes a batch handed over by the background writer, flushing once at the end
+ *
+ * @param records
+ * @param dropped
+ */
+void EQEmuLogSys::WriteRecords(std::vector<LogRecord> &records, uint64 dropped)
+{
+	std::unique_lock<std::mutex> lock(m_output_lock);
+
+	if (dropped > 0) {
+		std::string message = FormatOutMessageString(
+			Logs::Error,
+			fmt::format("Log writer dropped [{}] messages, output was faster than it could be written", dropped)
+		);
+
+		WriteConsoleLine(Logs::Error, message);
+		if (process_log) {
+			process_log << message << "\n";
+		}
+	}
+
+	// most of a batch shares a handful of seconds, only reformat the stamp when it changes
+	time_t last_time = 0;
+	char   time_stamp[80];
+	bool   wrote_console = false;
+	bool   wrote_file    = false;
+
+	for (auto &record : records) {
+		if (record.to_console) {
+			WriteConsoleLine(record.log_category, record.message);
+			wrote_console = true;
+		}
+
+		if (record.to_file && process_log) {
+			if (record.time != last_time || !wrote_file) {
+				last_time = record.time;
+				strftime(time_stamp, sizeof(time_stamp), "[%m-%d-%Y :: %H:%M:%S]", localtime(&record.time));
+			}
+
+			process_log << time_stamp << " " << record.message << "\n";
+			wrote_file = true;
+		}
+	}
+
+	if (wrote_console || dropped > 0) {
+		std::cout.flush();
+	}
+
+	if (process_log && (wrote_file || dropped > 0)) {
+		process_log.flush();
+	}
+}
+
+void EQEmuLogSys::FlushLogs()
+{
+	if (m_writer.IsRunning()) {
+		m_writer.Flush();
+	}
+
+	m_binary_log.Flush();
+}
+
 /**
  * @param log_category
  * @return
@@ -370,6 +446,21 @@ uint16 EQEmuLogSys::GetGMSayColorFromCategory(uint16 log_category)
  * @param message
  */
 void EQEmuLogSys::ProcessConsoleMessage(uint16 debug_level, uint16 log_category, const std::string &message)
+{
+	{
+		std::unique_lock<std::mutex> lock(m_output_lock);
+		WriteConsoleLine(log_category, message);
+		std::cout.flush();
+	}
+
+	on_log_console_hook(debug_level, log_category, message);
+}
+
+/**
+ * @param log_category
+ * @param message
+ */
+void EQEmuLogSys::WriteConsoleLine(uint16 log_category, const std::string &message)
 {
 #ifdef _WINDOWS
 	HANDLE  console_handle;
@@ -384,10 +475,8 @@ void EQEmuLogSys::ProcessConsoleMessage(uint16 debug_level, uint16 log_category,
 	std::cout << message << "\n";
 	SetConsoleTextAttribute(console_handle, Console::Color::White);
 #else
-	std::cout << EQEmuLogSys::GetLinuxConsoleColorFromCategory(log_category) << message << LC_RESET << std::endl;
+	std::cout << EQEmuLogSys::GetLinuxConsoleColorFromCategory(log_category) << message << LC_RESET << "\n";
 #endif
-
-	on_log_console_hook(debug_level, log_category, message);
 }
 
 /**
@@ -477,6 +566,37 @@ void EQEmuLogSys::Out(
 
 	std::string output_debug_message = EQEmuLogSys::FormatOutMessageString(log_category, prefix + output_message);
 
+	/**
+	 * Crashes are written synchronously, after whatever led up to them
+	 */
+	if (log_category == Logs::Crash) {
+		FlushLogs();
+	}
+
+	if (RuleB(Logging, AsyncWrites) && log_category != Logs::Crash && (log_to_console || log_to_file)) {
+		if (log_to_gmsay) {
+			EQEmuLogSys::ProcessGMSay(debug_level, log_category, output_debug_message);
+		}
+
+		if (log_to_console) {
+			on_log_console_hook(debug_level, log_category, output_debug_message);
+		}
+
+		if (!m_writer.IsRunning()) {
+			m_writer.Start();
+		}
+
+		LogRecord record;
+		record.time         = time(nullptr);
+		record.debug_level  = static_cast<uint16>(debug_level);
+		record.log_category = log_category;
+		record.to_console   = log_to_console;
+		record.to_file      = log_to_file;
+		record.message      = std::move(output_debug_message);
+		m_writer.Push(std::move(record));
+		return;
+	}
+
 	if (log_to_console) {
 		EQEmuLogSys::ProcessConsoleMessage(debug_level, log_category, output_debug_message);
 	}
@@ -521,6 +641,11 @@ void EQEmuLogSys::MakeDirectory(const std::string &directory_name)
 
 void EQEmuLogSys::CloseFileLogs()
 {
+	FlushLogs();
+
+	m_binary_log.Close();
+
+	std::unique_lock<std::mutex> lock(m_output_lock);
 	if (process_log.is_open()) {
 		process_log.close();
 	}
@@ -536,10 +661,12 @@ void EQEmuLogSys::StartFileLogs(const std::string &log_name)
 	/**
 	 * When loading settings, we must have been given a reason in category based logging to output to a file in order to even create or open one...
 	 */
-	if (!file_logs_enabled) {
+	if (!file_logs_enabled && !binary_logs_enabled) {
 		return;
 	}
 
+	std::string log_path;
+
 	/**
 	 * Zone
 	 */
@@ -552,20 +679,12 @@ void EQEmuLogSys::StartFileLogs(const std::string &log_name)
 			return;
 		}
 
-		LogInfo("Starting File Log [logs/{}_{}.log]", platform_file_name.c_str(), getpid());
-
 		/**
 		 * Make directory if not exists
 		 */
 		EQEmuLogSys::MakeDirectory("logs/zone");
 
-		/**
-		 * Open file pointer
-		 */
-		process_log.open(
-			StringFormat("logs/zone/%s_%i.log", platform_file_name.c_str(), getpid()),
-			std::ios_base::app | std::ios_base::out
-		);
+		log_path = StringFormat("logs/zone/%s_%i", platform_file_name.c_str(), getpid());
 	}
 	else {
 
@@ -576,15 +695,25 @@ void EQEmuLogSys::StartFileLogs(const std::string &log_name)
 			return;
 		}
 
-		LogInfo("Starting File Log [logs/{}_{}.log]", platform_file_name.c_str(), getpid());
+		log_path = StringFormat("logs/%s_%i", platform_file_name.c_str(), getpid());
+	}
+
+	if (file_logs_enabled) {
+		LogInfo("Starting File Log [{}.log]", log_path);
 
 		/**
 		 * Open file pointer
 		 */
-		process_log.open(
-			StringFormat("logs/%s_%i.log", platform_file_name.c_str(), getpid()),
-			std::ios_base::app | std::ios_base::out
-		);
+		std::unique_lock<std::mutex> lock(m_output_lock);
+		process_log.open(log_path + ".log", std::ios_base::app | std::ios_base::out);
+	}
+
+	if (binary_logs_enabled) {
+		LogInfo("Starting Binary Log [{}.binlog]", log_path);
+
+		if (!m_binary_log.Open(log_path + ".binlog", platform_file_name, Logs::LogCategoryName, Logs::MaxCategoryID)) {
+			LogError("Unable to open binary log [{}.binlog]", log_path);
+		}
 	}
 }
 
@@ -630,13 +759,15 @@ EQEmuLogSys *EQEmuLogSys::LoadLogDatabaseSettings()
 		log_settings[c.log_category_id].log_to_console = static_cast<uint8>(c.log_to_console);
 		log_settings[c.log_category_id].log_to_file    = static_cast<uint8>(c.log_to_file);
 		log_settings[c.log_category_id].log_to_gmsay   = static_cast<uint8>(c.log_to_gmsay);
+		log_settings[c.log_category_id].log_to_binary  = static_cast<uint8>(c.log_to_binary);
 
 		// Determine if any output method is enabled for the category
 		// and set it to 1 so it can used to check if category is enabled
 		const bool log_to_console      = log_settings[c.log_category_id].log_to_console > 0;
 		const bool log_to_file         = log_settings[c.log_category_id].log_to_file > 0;
 		const bool log_to_gmsay        = log_settings[c.log_category_id].log_to_gmsay > 0;
-		const bool is_category_enabled = log_to_console || log_to_file || log_to_gmsay;
+		const bool log_to_binary       = log_settings[c.log_category_id].log_to_binary > 0;
+		const bool is_category_enabled = log_to_console || log_to_file || log_to_gmsay || log_to_binary;
 
 		if (is_category_enabled) {
 			log_settings[c.log_category_id].is_category_enabled = 1;
@@ -649,6 +780,10 @@ EQEmuLogSys *EQEmuLogSys::LoadLogDatabaseSettings()
 			LogSys.file_logs_enabled = true;
 		}
 
+		if (log_settings[c.log_category_id].log_to_binary > 0) {
+			LogSys.binary_logs_enabled = true;
+		}
+
 		db_categories.emplace_back(c.log_category_id);
 	}
 
@@ -666,6 +801,7 @@ EQEmuLogSys *EQEmuLogSys::LoadLogDatabaseSettings()
 			new_category.log_to_console           = log_settings[i].log_to_console;
 			new_category.log_to_gmsay             = log_settings[i].log_to_gmsay;
 			new_category.log_to_file              = log_settings[i].log_to_file;
+			new_category.log_to_binary            = log_settings[i].log_to_binary;
 
 			LogsysCategoriesRepository::InsertOne(*m_database, new_category);
 		}
@@ -26,6 +26,7 @@
 #include <cstdio>
 #include <functional>
 #include <algorithm>
+#include <mutex>
 
 #ifdef _WIN32
 #ifdef utf16_to_utf8
@@ -35,6 +36,8 @@
 
 #include <fmt/format.h>
 #include "types.h"
+#include "async_log_writer.h"
+#include "binary_log.h"
 
 namespace Logs {
 	enum DebugLevel {
@@ -275,12 +278,14 @@ public:
      * log_to_file[category_id]    = [1-3] - Sets debug level for category to output to file
      * log_to_console[category_id] = [1-3] - Sets debug level for category to output to console
      * log_to_gmsay[category_id]   = [1-3] - Sets debug level for category to output to gmsay
+     * log_to_binary[category_id]  = [1-3] - Sets debug level for category to output to the binary log
      *
 	*/
 	struct LogSettings {
 		uint8 log_to_file;
 		uint8 log_to_console;
 		uint8 log_to_gmsay;
+		uint8 log_to_binary;
 		uint8 is_category_enabled; /* When any log output in a category > 0, set this to 1 as (Enabled) */
 	};
 
@@ -291,7 +296,8 @@ public:
 	*/
 	LogSettings log_settings[Logs::LogCategory::MaxCategoryID]{};
 
-	bool file_logs_enabled = false;
+	bool file_logs_enabled   = false;
+	bool binary_logs_enabled = false;
 
 	int                                                                               log_platform = 0;
 	std::string                                                                       platform_file_name;
@@ -319,8 +325,101 @@ public:
 	// database
 	EQEmuLogSys *SetDatabase(Database *db);
 
+	/**
+	 * Writes out everything still queued for the background writer on the calling thread
+	 */
+	void FlushLogs();
+	const AsyncLogWriter &GetAsyncWriter() const { return m_writer; }
+
+	/**
+	 * True when console, file or gmsay would take this entry, lets OutF skip formatting entries
+	 * that only go to the binary log
+	 *
+	 * @param debug_level
+	 * @param log_category
+	 * @return
+	 */
+	bool IsTextLogEnabled(Logs::DebugLevel debug_level, uint16 log_category) const
+	{
+		return log_settings[log_category].log_to_console >= debug_level ||
+			log_settings[log_category].log_to_file >= debug_level ||
+			log_settings[log_category].log_to_gmsay >= debug_level;
+	}
+
+	/**
+	 * Records the format string and raw arguments, rendered later by utils/log_decoder
+	 */
+	template<typename Format, typename... Args>
+	void OutBinary(
+		BinaryLog::FormatStyle style,
+		Logs::DebugLevel debug_level,
+		uint16 log_category,
+		const char *file,
+		const char *func,
+		int line,
+		const Format &format,
+		const Args &... args
+	)
+	{
+		m_binary_log.Write(style, debug_level, log_category, file, func, line, format, args...);
+	}
+
+	/**
+	 * Backs the OutF macro, the arguments are evaluated once by the caller and shared by the binary
+	 * log and the text sinks
+	 */
+	template<typename Format, typename... Args>
+	void OutFormat(
+		Logs::DebugLevel debug_level,
+		uint16 log_category,
+		const char *file,
+		const char *func,
+		int line,
+		const Format &format,
+		const Args &... args
+	)
+	{
+		if (log_settings[log_category].log_to_binary >= debug_level) {
+			OutBinary(BinaryLog::StyleFmt, debug_level, log_category, file, func, line, format, args...);
+		}
+
+		if (IsTextLogEnabled(debug_level, log_category)) {
+			Out(debug_level, log_category, file, func, line, fmt::format(format, args...).c_str());
+		}
+	}
+
+	/**
+	 * Backs the printf style Log() macro, see OutFormat
+	 */
+	template<typename... Args>
+	void OutPrintf(
+		Logs::DebugLevel debug_level,
+		uint16 log_category,
+		const char *file,
+		const char *func,
+		int line,
+		const char *format,
+		const Args &... args
+	)
+	{
+		if (log_settings[log_category].log_to_binary >= debug_level) {
+			OutBinary(BinaryLog::StylePrintf, debug_level, log_category, file, func, line, format, args...);
+		}
+
+		Out(debug_level, log_category, file, func, line, format, args...);
+	}
+
+	const BinaryLogWriter &GetBinaryLog() const { return m_binary_log; }
+
 private:
 
+	// console and file output, written in batches by m_writer when async writes are enabled
+	AsyncLogWriter m_writer;
+	std::mutex     m_output_lock;
+	std::ofstream  process_log;
+
+	BinaryLogWriter m_binary_log;
+
 	// reference to database
 	Database *m_database;
 
@@ -334,6 +433,8 @@ private:
 	void ProcessConsoleMessage(uint16 debug_level, uint16 log_category, const std::string &message);
 	void ProcessGMSay(uint16 debug_level, uint16 log_category, const std::string &message);
 	void ProcessLogWrite(uint16 debug_level, uint16 log_category, const std::string &message);
+	void WriteConsoleLine(uint16 log_category, const std::string &message);
+	void WriteRecords(std::vector<LogRecord> &records, uint64 dropped);
 	bool IsRfc5424LogCategory(uint16 log_category);
 };
 
@@ -359,7 +460,7 @@ void OutF(
 
 #define OutF(ls, debug_level, log_category, file, func, line, formatStr, ...) \
 do { \
-    ls.Out(debug_level, log_category, file, func, line, fmt::format(formatStr, ##__VA_ARGS__).c_str()); \
+    ls.OutFormat(debug_level, log_category, file, func, line, formatStr, ##__VA_ARGS__); \
 } while(0)
 
 #endif
@@ -0,0 +1,242 @@
+#include "servertalk_batch.h"
+#include "../types.h"
+#include "../compression.h"
+#include <cstring>
+
+EQ::Net::ServertalkBatcher::ServertalkBatcher(Writer writer)
+	: m_writer(writer),
+	m_batching(false),
+	m_compress_threshold(0),
+	m_peer_capabilities(0),
+	m_dropped(0),
+	m_message_count(0),
+	m_frame_count(0),
+	m_coalesced_count(0)
+{
+	m_flush_timer = std::make_unique<EQ::Timer>([this](EQ::Timer *t) {
+		Flush();
+	});
+}
+
+EQ::Net::ServertalkBatcher::~ServertalkBatcher()
+{
+}
+
+void EQ::Net::ServertalkBatcher::Reset()
+{
+	m_batch.clear();
+	m_pending.clear();
+	m_coalesce_pending.clear();
+	m_dropped = 0;
+	m_peer_capabilities = 0;
+	m_flush_timer->Stop();
+}
+
+void EQ::Net::ServertalkBatcher::Queue(uint16_t opcode, const char *data, size_t length)
+{
+	m_message_count++;
+
+	if (!IsBatching() || length + 6 > MaxBatchSize) {
+		WriteMessage(opcode, data, length);
+		return;
+	}
+
+	if (m_batch.size() + length + 6 > MaxBatchSize) {
+		Flush();
+	}
+
+	auto coalesce = m_coalesce.find(opcode);
+	if (coalesce != m_coalesce.end()) {
+		uint64_t key = 0;
+		if (coalesce->second(data, length, key)) {
+			auto queued = m_coalesce_pending.find(std::make_pair(opcode, key));
+			if (queued != m_coalesce_pending.end()) {
+				m_pending[queued->second].dropped = true;
+				m_dropped++;
+				m_coalesced_count++;
+				queued->second = m_pending.size();
+			}
+			else {
+				m_coalesce_pending.emplace(std::make_pair(opcode, key), m_pending.size());
+			}
+		}
+		else {
+			// nothing queued before this message may be dropped any more
+			auto iter = m_coalesce_pending.lower_bound(std::make_pair(opcode, (uint64_t)0));
+			while (iter != m_coalesce_pending.end() && iter->first.first == opcode) {
+				iter = m_coalesce_pending.erase(iter);
+			}
+		}
+	}
+
+	Pending pending;
+	pending.offset  = m_batch.size();
+	pending.length  = length + 6;
+	pending.dropped = false;
+	m_pending.push_back(pending);
+
+	AppendMessage(m_batch, opcode, data, length);
+
+	// does nothing while a flush is already scheduled
+	m_flush_timer->Start(0, false);
+}
+
+void EQ::Net::ServertalkBatcher::WriteFrame(ServertalkPacketType type, const char *data, size_t length)
+{
+	Flush();
+
+	m_frame.resize(5 + length);
+	uint32_t frame_length = (uint32_t)length;
+	memcpy(&m_frame[0], &frame_length, sizeof(uint32_t));
+	m_frame[4] = (char)type;
+	if (length > 0) {
+		memcpy(&m_frame[5], data, length);
+	}
+
+	m_frame_count++;
+	m_writer(&m_frame[0], m_frame.size());
+}
+
+void EQ::Net::ServertalkBatcher::Flush()
+{
+	if (m_pending.empty()) {
+		return;
+	}
+
+	const char *batch = &m_batch[0];
+	size_t     length = m_batch.size();
+	size_t     live   = m_pending.size() - m_dropped;
+
+	if (m_dropped > 0) {
+		m_scratch.clear();
+		for (auto &pending : m_pending) {
+			if (!pending.dropped) {
+				m_scratch.insert(m_scratch.end(), batch + pending.offset, batch + pending.offset + pending.length);
+			}
+		}
+
+		batch  = &m_scratch[0];
+		length = m_scratch.size();
+	}
+
+	m_pending.clear();
+	m_coalesce_pending.clear();
+	m_dropped = 0;
+
+	if (live == 1) {
+		WriteFrame(ServertalkMessage, batch, length);
+	}
+	else if (
+		m_compress_threshold > 0 &&
+		length >= m_compress_threshold &&
+		(m_peer_capabilities & ServertalkCapabilityCompression)
+	) {
+		std::vector<char> compressed(sizeof(uint32_t) + length + 1024);
+		uint32_t          raw_length = (uint32_t)length;
+		memcpy(&compressed[0], &raw_length, sizeof(uint32_t));
+
+		uint32_t compressed_length = EQ::DeflateData(
+			batch,
+			(uint32)length,
+			&compressed[sizeof(uint32_t)],
+			(uint32)(compressed.size() - sizeof(uint32_t))
+		);
+
+		if (compressed_length > 0 && compressed_length + sizeof(uint32_t) < length) {
+			WriteFrame(ServertalkCompressedBatch, &compressed[0], compressed_length + sizeof(uint32_t));
+		}
+		else {
+			WriteFrame(ServertalkMessageBatch, batch, length);
+		}
+	}
+	else {
+		WriteFrame(ServertalkMessageBatch, batch, length);
+	}
+
+	m_batch.clear();
+}
+
+bool EQ::Net::ServertalkBatcher::Unpack(
+	ServertalkPacketType type,
+	Packet &p,
+	std::vector<char> &scratch,
+	const std::function<void(Packet &)> &on_message
+)
+{
+	const char *data  = (const char *)p.Data();
+	size_t     length = p.Length();
+
+	if (type == ServertalkCompressedBatch) {
+		if (length < sizeof(uint32_t)) {
+			return false;
+		}
+
+		uint32_t raw_length = 0;
+		memcpy(&raw_length, data, sizeof(uint32_t));
+		if (raw_length == 0 || raw_length > MaxInflatedSize) {
+			return false;
+		}
+
+		scratch.resize(raw_length);
+		uint32_t inflated = EQ::InflateData(
+			data + sizeof(uint32_t),
+			(uint32)(length - sizeof(uint32_t)),
+			&scratch[0],
+			raw_length
+		);
+
+		if (inflated != raw_length) {
+			return false;
+		}
+
+		data   = &scratch[0];
+		length = raw_length;
+	}
+
+	size_t offset = 0;
+	while (offset < length) {
+		if (length - offset < 6) {
+			return false;
+		}
+
+		uint32_t message_length = 0;
+		memcpy(&message_length, data + offset, sizeof(uint32_t));
+		if (message_length > length - offset - 6) {
+			return false;
+		}
+
+		EQ::Net::StaticPacket message((void *)(data + offset), message_length + 6);
+		on_message(message);
+
+		offset += message_length + 6;
+	}
+
+	return true;
+}
+
+void EQ::Net::ServertalkBatcher::WriteMessage(uint16_t opcode, const char *data, size_t length)
+{
+	Flush();
+
+	m_frame.resize(5);
+	uint32_t frame_length = (uint32_t)(length + 6);
+	memcpy(&m_frame[0], &frame_length, sizeof(uint32_t));
+	m_frame[4] = (char)ServertalkMessage;
+	AppendMessage(m_frame, opcode, data, length);
+
+	m_frame_count++;
+	m_writer(&m_frame[0], m_frame.size());
+}
+
+void EQ::Net::ServertalkBatcher::AppendMessage(std::vector<char> &out, uint16_t opcode, const char *data, size_t length)
+{
+	size_t offset = out.size();
+	out.resize(offset + 6 + length);
+
+	uint32_t message_length = (uint32_t)length;
+	memcpy(&out[offset], &message_length, sizeof(uint32_t));
+	memcpy(&out[offset + 4], &opcode, sizeof(uint16_t));
+	if (length > 0) {
+		memcpy(&out[offset + 6], data, length);
+	}
+}
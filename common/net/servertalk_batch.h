@@ -0,0 +1,115 @@
+#pragma once
+
+#include "packet.h"
+#include "servertalk_common.h"
+#include "../event/timer.h"
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace EQ
+{
+	namespace Net
+	{
+		/**
+		 * Outbound queue for a servertalk connection
+		 *
+		 * Messages are appended to one buffer as they are sent and written as a single
+		 * ServertalkMessageBatch frame on the next pass of the event loop, or sooner once the batch
+		 * is full. Batches over the compression threshold go out deflated when the peer can take it.
+		 *
+		 * An opcode can be given a coalesce key; a queued message with the same opcode and key is
+		 * dropped when a newer one arrives, so only the latest state goes out. A message of that
+		 * opcode without a key keeps everything queued before it.
+		 *
+		 * Batching is off until SetBatching(true), the links that read Network:ServertalkBatching opt
+		 * in. Until then, or until the peer has said it understands batches, every message is written
+		 * straight through as its own ServertalkMessage frame, same as before
+		 */
+		class ServertalkBatcher
+		{
+		public:
+			typedef std::function<void(const char *data, size_t length)> Writer;
+			typedef std::function<bool(const char *data, size_t length, uint64_t &key)> CoalesceKey;
+
+			static const uint32_t Capabilities = ServertalkCapabilityBatch | ServertalkCapabilityCompression;
+			static const size_t MaxBatchSize = 64 * 1024;
+			static const size_t MaxInflatedSize = 16 * 1024 * 1024;
+
+			ServertalkBatcher(Writer writer);
+			~ServertalkBatcher();
+
+			void SetBatching(bool batching) { m_batching = batching; }
+			void SetCompressThreshold(size_t bytes) { m_compress_threshold = bytes; }
+			void SetCoalesce(uint16_t opcode, CoalesceKey key) { m_coalesce[opcode] = key; }
+			void SetPeerCapabilities(uint32_t capabilities) { m_peer_capabilities = capabilities; }
+			bool IsBatching() const { return m_batching && (m_peer_capabilities & ServertalkCapabilityBatch); }
+
+			/**
+			 * Drops anything queued and forgets the peer, for when the connection goes away
+			 */
+			void Reset();
+
+			void Queue(uint16_t opcode, const char *data, size_t length);
+
+			/**
+			 * Writes a frame that isn't a message, after whatever is queued
+			 *
+			 * @param type
+			 * @param data
+			 * @param length
+			 */
+			void WriteFrame(ServertalkPacketType type, const char *data, size_t length);
+			void Flush();
+
+			uint64_t GetMessages() const { return m_message_count; }
+			uint64_t GetFrames() const { return m_frame_count; }
+			uint64_t GetCoalesced() const { return m_coalesced_count; }
+
+			/**
+			 * Calls on_message with each ServertalkMessage payload in a batch frame
+			 *
+			 * @param type ServertalkMessageBatch or ServertalkCompressedBatch
+			 * @param p
+			 * @param scratch holds the inflated batch
+			 * @param on_message
+			 * @return false when the frame is malformed
+			 */
+			static bool Unpack(
+				ServertalkPacketType type,
+				Packet &p,
+				std::vector<char> &scratch,
+				const std::function<void(Packet &)> &on_message
+			);
+
+		private:
+			struct Pending {
+				size_t offset;
+				size_t length;
+				bool   dropped;
+			};
+
+			void WriteMessage(uint16_t opcode, const char *data, size_t length);
+			void AppendMessage(std::vector<char> &out, uint16_t opcode, const char *data, size_t length);
+
+			Writer                                       m_writer;
+			std::unique_ptr<EQ::Timer>                   m_flush_timer;
+			bool                                         m_batching;
+			size_t                                       m_compress_threshold;
+			uint32_t                                     m_peer_capabilities;
+			std::map<uint16_t, CoalesceKey>              m_coalesce;
+			std::map<std::pair<uint16_t, uint64_t>, size_t> m_coalesce_pending;
+
+			std::vector<char>    m_batch;
+			std::vector<Pending> m_pending;
+			size_t               m_dropped;
+			std::vector<char>    m_frame;
+			std::vector<char>    m_scratch;
+
+			uint64_t m_message_count;
+			uint64_t m_frame_count;
+			uint64_t m_coalesced_count;
+		};
+	}
+}
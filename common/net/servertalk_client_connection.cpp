@@ -3,7 +3,12 @@
 #include "../eqemu_logsys.h"
 
 EQ::Net::ServertalkClient::ServertalkClient(const std::string &addr, int port, bool ipv6, const std::string &identifier, const std::string &credentials)
-	: m_timer(std::make_unique<EQ::Timer>(100, true, std::bind(&EQ::Net::ServertalkClient::Connect, this)))
+	: m_timer(std::make_unique<EQ::Timer>(100, true, std::bind(&EQ::Net::ServertalkClient::Connect, this))),
+	m_batcher([this](const char *data, size_t length) {
+		if (m_connection) {
+			m_connection->Write(data, length);
+		}
+	})
 {
 	m_port = port;
 	m_ipv6 = ipv6;
@@ -17,6 +22,7 @@ EQ::Net::ServertalkClient::ServertalkClient(const std::string &addr, int port, b
 
 EQ::Net::ServertalkClient::~ServertalkClient()
 {
+	m_batcher.Flush();
 }
 
 void EQ::Net::ServertalkClient::Send(uint16_t opcode, EQ::Net::Packet &p)
@@ -26,20 +32,23 @@ void EQ::Net::ServertalkClient::Send(uint16_t opcode, EQ::Net::Packet &p)
 		p.PutUInt8(0, 0);
 	}
 
-	EQ::Net::DynamicPacket out;
-	out.PutUInt32(0, p.Length());
-	out.PutUInt16(4, opcode);
-	out.PutPacket(6, p);
+	if (!m_connection)
+		return;
 
-	InternalSend(ServertalkMessage, out);
+	m_batcher.Queue(opcode, (const char*)p.Data(), p.Length());
 }
 
 void EQ::Net::ServertalkClient::SendPacket(ServerPacket *p)
 {
-	EQ::Net::DynamicPacket pout;
-	if (p->pBuffer) {
-		pout.PutData(0, p->pBuffer, p->size);
+	if (p->pBuffer && p->size > 0) {
+		if (!m_connection)
+			return;
+
+		m_batcher.Queue(p->opcode, (const char*)p->pBuffer, p->size);
+		return;
 	}
+
+	EQ::Net::DynamicPacket pout;
 	Send(p->opcode, pout);
 }
 
@@ -68,9 +77,11 @@ void EQ::Net::ServertalkClient::Connect()
 		}
 
 		LogF(Logs::General, Logs::TCPConnection, "Connected to {0}:{1}", m_addr, m_port);
+		m_batcher.Reset();
 		m_connection = connection;
 		m_connection->OnDisconnect([this](EQ::Net::TCPConnection *c) {
 			LogF(Logs::General, Logs::TCPConnection, "Connection lost to {0}:{1}, attempting to reconnect...", m_addr, m_port);
+			m_batcher.Reset();
 			m_connection.reset();
 		});
 
@@ -104,14 +115,7 @@ void EQ::Net::ServertalkClient::InternalSend(ServertalkPacketType type, EQ::Net:
 	if (!m_connection)
 		return;
 
-	EQ::Net::DynamicPacket out;
-	out.PutUInt32(0, (uint32_t)p.Length());
-	out.PutUInt8(4, (uint8_t)type);
-	if (p.Length() > 0) {
-		out.PutPacket(5, p);
-	}
-
-	m_connection->Write((const char*)out.Data(), out.Length());
+	m_batcher.WriteFrame(type, (const char*)p.Data(), p.Length());
 }
 
 void EQ::Net::ServertalkClient::ProcessReadBuffer()
@@ -149,6 +153,13 @@ void EQ::Net::ServertalkClient::ProcessReadBuffer()
 			case ServertalkMessage:
 				ProcessMessage(p);
 				break;
+			case ServertalkMessageBatch:
+			case ServertalkCompressedBatch:
+				ProcessBatch((ServertalkPacketType)type, p);
+				break;
+			case ServertalkCapabilities:
+				ProcessCapabilities(p);
+				break;
 			}
 		}
 		else {
@@ -160,6 +171,13 @@ void EQ::Net::ServertalkClient::ProcessReadBuffer()
 			case ServertalkMessage:
 				ProcessMessage(p);
 				break;
+			case ServertalkMessageBatch:
+			case ServertalkCompressedBatch:
+				ProcessBatch((ServertalkPacketType)type, p);
+				break;
+			case ServertalkCapabilities:
+				ProcessCapabilities(p);
+				break;
 			}
 		}
 
@@ -199,10 +217,12 @@ void EQ::Net::ServertalkClient::ProcessMessage(EQ::Net::Packet &p)
 		auto length = p.GetUInt32(0);
 		auto opcode = p.GetUInt16(4);
 		if (length > 0) {
-			auto data = p.GetString(6, length);
+			if (p.Length() < 6 + (size_t)length) {
+				throw std::out_of_range("Message length exceeds the frame");
+			}
 
-			size_t message_len = length;
-			EQ::Net::StaticPacket packet(&data[0], message_len);
+			// a view into the read buffer, handlers don't keep the packet past the callback
+			EQ::Net::StaticPacket packet((char*)p.Data() + 6, length);
 
 			auto cb = m_message_callbacks.find(opcode);
 			if (cb != m_message_callbacks.end()) {
@@ -219,11 +239,34 @@ void EQ::Net::ServertalkClient::ProcessMessage(EQ::Net::Packet &p)
 	}
 }
 
+void EQ::Net::ServertalkClient::ProcessBatch(ServertalkPacketType type, EQ::Net::Packet &p)
+{
+	bool valid = ServertalkBatcher::Unpack(type, p, m_inflate_buffer, [this](EQ::Net::Packet &message) {
+		ProcessMessage(message);
+	});
+
+	if (!valid) {
+		LogError("Error parsing message batch from server");
+	}
+}
+
+void EQ::Net::ServertalkClient::ProcessCapabilities(EQ::Net::Packet &p)
+{
+	try {
+		m_batcher.SetPeerCapabilities(p.GetUInt32(0));
+	}
+	catch (std::exception &ex) {
+		LogError("Error parsing capabilities from server: {0}", ex.what());
+	}
+}
+
 void EQ::Net::ServertalkClient::SendHandshake()
 {
 	EQ::Net::DynamicPacket handshake;
 	handshake.PutString(0, m_identifier);
 	handshake.PutString(m_identifier.length() + 1, m_credentials);
 	handshake.PutUInt8(m_identifier.length() + 1 + m_credentials.length(), 0);
+	// servers that predate capabilities stop reading at the credentials
+	handshake.PutUInt32(m_identifier.length() + 1 + m_credentials.length() + 1, ServertalkBatcher::Capabilities);
 	InternalSend(ServertalkClientDowngradeSecurityHandshake, handshake);
 }
@@ -3,6 +3,7 @@
 #include "tcp_connection.h"
 #include "../event/timer.h"
 #include "servertalk_common.h"
+#include "servertalk_batch.h"
 #include "packet.h"
 
 namespace EQ
@@ -22,6 +23,13 @@ namespace EQ
 			void OnMessage(std::function<void(uint16_t, EQ::Net::Packet&)> cb);
 			bool Connected() const { return m_connecting != true; }
 
+			// off by default, and only starts once the server has said it can take batches
+			void SetBatching(bool batching) { m_batcher.SetBatching(batching); }
+			void SetCompressThreshold(size_t bytes) { m_batcher.SetCompressThreshold(bytes); }
+			void SetCoalesce(uint16_t opcode, ServertalkBatcher::CoalesceKey key) { m_batcher.SetCoalesce(opcode, key); }
+			void Flush() { m_batcher.Flush(); }
+			const ServertalkBatcher &GetBatcher() const { return m_batcher; }
+
 			std::shared_ptr<EQ::Net::TCPConnection> Handle() { return m_connection; }
 		private:
 			void Connect();
@@ -31,6 +39,8 @@ namespace EQ
 			void ProcessReadBuffer();
 			void ProcessHello(EQ::Net::Packet &p);
 			void ProcessMessage(EQ::Net::Packet &p);
+			void ProcessBatch(ServertalkPacketType type, EQ::Net::Packet &p);
+			void ProcessCapabilities(EQ::Net::Packet &p);
 			void SendHandshake();
 
 			std::unique_ptr<EQ::Timer> m_timer;
@@ -46,6 +56,8 @@ namespace EQ
 			std::unordered_map<uint16_t, std::function<void(uint16_t, EQ::Net::Packet&)>> m_message_callbacks;
 			std::function<void(uint16_t, EQ::Net::Packet&)> m_message_callback;
 			std::function<void(ServertalkClient*)> m_on_connect_cb;
+			ServertalkBatcher m_batcher;
+			std::vector<char> m_inflate_buffer;
 		};
 	}
 }
@@ -13,6 +13,17 @@ namespace EQ
 			ServertalkClientHandshake,
 			ServertalkClientDowngradeSecurityHandshake,
 			ServertalkMessage,
+			ServertalkMessageBatch,
+			ServertalkCompressedBatch,
+			ServertalkCapabilities,
+		};
+
+		// what a side can receive, exchanged after the handshake; peers that don't know about
+		// it never reply and only ever get plain ServertalkMessage frames
+		enum ServertalkCapability
+		{
+			ServertalkCapabilityBatch       = 1,
+			ServertalkCapabilityCompression = 2,
 		};
 	}
 }
@@ -2,6 +2,8 @@
 
 EQ::Net::ServertalkServer::ServertalkServer()
 {
+	m_batching = false;
+	m_compress_threshold = 0;
 }
 
 EQ::Net::ServertalkServer::~ServertalkServer()
@@ -11,6 +13,8 @@ EQ::Net::ServertalkServer::~ServertalkServer()
 void EQ::Net::ServertalkServer::Listen(const ServertalkServerOptions& opts)
 {
 	m_credentials = opts.credentials;
+	m_batching = opts.batching;
+	m_compress_threshold = opts.compress_threshold;
 	m_server = std::make_unique<EQ::Net::TCPServer>();
 	m_server->Listen(opts.port, opts.ipv6, [this](std::shared_ptr<EQ::Net::TCPConnection> connection) {
 		m_unident_connections.push_back(std::make_shared<ServertalkServerConnection>(connection, this));
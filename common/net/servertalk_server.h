@@ -14,9 +14,13 @@ namespace EQ
 			int port;
 			bool ipv6;
 			std::string credentials;
+			bool batching;
+			size_t compress_threshold;
 
 			ServertalkServerOptions() {
 				ipv6 = false;
+				batching = false;
+				compress_threshold = 0;
 			}
 		};
 
@@ -44,6 +48,8 @@ namespace EQ
 			bool m_encrypted;
 			bool m_allow_downgrade;
 			std::string m_credentials;
+			bool m_batching;
+			size_t m_compress_threshold;
 
 			friend class ServertalkServerConnection;
 		};
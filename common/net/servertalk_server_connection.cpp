@@ -4,6 +4,11 @@
 #include "../util/uuid.h"
 
 EQ::Net::ServertalkServerConnection::ServertalkServerConnection(std::shared_ptr<EQ::Net::TCPConnection> c, EQ::Net::ServertalkServer *parent)
+	: m_batcher([this](const char *data, size_t length) {
+		if (m_connection) {
+			m_connection->Write(data, length);
+		}
+	})
 {
 	m_connection = c;
 	m_parent = parent;
@@ -16,6 +21,7 @@ EQ::Net::ServertalkServerConnection::ServertalkServerConnection(std::shared_ptr<
 
 EQ::Net::ServertalkServerConnection::~ServertalkServerConnection()
 {
+	m_batcher.Flush();
 }
 
 void EQ::Net::ServertalkServerConnection::Send(uint16_t opcode, EQ::Net::Packet & p)
@@ -80,17 +86,21 @@ void EQ::Net::ServertalkServerConnection::Send(uint16_t opcode, EQ::Net::Packet
 			p.PutUInt8(0, 0);
 		}
 
-		EQ::Net::DynamicPacket out;
-		out.PutUInt32(0, p.Length());
-		out.PutUInt16(4, opcode);
-		out.PutPacket(6, p);
+		if (!m_connection)
+			return;
 
-		InternalSend(ServertalkMessage, out);
+		m_batcher.Queue(opcode, (const char*)p.Data(), p.Length());
 	}
 }
 
 void EQ::Net::ServertalkServerConnection::SendPacket(ServerPacket *p)
 {
+	// anything that needs padding or the legacy translation goes the long way
+	if (!m_legacy_mode && m_connection && p->pBuffer && p->size > 0 && p->size != 43061256) {
+		m_batcher.Queue(p->opcode, (const char*)p->pBuffer, p->size);
+		return;
+	}
+
 	EQ::Net::DynamicPacket pout;
 	if (p->pBuffer) {
 		pout.PutData(0, p->pBuffer, p->size);
@@ -179,6 +189,10 @@ void EQ::Net::ServertalkServerConnection::ProcessReadBuffer()
 			case ServertalkMessage:
 				ProcessMessage(p);
 				break;
+			case ServertalkMessageBatch:
+			case ServertalkCompressedBatch:
+				ProcessBatch((ServertalkPacketType)type, p);
+				break;
 			}
 		}
 		else {
@@ -196,6 +210,10 @@ void EQ::Net::ServertalkServerConnection::ProcessReadBuffer()
 			case ServertalkMessage:
 				ProcessMessage(p);
 				break;
+			case ServertalkMessageBatch:
+			case ServertalkCompressedBatch:
+				ProcessBatch((ServertalkPacketType)type, p);
+				break;
 			}
 		}
 
@@ -263,6 +281,7 @@ void EQ::Net::ServertalkServerConnection::ProcessOldReadBuffer()
 
 void EQ::Net::ServertalkServerConnection::OnDisconnect(TCPConnection *c)
 {
+	m_batcher.Reset();
 	m_parent->ConnectionDisconnected(this);
 }
 
@@ -279,14 +298,7 @@ void EQ::Net::ServertalkServerConnection::InternalSend(ServertalkPacketType type
 	if (!m_connection || m_legacy_mode)
 		return;
 
-	EQ::Net::DynamicPacket out;
-	out.PutUInt32(0, (uint32_t)p.Length());
-	out.PutUInt8(4, (uint8_t)type);
-	if (p.Length() > 0) {
-		out.PutPacket(5, p);
-	}
-
-	m_connection->Write((const char*)out.Data(), out.Length());
+	m_batcher.WriteFrame(type, (const char*)p.Data(), p.Length());
 }
 
 void EQ::Net::ServertalkServerConnection::ProcessHandshake(EQ::Net::Packet &p)
@@ -301,6 +313,18 @@ void EQ::Net::ServertalkServerConnection::ProcessHandshake(EQ::Net::Packet &p)
 			return;
 		}
 
+		// newer clients follow the credentials with what they can receive, answer with ours
+		size_t capabilities_offset = m_identifier.length() + 1 + credentials.length() + 1;
+		if (p.Length() >= capabilities_offset + sizeof(uint32_t)) {
+			m_batcher.SetBatching(m_parent->m_batching);
+			m_batcher.SetCompressThreshold(m_parent->m_compress_threshold);
+			m_batcher.SetPeerCapabilities(p.GetUInt32(capabilities_offset));
+
+			EQ::Net::DynamicPacket capabilities;
+			capabilities.PutUInt32(0, ServertalkBatcher::Capabilities);
+			InternalSend(ServertalkCapabilities, capabilities);
+		}
+
 		m_parent->ConnectionIdentified(this);
 	}
 	catch (std::exception &ex) {
@@ -315,9 +339,12 @@ void EQ::Net::ServertalkServerConnection::ProcessMessage(EQ::Net::Packet &p)
 		auto length = p.GetUInt32(0);
 		auto opcode = p.GetUInt16(4);
 		if (length > 0) {
-			auto data = p.GetString(6, length);
-			size_t message_len = length;
-			EQ::Net::StaticPacket packet(&data[0], message_len);
+			if (p.Length() < 6 + (size_t)length) {
+				throw std::out_of_range("Message length exceeds the frame");
+			}
+
+			// a view into the read buffer, handlers don't keep the packet past the callback
+			EQ::Net::StaticPacket packet((char*)p.Data() + 6, length);
 
 			auto cb = m_message_callbacks.find(opcode);
 			if (cb != m_message_callbacks.end()) {
@@ -334,6 +361,17 @@ void EQ::Net::ServertalkServerConnection::ProcessMessage(EQ::Net::Packet &p)
 	}
 }
 
+void EQ::Net::ServertalkServerConnection::ProcessBatch(ServertalkPacketType type, EQ::Net::Packet &p)
+{
+	bool valid = ServertalkBatcher::Unpack(type, p, m_inflate_buffer, [this](EQ::Net::Packet &message) {
+		ProcessMessage(message);
+	});
+
+	if (!valid) {
+		LogError("Error parsing message batch from client");
+	}
+}
+
 void EQ::Net::ServertalkServerConnection::ProcessMessageOld(uint16_t opcode, EQ::Net::Packet &p)
 {
 	try {
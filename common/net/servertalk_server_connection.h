@@ -2,6 +2,7 @@
 
 #include "tcp_connection.h"
 #include "servertalk_common.h"
+#include "servertalk_batch.h"
 #include "packet.h"
 #include <vector>
 
@@ -24,6 +25,10 @@ namespace EQ
 			std::string GetIdentifier() const { return m_identifier; }
 			std::shared_ptr<EQ::Net::TCPConnection> Handle() { return m_connection; }
 			std::string GetUUID() const { return m_uuid; }
+
+			void SetCoalesce(uint16_t opcode, ServertalkBatcher::CoalesceKey key) { m_batcher.SetCoalesce(opcode, key); }
+			void Flush() { m_batcher.Flush(); }
+			const ServertalkBatcher &GetBatcher() const { return m_batcher; }
 		private:
 			void OnRead(TCPConnection* c, const unsigned char* data, size_t sz);
 			void ProcessReadBuffer();
@@ -34,6 +39,7 @@ namespace EQ
 			void ProcessHandshake(EQ::Net::Packet &p);
 			void ProcessMessage(EQ::Net::Packet &p);
 			void ProcessMessageOld(uint16_t opcode, EQ::Net::Packet &p);
+			void ProcessBatch(ServertalkPacketType type, EQ::Net::Packet &p);
 
 			std::shared_ptr<EQ::Net::TCPConnection> m_connection;
 			ServertalkServer *m_parent;
@@ -44,6 +50,8 @@ namespace EQ
 			std::string m_identifier;
 			std::string m_uuid;
 			bool m_legacy_mode;
+			ServertalkBatcher m_batcher;
+			std::vector<char> m_inflate_buffer;
 		};
 	}
 }
@@ -0,0 +1,124 @@
+#include "opcode_stats.h"
+
+OpcodeStats::Scope::Scope(OpcodeStats &stats, uint16 opcode, uint64 bytes_in)
+	: m_stats(stats.IsEnabled() ? &stats : nullptr),
+	m_opcode(opcode),
+	m_bytes_in(bytes_in)
+{
+	if (m_stats) {
+		m_start = Clock::now();
+	}
+}
+
+OpcodeStats::Scope::~Scope()
+{
+	if (m_stats) {
+		auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_start).count();
+		m_stats->RecordHandled(m_opcode, (uint64) elapsed, m_bytes_in);
+	}
+}
+
+OpcodeStats::OpcodeStats(uint32 window_seconds, uint32 buckets)
+	: m_enabled(true),
+	m_window_seconds(window_seconds),
+	m_current(0)
+{
+	if (buckets == 0) {
+		buckets = 1;
+	}
+
+	m_bucket_length = std::chrono::duration_cast<Clock::duration>(std::chrono::seconds(window_seconds)) / buckets;
+	m_buckets.resize(buckets);
+
+	auto now = Clock::now();
+	for (auto &bucket : m_buckets) {
+		bucket.start = now;
+	}
+}
+
+void OpcodeStats::RecordHandled(uint16 opcode, uint64 elapsed_ns, uint64 bytes_in)
+{
+	auto &counters = Current().opcodes[opcode];
+	counters.calls++;
+	counters.total_ns += elapsed_ns;
+	counters.bytes_in += bytes_in;
+	if (elapsed_ns > counters.max_ns) {
+		counters.max_ns = elapsed_ns;
+	}
+}
+
+void OpcodeStats::RecordSent(uint16 opcode, uint64 bytes_out)
+{
+	if (!m_enabled) {
+		return;
+	}
+
+	auto &counters = Current().opcodes[opcode];
+	counters.sent++;
+	counters.bytes_out += bytes_out;
+}
+
+void OpcodeStats::Reset()
+{
+	auto now = Clock::now();
+	for (auto &bucket : m_buckets) {
+		bucket.opcodes.clear();
+		bucket.start = now;
+	}
+}
+
+void OpcodeStats::GetWindow(std::vector<Entry> &into)
+{
+	// retire buckets that aged out even if nothing was recorded since
+	Current();
+
+	std::unordered_map<uint16, Counters> sum;
+	for (auto &bucket : m_buckets) {
+		for (auto &iter : bucket.opcodes) {
+			auto &total = sum[iter.first];
+			total.calls += iter.second.calls;
+			total.total_ns += iter.second.total_ns;
+			total.bytes_in += iter.second.bytes_in;
+			total.sent += iter.second.sent;
+			total.bytes_out += iter.second.bytes_out;
+			if (iter.second.max_ns > total.max_ns) {
+				total.max_ns = iter.second.max_ns;
+			}
+		}
+	}
+
+	into.reserve(into.size() + sum.size());
+	for (auto &iter : sum) {
+		Entry entry;
+		entry.opcode   = iter.first;
+		entry.counters = iter.second;
+		into.push_back(entry);
+	}
+}
+
+OpcodeStats::Bucket &OpcodeStats::Current()
+{
+	auto now = Clock::now();
+	auto *bucket = &m_buckets[m_current];
+	if (now - bucket->start < m_bucket_length) {
+		return *bucket;
+	}
+
+	// step forward one bucket per elapsed length, clearing as we go; a long idle stretch
+	// clears the whole ring at most once
+	size_t steps = 0;
+	while (now - bucket->start >= m_bucket_length && steps < m_buckets.size()) {
+		auto next_start = bucket->start + m_bucket_length;
+		m_current = (m_current + 1) % m_buckets.size();
+		bucket = &m_buckets[m_current];
+		bucket->opcodes.clear();
+		bucket->start = next_start;
+		steps++;
+	}
+
+	if (now - bucket->start >= m_bucket_length) {
+		bucket->start = now;
+	}
+
+	return *bucket;
+}
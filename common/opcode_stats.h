@@ -0,0 +1,85 @@
+#ifndef EQEMU_OPCODE_STATS_H
+#define EQEMU_OPCODE_STATS_H
+
+#include "types.h"
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Per opcode handler counters over a rolling window
+ *
+ * The window is split into buckets; the oldest bucket is dropped as time moves on, so a query
+ * covers between (buckets - 1) and buckets bucket lengths of traffic. Recording is a hash lookup
+ * and two clock reads per handled message, cheap enough to leave on
+ */
+class OpcodeStats {
+public:
+	typedef std::chrono::steady_clock Clock;
+
+	struct Counters {
+		uint64 calls     = 0;
+		uint64 total_ns  = 0;
+		uint64 max_ns    = 0;
+		uint64 bytes_in  = 0;
+		uint64 sent      = 0;
+		uint64 bytes_out = 0;
+	};
+
+	struct Entry {
+		uint16   opcode;
+		Counters counters;
+	};
+
+	/**
+	 * Times a handler from construction to destruction
+	 */
+	class Scope {
+	public:
+		Scope(OpcodeStats &stats, uint16 opcode, uint64 bytes_in);
+		~Scope();
+
+	private:
+		OpcodeStats       *m_stats;
+		uint16            m_opcode;
+		uint64            m_bytes_in;
+		Clock::time_point m_start;
+	};
+
+	/**
+	 * @param window_seconds
+	 * @param buckets
+	 */
+	OpcodeStats(uint32 window_seconds = 60, uint32 buckets = 6);
+
+	void SetEnabled(bool enabled) { m_enabled = enabled; }
+	bool IsEnabled() const { return m_enabled; }
+	uint32 GetWindowSeconds() const { return m_window_seconds; }
+
+	void RecordHandled(uint16 opcode, uint64 elapsed_ns, uint64 bytes_in);
+	void RecordSent(uint16 opcode, uint64 bytes_out);
+	void Reset();
+
+	/**
+	 * Counters summed over the window, one entry per opcode seen
+	 *
+	 * @param into
+	 */
+	void GetWindow(std::vector<Entry> &into);
+
+private:
+	struct Bucket {
+		Clock::time_point                      start;
+		std::unordered_map<uint16, Counters> opcodes;
+	};
+
+	Bucket &Current();
+
+	bool                m_enabled;
+	uint32              m_window_seconds;
+	Clock::duration     m_bucket_length;
+	std::vector<Bucket> m_buckets;
+	size_t              m_current;
+};
+
+#endif //EQEMU_OPCODE_STATS_H
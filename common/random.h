@@ -111,6 +111,16 @@ namespace EQ {
 			m_gen.seed(rd());
 		}
 
+		// fixed seed, for runs that need to be repeatable
+		void Reseed(uint32_t seed)
+		{
+			m_gen.seed(seed);
+#ifndef BIASED_INT_DIST
+			int_dist.reset();
+#endif
+			real_dist.reset();
+		}
+
 		Random()
 		{
 			Reseed();
@@ -14,6 +14,7 @@
 
 #include "../../database.h"
 #include "../../string_util.h"
+#include <ctime>
 
 class BaseLogsysCategoriesRepository {
 public:
@@ -23,6 +24,7 @@ public:
 		int         log_to_console;
 		int         log_to_file;
 		int         log_to_gmsay;
+		int         log_to_binary;
 	};
 
 	static std::string PrimaryKey()
@@ -38,6 +40,19 @@ public:
 			"log_to_console",
 			"log_to_file",
 			"log_to_gmsay",
+			"log_to_binary",
+		};
+	}
+
+	static std::vector<std::string> SelectColumns()
+	{
+		return {
+			"log_category_id",
+			"log_category_description",
+			"log_to_console",
+			"log_to_file",
+			"log_to_gmsay",
+			"log_to_binary",
 		};
 	}
 
@@ -46,6 +61,11 @@ public:
 		return std::string(implode(", ", Columns()));
 	}
 
+	static std::string SelectColumnsRaw()
+	{
+		return std::string(implode(", ", SelectColumns()));
+	}
+
 	static std::string TableName()
 	{
 		return std::string("logsys_categories");
@@ -55,7 +75,7 @@ public:
 	{
 		return fmt::format(
 			"SELECT {} FROM {}",
-			ColumnsRaw(),
+			SelectColumnsRaw(),
 			TableName()
 		);
 	}
@@ -78,6 +98,7 @@ public:
 		entry.log_to_console           = 0;
 		entry.log_to_file              = 0;
 		entry.log_to_gmsay             = 0;
+		entry.log_to_binary            = 0;
 
 		return entry;
 	}
@@ -118,6 +139,7 @@ public:
 			entry.log_to_console           = atoi(row[2]);
 			entry.log_to_file              = atoi(row[3]);
 			entry.log_to_gmsay             = atoi(row[4]);
+			entry.log_to_binary            = atoi(row[5]);
 
 			return entry;
 		}
@@ -156,6 +178,7 @@ public:
 		update_values.push_back(columns[2] + " = " + std::to_string(logsys_categories_entry.log_to_console));
 		update_values.push_back(columns[3] + " = " + std::to_string(logsys_categories_entry.log_to_file));
 		update_values.push_back(columns[4] + " = " + std::to_string(logsys_categories_entry.log_to_gmsay));
+		update_values.push_back(columns[5] + " = " + std::to_string(logsys_categories_entry.log_to_binary));
 
 		auto results = db.QueryDatabase(
 			fmt::format(
@@ -182,6 +205,7 @@ public:
 		insert_values.push_back(std::to_string(logsys_categories_entry.log_to_console));
 		insert_values.push_back(std::to_string(logsys_categories_entry.log_to_file));
 		insert_values.push_back(std::to_string(logsys_categories_entry.log_to_gmsay));
+		insert_values.push_back(std::to_string(logsys_categories_entry.log_to_binary));
 
 		auto results = db.QueryDatabase(
 			fmt::format(
@@ -216,6 +240,7 @@ public:
 			insert_values.push_back(std::to_string(logsys_categories_entry.log_to_console));
 			insert_values.push_back(std::to_string(logsys_categories_entry.log_to_file));
 			insert_values.push_back(std::to_string(logsys_categories_entry.log_to_gmsay));
+			insert_values.push_back(std::to_string(logsys_categories_entry.log_to_binary));
 
 			insert_chunks.push_back("(" + implode(",", insert_values) + ")");
 		}
@@ -254,6 +279,7 @@ public:
 			entry.log_to_console           = atoi(row[2]);
 			entry.log_to_file              = atoi(row[3]);
 			entry.log_to_gmsay             = atoi(row[4]);
+			entry.log_to_binary            = atoi(row[5]);
 
 			all_entries.push_back(entry);
 		}
@@ -283,6 +309,7 @@ public:
 			entry.log_to_console           = atoi(row[2]);
 			entry.log_to_file              = atoi(row[3]);
 			entry.log_to_gmsay             = atoi(row[4]);
+			entry.log_to_binary            = atoi(row[5]);
 
 			all_entries.push_back(entry);
 		}
@@ -272,6 +272,9 @@ RULE_INT (World, TellQueueSize, 20, "Maximum tell queue size")
 RULE_BOOL(World, StartZoneSameAsBindOnCreation, true, "Should the start zone always be the same location as your bind?")
 RULE_BOOL(World, EnforceCharacterLimitAtLogin, false, "Enforce the limit for characters that are online at login")
 RULE_BOOL(World, EnableDevTools, true, "Enable or Disable the Developer Tools globally (Most of the time you want this enabled)")
+RULE_INT(World, ClientDeltaSnapshotTicks, 12, "Number of client list ticks (5 seconds each) between full snapshots on the EQW::ClientDelta stream, 0 only sends snapshots on request")
+RULE_BOOL(World, ClientDeltaCompact, false, "Send EQW::ClientDelta rows as value arrays in the order of a fields header instead of keyed objects")
+RULE_INT(World, WhoResultCacheMS, 1000, "Milliseconds an identical /who all reply is reused for instead of searching the client list again, 0 disables")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(Zone)
@@ -297,6 +300,9 @@ RULE_INT(Zone, GlobalLootMultiplier, 1, "Sets Global Loot drop multiplier for da
 RULE_BOOL(Zone, KillProcessOnDynamicShutdown, true, "When process has booted a zone and has hit its zone shut down timer, it will hard kill the process to free memory back to the OS")
 RULE_INT(Zone, SecondsBeforeIdle, 60, "Seconds before IDLE_WHEN_EMPTY define kicks in")
 RULE_INT(Zone, SpawnEventMin, 3, "When strict is set in spawn_events, specifies the max EQ minutes into the trigger hour a spawn_event will fire. Going below 3 may cause the spawn_event to not fire.")
+RULE_BOOL(Zone, DirectZoneMessaging, false, "Zones connect to each other directly, with world brokering the addresses, and send group and raid updates without the hop through world")
+RULE_INT(Zone, DirectZoneMessagingPortOffset, 1000, "Direct zone connections are accepted on the zone port plus this offset")
+RULE_BOOL(Zone, OpcodeStatistics, true, "Track call counts, handler time and bytes per client and server opcode over a rolling minute, see #opcodestats")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(Map)
@@ -313,6 +319,10 @@ RULE_BOOL(Pathing, Find, true, "Enable pathing for FindPerson requests from the
 RULE_BOOL(Pathing, Fear, true, "Enable pathing for fear")
 RULE_REAL(Pathing, NavmeshStepSize, 100.0f, "Step size for the movement manager")
 RULE_REAL(Pathing, ShortMovementUpdateRange, 130.0f, "Range for short movement updates")
+RULE_BOOL(Pathing, MovementUpdateInterest, true, "Queue NPC movement updates per client, coalesce them by NPC and send them by distance band under a per tick budget")
+RULE_INT(Pathing, MovementUpdateBudget, 40, "Most queued NPC movement updates sent to one client per tick, updates from NPCs targeting or hating the client are always sent")
+RULE_INT(Pathing, MediumMovementUpdateInterval, 500, "Minimum milliseconds between movement updates to one client for an NPC in the medium range band")
+RULE_INT(Pathing, LongMovementUpdateInterval, 2000, "Minimum milliseconds between movement updates to one client for an NPC beyond the medium range band")
 RULE_INT(Pathing, MaxNavmeshNodes, 4092, "Maximum navmesh nodes in a traversable path")
 RULE_CATEGORY_END()
 
@@ -408,6 +418,7 @@ RULE_INT(Spells, ClericInnateHealFocus, 5, "Clerics on live get a 5 pct innate h
 RULE_BOOL(Spells, DOTsScaleWithSpellDmg, false, "Allow SpellDmg stat to affect DoT spells")
 RULE_BOOL(Spells, HOTsScaleWithHealAmt, false, "Allow HealAmt stat to affect HoT spells")
 RULE_BOOL(Spells, CompoundLifetapHeals, true, "True: Lifetap heals calculate damage bonuses and then heal bonuses.  False:  Lifetaps heal using the amount damaged to mob.")
+RULE_BOOL(Spells, UseBuffStackIndex, true, "Only run full stacking checks against worn buffs that share an effect slot with the new spell. Turn off if mod_spell_stack is customized to act on unrelated spells")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(Combat)
@@ -713,6 +724,8 @@ RULE_INT(Network, ResendDelayMinMS, 300, "Minimum timespan between two send retr
 RULE_INT(Network, ResendDelayMaxMS, 5000, "Maximum timespan between two send retries (milliseconds)")
 RULE_REAL(Network, ClientDataRate, 0.0, "KB / sec, 0.0 disabled")
 RULE_BOOL(Network, CompressZoneStream, true, "Setting whether the zone stream should be compressed for transmission")
+RULE_BOOL(Network, ServertalkBatching, true, "Pack the server to server messages sent in one pass of the event loop into a single write, peers that predate batching are sent one message at a time. Covers the links world, zone and ucs open, queryserv and the loginserver never batch what they send")
+RULE_INT(Network, ServertalkCompressThreshold, 0, "Batches of server to server messages at least this many bytes are sent deflated, 0 disables")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(QueryServ)
@@ -772,6 +785,14 @@ RULE_CATEGORY_END()
 RULE_CATEGORY(Logging)
 RULE_BOOL(Logging, PrintFileFunctionAndLine, false, "Ex: [World Server] [net.cpp::main:309] Loading variables...")
 RULE_BOOL(Logging, WorldGMSayLogging, true, "Relay worldserver logging to zone processes via GM say output")
+RULE_BOOL(Logging, AsyncWrites, true, "Queue console and file log output to a background writer thread instead of writing it on the logging thread")
+RULE_CATEGORY_END()
+
+RULE_CATEGORY(Lua)
+RULE_BOOL(Lua, ProfilerEnabled, false, "Starts the lua quest profiler when quests load, can be toggled at runtime with #luaprofile")
+RULE_INT(Lua, ProfilerSampleInterval, 1000, "Lua instructions executed between profiler samples")
+RULE_INT(Lua, InstructionBudget, 0, "Lua instructions a single quest event may execute before it is aborted [0 = Unlimited]")
+RULE_BOOL(Lua, UseBytecodeCache, false, "Compiled quest scripts are cached in the shared memory directory and reused by every zone until the source changes")
 RULE_CATEGORY_END()
 
 RULE_CATEGORY(HotReload)
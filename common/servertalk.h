@@ -227,6 +227,8 @@
 #define ServerOP_HotReloadQuests 0x4011
 #define ServerOP_UpdateSchedulerEvents 0x4012
 #define ServerOP_ReloadContentFlags 0x4013
+#define ServerOP_ZoneMeshListen 0x4014
+#define ServerOP_ZoneMeshPeers 0x4015
 
 #define ServerOP_CZDialogueWindow 0x4500
 #define ServerOP_CZLDoNUpdate 0x4501
@@ -714,6 +716,22 @@ struct ServerConnectInfo {
 	uint32 process_id;
 };
 
+struct ServerZoneMeshListen_Struct {
+	uint16 port;
+};
+
+struct ServerZoneMeshPeer_Struct {
+	uint32 zone_server_id;
+	char   address[64];
+	uint16 port; // 0 when the zone does not accept direct connections
+};
+
+struct ServerZoneMeshPeers_Struct {
+	uint32                    self_id; // zone server id of the receiving zone
+	uint32                    count;
+	ServerZoneMeshPeer_Struct peers[0];
+};
+
 struct ServerGMGoto_Struct {
 	char	myname[64];
 	char	gotoname[64];
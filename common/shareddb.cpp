@@ -1703,8 +1703,11 @@ int SharedDatabase::GetMaxSpellID() {
 	return atoi(row[0]);
 }
 
-bool SharedDatabase::LoadSpells(const std::string &prefix, int32 *records, const SPDat_Spell_Struct **sp) {
+bool SharedDatabase::LoadSpells(const std::string &prefix, int32 *records, const SPDat_Spell_Struct **sp, const SpellTraits **traits) {
 	spells_mmf.reset(nullptr);
+	if (traits) {
+		*traits = nullptr;
+	}
 
 	try {
 		auto Config = EQEmuConfig::get();
@@ -1716,6 +1719,15 @@ bool SharedDatabase::LoadSpells(const std::string &prefix, int32 *records, const
 		LogInfo("[Shared Memory] Attempting to load file [{}]", file_name);
 		*records = *reinterpret_cast<uint32*>(spells_mmf->Get());
 		*sp = reinterpret_cast<const SPDat_Spell_Struct*>((char*)spells_mmf->Get() + 4);
+		if (traits) {
+			// a segment written before traits existed just goes without them
+			if (spells_mmf->Size() >= GetSpellsSegmentSize(*records)) {
+				*traits = reinterpret_cast<const SpellTraits*>((char*)spells_mmf->Get() + GetSpellTraitsOffset(*records));
+			}
+			else {
+				LogInfo("[Shared Memory] Spells segment has no trait records, run shared_memory to rebuild it");
+			}
+		}
 		mutex.Unlock();
 	}
 	catch(std::exception& ex) {
@@ -1900,6 +1912,11 @@ void SharedDatabase::LoadSpells(void *data, int max_spells) {
     }
 
     LoadDamageShieldTypes(sp, max_spells);
+
+	SpellTraits *traits = reinterpret_cast<SpellTraits*>((char*)data + GetSpellTraitsOffset(max_spells));
+	for (int i = 0; i < max_spells; ++i) {
+		BuildSpellTraits(sp[i], traits[i]);
+	}
 }
 
 int SharedDatabase::GetMaxBaseDataLevel() {
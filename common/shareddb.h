@@ -178,7 +178,7 @@ public:
 	 * spells
 	 */
 	int GetMaxSpellID();
-	bool LoadSpells(const std::string &prefix, int32 *records, const SPDat_Spell_Struct **sp);
+	bool LoadSpells(const std::string &prefix, int32 *records, const SPDat_Spell_Struct **sp, const SpellTraits **traits = nullptr);
 	void LoadSpells(void *data, int max_spells);
 	void LoadDamageShieldTypes(SPDat_Spell_Struct *sp, int32 iMaxSpellID);
 
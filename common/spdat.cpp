@@ -102,13 +102,16 @@ bool IsSacrificeSpell(uint16 spell_id)
 bool IsLifetapSpell(uint16 spell_id)
 {
 	// Ancient Lifebane: 2115
-	if (IsValidSpell(spell_id) &&
-			(spells[spell_id].target_type == ST_Tap ||
-			 spells[spell_id].target_type == ST_TargetAETap ||
-			 spell_id == 2115))
-		return true;
+	if (spell_id == 2115)
+		return IsValidSpell(spell_id);
 
-	return false;
+	if (!IsValidSpell(spell_id))
+		return false;
+
+	if (spell_traits)
+		return spell_traits[spell_id].Has(SpellTraits::Lifetap);
+
+	return IsLifetapSpellData(spells[spell_id]);
 }
 
 bool IsMezSpell(uint16 spell_id)
@@ -123,13 +126,10 @@ bool IsStunSpell(uint16 spell_id)
 
 bool IsSummonSpell(uint16 spellid)
 {
-	for (int o = 0; o < EFFECT_COUNT; o++) {
-		uint32 tid = spells[spellid].effect_id[o];
-		if (tid == SE_SummonPet || tid == SE_SummonItem || tid == SE_SummonPC)
-			return true;
-	}
+	if (spell_traits && IsValidSpell(spellid))
+		return spell_traits[spellid].Has(SpellTraits::Summon);
 
-	return false;
+	return IsSummonSpellData(spells[spellid]);
 }
 
 bool IsEvacSpell(uint16 spellid)
@@ -139,15 +139,10 @@ bool IsEvacSpell(uint16 spellid)
 
 bool IsDamageSpell(uint16 spellid)
 {
-	for (int o = 0; o < EFFECT_COUNT; o++) {
-		uint32 tid = spells[spellid].effect_id[o];
-		if ((tid == SE_CurrentHPOnce || tid == SE_CurrentHP) &&
-				spells[spellid].target_type != ST_Tap && spells[spellid].buff_duration < 1 &&
-				spells[spellid].base_value[o] < 0)
-			return true;
-	}
+	if (spell_traits && IsValidSpell(spellid))
+		return spell_traits[spellid].Has(SpellTraits::Damage);
 
-	return false;
+	return IsDamageSpellData(spells[spellid]);
 }
 
 
@@ -158,43 +153,29 @@ bool IsFearSpell(uint16 spell_id)
 
 bool IsCureSpell(uint16 spell_id)
 {
-	const SPDat_Spell_Struct &sp = spells[spell_id];
-
-	bool CureEffect = false;
-
-	for(int i = 0; i < EFFECT_COUNT; i++){
-		if (sp.effect_id[i] == SE_DiseaseCounter || sp.effect_id[i] == SE_PoisonCounter
-			|| sp.effect_id[i] == SE_CurseCounter || sp.effect_id[i] == SE_CorruptionCounter)
-			CureEffect = true;
-	}
+	if (!IsValidSpell(spell_id))
+		return false;
 
-	if (CureEffect && IsBeneficialSpell(spell_id))
-		return true;
+	if (spell_traits)
+		return spell_traits[spell_id].Has(SpellTraits::Cure);
 
-	return false;
+	return IsCureSpellData(spells[spell_id]);
 }
 
 bool IsSlowSpell(uint16 spell_id)
 {
-	const SPDat_Spell_Struct &sp = spells[spell_id];
-
-	for(int i = 0; i < EFFECT_COUNT; i++)
-		if ((sp.effect_id[i] == SE_AttackSpeed && sp.base_value[i] < 100) ||
-				(sp.effect_id[i] == SE_AttackSpeed4))
-			return true;
+	if (spell_traits && IsValidSpell(spell_id))
+		return spell_traits[spell_id].Has(SpellTraits::Slow);
 
-	return false;
+	return IsSlowSpellData(spells[spell_id]);
 }
 
 bool IsHasteSpell(uint16 spell_id)
 {
-	const SPDat_Spell_Struct &sp = spells[spell_id];
-
-	for(int i = 0; i < EFFECT_COUNT; i++)
-		if(sp.effect_id[i] == SE_AttackSpeed)
-			return (sp.base_value[i] < 100);
+	if (spell_traits && IsValidSpell(spell_id))
+		return spell_traits[spell_id].Has(SpellTraits::Haste);
 
-	return false;
+	return IsHasteSpellData(spells[spell_id]);
 }
 
 bool IsHarmonySpell(uint16 spell_id)
@@ -218,41 +199,10 @@ bool IsBeneficialSpell(uint16 spell_id)
 	if (!IsValidSpell(spell_id))
 		return false;
 
-	// You'd think just checking goodEffect flag would be enough?
-	if (spells[spell_id].good_effect == 1) {
-		// If the target type is ST_Self or ST_Pet and is a SE_CancleMagic spell
-		// it is not Beneficial
-		SpellTargetType tt = spells[spell_id].target_type;
-		if (tt != ST_Self && tt != ST_Pet &&
-				IsEffectInSpell(spell_id, SE_CancelMagic))
-			return false;
-
-		// When our targettype is ST_Target, ST_AETarget, ST_Aniaml, ST_Undead, or ST_Pet
-		// We need to check more things!
-		if (tt == ST_Target || tt == ST_AETarget || tt == ST_Animal ||
-				tt == ST_Undead || tt == ST_Pet) {
-			uint16 sai = spells[spell_id].spell_affect_index;
-
-			// If the resisttype is magic and SpellAffectIndex is Calm/memblur/dispell sight
-			// it's not beneficial
-			if (spells[spell_id].resist_type == RESIST_MAGIC) {
-				// checking these SAI cause issues with the rng defensive proc line
-				// So I guess instead of fixing it for real, just a quick hack :P
-				if (spells[spell_id].effect_id[0] != SE_DefensiveProc &&
-				    (sai == SAI_Calm || sai == SAI_Dispell_Sight || sai == SAI_Memory_Blur ||
-				     sai == SAI_Calm_Song))
-					return false;
-			} else {
-				// If the resisttype is not magic and spell is Bind Sight or Cast Sight
-				// It's not beneficial
-				if ((sai == SAI_Calm && IsEffectInSpell(spell_id, SE_Harmony)) || (sai == SAI_Calm_Song && IsEffectInSpell(spell_id, SE_BindSight)) || (sai == SAI_Dispell_Sight && spells[spell_id].skill == 18 && !IsEffectInSpell(spell_id, SE_VoiceGraft)))
-					return false;
-			}
-		}
-	}
+	if (spell_traits)
+		return spell_traits[spell_id].Has(SpellTraits::Beneficial);
 
-	// And finally, if goodEffect is not 0 or if it's a group spell it's beneficial
-	return spells[spell_id].good_effect != 0 || IsGroupSpell(spell_id);
+	return IsBeneficialSpellData(spells[spell_id]);
 }
 
 bool IsDetrimentalSpell(uint16 spell_id)
@@ -262,14 +212,13 @@ bool IsDetrimentalSpell(uint16 spell_id)
 
 bool IsInvisSpell(uint16 spell_id)
 {
-	if (IsEffectInSpell(spell_id, SE_Invisibility) ||
-		IsEffectInSpell(spell_id, SE_Invisibility2) ||
-		IsEffectInSpell(spell_id, SE_InvisVsUndead) ||
-		IsEffectInSpell(spell_id, SE_InvisVsUndead2) ||
-		IsEffectInSpell(spell_id, SE_InvisVsAnimals)) {
-		return true;
-	}
-	return false;
+	if (!IsValidSpell(spell_id))
+		return false;
+
+	if (spell_traits)
+		return spell_traits[spell_id].Has(SpellTraits::Invis);
+
+	return IsInvisSpellData(spells[spell_id]);
 }
 
 bool IsInvulnerabilitySpell(uint16 spell_id)
@@ -373,20 +322,13 @@ bool IsAEDurationSpell(uint16 spell_id)
 
 bool IsPureNukeSpell(uint16 spell_id)
 {
-	int i, effect_count = 0;
-
 	if (!IsValidSpell(spell_id))
 		return false;
 
-	for (i = 0; i < EFFECT_COUNT; i++)
-		if (!IsBlankSpellEffect(spell_id, i))
-			effect_count++;
-
-	if (effect_count == 1 && IsEffectInSpell(spell_id, SE_CurrentHP) &&
-			spells[spell_id].buff_duration == 0 && IsDamageSpell(spell_id))
-		return true;
+	if (spell_traits)
+		return spell_traits[spell_id].Has(SpellTraits::PureNuke);
 
-	return false;
+	return IsPureNukeSpellData(spells[spell_id]);
 }
 
 bool IsAENukeSpell(uint16 spell_id)
@@ -418,24 +360,10 @@ bool IsAERainNukeSpell(uint16 spell_id)
 
 bool IsPartialCapableSpell(uint16 spell_id)
 {
-	if (spells[spell_id].no_partial_resist)
-		return false;
-
-	// spell uses 600 (partial) scale if first effect is damage, else it uses 200 scale.
-	// this includes DoTs.  no_partial_resist excludes spells like necro snares
-	for (int o = 0; o < EFFECT_COUNT; o++) {
-		auto tid = spells[spell_id].effect_id[o];
-
-		if (IsBlankSpellEffect(spell_id, o))
-			continue;
-
-		if ((tid == SE_CurrentHPOnce || tid == SE_CurrentHP) && spells[spell_id].base_value[o] < 0)
-			return true;
-
-		return false;
-	}
+	if (spell_traits && IsValidSpell(spell_id))
+		return spell_traits[spell_id].Has(SpellTraits::PartialCapable);
 
-	return false;
+	return IsPartialCapableSpellData(spells[spell_id]);
 }
 
 bool IsResistableSpell(uint16 spell_id)
@@ -486,6 +414,9 @@ bool IsEffectInSpell(uint16 spellid, int effect)
 	if (!IsValidSpell(spellid))
 		return false;
 
+	if (spell_traits && effect >= 0 && effect < SpellTraits::EffectBits)
+		return spell_traits[spellid].HasEffect(effect);
+
 	for (j = 0; j < EFFECT_COUNT; j++)
 		if (spells[spellid].effect_id[j] == effect)
 			return true;
@@ -498,19 +429,7 @@ bool IsEffectInSpell(uint16 spellid, int effect)
 // the blanks
 bool IsBlankSpellEffect(uint16 spellid, int effect_index)
 {
-	int effect, base_value, formula;
-
-	effect = spells[spellid].effect_id[effect_index];
-	base_value = spells[spellid].base_value[effect_index];
-	formula = spells[spellid].formula[effect_index];
-
-	// SE_CHA is "spacer"
-	// SE_Stacking* are also considered blank where this is used
-	if (effect == SE_Blank || (effect == SE_CHA && base_value == 0 && formula == 100) ||
-			effect == SE_StackingCommand_Block || effect == SE_StackingCommand_Overwrite)
-		return true;
-
-	return false;
+	return IsBlankSpellEffectData(spells[spellid], effect_index);
 }
 
 // checks some things about a spell id, to see if we can proceed
@@ -560,6 +479,11 @@ int GetSpellEffectIndex(uint16 spell_id, int effect)
 	if (!IsValidSpell(spell_id))
 		return -1;
 
+	// most lookups are for effects the spell doesn't have
+	if (spell_traits && effect >= 0 && effect < SpellTraits::EffectBits &&
+			!spell_traits[spell_id].HasEffect(effect))
+		return -1;
+
 	for (i = 0; i < EFFECT_COUNT; i++)
 		if (spells[spell_id].effect_id[i] == effect)
 			return i;
@@ -736,33 +660,35 @@ bool IsResurrectionEffects(uint16 spell_id)
 
 bool IsRuneSpell(uint16 spell_id)
 {
-	if (IsValidSpell(spell_id))
-		for (int i = 0; i < EFFECT_COUNT; i++)
-			if (spells[spell_id].effect_id[i] == SE_Rune)
-				return true;
+	if (!IsValidSpell(spell_id))
+		return false;
 
-	return false;
+	if (spell_traits)
+		return spell_traits[spell_id].Has(SpellTraits::Rune);
+
+	return IsRuneSpellData(spells[spell_id]);
 }
 
 bool IsMagicRuneSpell(uint16 spell_id)
 {
-	if(IsValidSpell(spell_id))
-		for(int i = 0; i < EFFECT_COUNT; i++)
-			if(spells[spell_id].effect_id[i] == SE_AbsorbMagicAtt)
-				return true;
+	if (!IsValidSpell(spell_id))
+		return false;
 
-	return false;
+	if (spell_traits)
+		return spell_traits[spell_id].Has(SpellTraits::MagicRune);
+
+	return IsMagicRuneSpellData(spells[spell_id]);
 }
 
 bool IsManaTapSpell(uint16 spell_id)
 {
-	if (IsValidSpell(spell_id))
-		for (int i = 0; i < EFFECT_COUNT; i++)
-			if (spells[spell_id].effect_id[i] == SE_CurrentMana &&
-					spells[spell_id].target_type == ST_Tap)
-				return true;
+	if (!IsValidSpell(spell_id))
+		return false;
 
-	return false;
+	if (spell_traits)
+		return spell_traits[spell_id].Has(SpellTraits::ManaTap);
+
+	return IsManaTapSpellData(spells[spell_id]);
 }
 
 bool IsAllianceSpellLine(uint16 spell_id)
@@ -917,19 +843,27 @@ int32 GetSpellTargetType(uint16 spell_id)
 
 bool IsHealOverTimeSpell(uint16 spell_id)
 {
-	if (IsEffectInSpell(spell_id, SE_HealOverTime) && !IsGroupSpell(spell_id))
-		return true;
+	if (!IsValidSpell(spell_id))
+		return false;
 
-	return false;
+	if (spell_traits)
+		return spell_traits[spell_id].Has(SpellTraits::HealOverTime);
+
+	return IsHealOverTimeSpellData(spells[spell_id]);
 }
 
 bool IsCompleteHealSpell(uint16 spell_id)
 {
-	if (spell_id == 13 || IsEffectInSpell(spell_id, SE_CompleteHeal) ||
-			(IsPercentalHealSpell(spell_id) && !IsGroupSpell(spell_id)))
+	if (spell_id == 13)
 		return true;
 
-	return false;
+	if (!IsValidSpell(spell_id))
+		return false;
+
+	if (spell_traits)
+		return spell_traits[spell_id].Has(SpellTraits::CompleteHeal);
+
+	return IsCompleteHealSpellData(spells[spell_id]);
 }
 
 bool IsFastHealSpell(uint16 spell_id)
@@ -1026,10 +960,13 @@ bool IsSelfConversionSpell(uint16 spell_id)
 // returns true for both detrimental and beneficial buffs
 bool IsBuffSpell(uint16 spell_id)
 {
-	if (IsValidSpell(spell_id) && (spells[spell_id].buff_duration || spells[spell_id].buff_duration_formula))
-		return true;
+	if (!IsValidSpell(spell_id))
+		return false;
 
-	return false;
+	if (spell_traits)
+		return spell_traits[spell_id].Has(SpellTraits::Buff);
+
+	return IsBuffSpellData(spells[spell_id]);
 }
 
 bool IsPersistDeathSpell(uint16 spell_id)
@@ -1059,15 +996,10 @@ uint32 GetMorphTrigger(uint32 spell_id)
 
 bool IsCastonFadeDurationSpell(uint16 spell_id)
 {
-	for (int i = 0; i < EFFECT_COUNT; ++i) {
-		if (spells[spell_id].effect_id[i] == SE_CastOnFadeEffect
-			|| spells[spell_id].effect_id[i] == SE_CastOnFadeEffectNPC
-			|| spells[spell_id].effect_id[i] == SE_CastOnFadeEffectAlways){
+	if (spell_traits && IsValidSpell(spell_id))
+		return spell_traits[spell_id].Has(SpellTraits::CastOnFadeDuration);
 
-		return true;
-		}
-	}
-	return false;
+	return IsCastonFadeDurationSpellData(spells[spell_id]);
 }
 
 bool IsPowerDistModSpell(uint16 spell_id)
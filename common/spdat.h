@@ -1420,7 +1420,78 @@ struct SPDat_Spell_Struct
 			uint8 damage_shield_type; // This field does not exist in spells_us.txt
 };
 
+/**
+ * Facts about a spell that are otherwise rediscovered on every call by scanning its effect slots
+ *
+ * Built once per spell by the shared memory loader and stored in the spells segment right after
+ * the spell records, in the same order
+ */
+struct SpellTraits {
+	static const int EffectBits = 576;
+
+	enum : uint32 {
+		Beneficial         = 1 << 0,
+		Buff               = 1 << 1,
+		Lifetap            = 1 << 2,
+		Damage             = 1 << 3,
+		PureNuke           = 1 << 4,
+		PartialCapable     = 1 << 5,
+		Summon             = 1 << 6,
+		Cure               = 1 << 7,
+		Slow               = 1 << 8,
+		Haste              = 1 << 9,
+		Invis              = 1 << 10,
+		Rune               = 1 << 11,
+		MagicRune          = 1 << 12,
+		ManaTap            = 1 << 13,
+		CompleteHeal       = 1 << 14,
+		HealOverTime       = 1 << 15,
+		CastOnFadeDuration = 1 << 16
+	};
+
+	uint64 effects[EffectBits / 64];
+	uint32 flags;
+
+	// only meaningful for 0 <= effect < EffectBits
+	bool HasEffect(int effect) const { return (effects[effect >> 6] >> (effect & 63)) & 1; }
+	bool Has(uint32 flag) const { return (flags & flag) != 0; }
+};
+
+// the spells segment is [uint32 records][SPDat_Spell_Struct x records][SpellTraits x records]
+inline size_t GetSpellTraitsOffset(int32 records)
+{
+	return (sizeof(uint32) + records * sizeof(SPDat_Spell_Struct) + 7) & ~(size_t) 7;
+}
+
+inline size_t GetSpellsSegmentSize(int32 records)
+{
+	return GetSpellTraitsOffset(records) + records * sizeof(SpellTraits);
+}
+
+void BuildSpellTraits(const SPDat_Spell_Struct &spell, SpellTraits &traits);
+
+// the record based classifiers the Is*Spell predicates fall back to when the traits aren't loaded
+bool IsBeneficialSpellData(const SPDat_Spell_Struct &spell);
+bool IsBlankSpellEffectData(const SPDat_Spell_Struct &spell, int effect_index);
+bool IsBuffSpellData(const SPDat_Spell_Struct &spell);
+bool IsLifetapSpellData(const SPDat_Spell_Struct &spell);
+bool IsDamageSpellData(const SPDat_Spell_Struct &spell);
+bool IsPureNukeSpellData(const SPDat_Spell_Struct &spell);
+bool IsPartialCapableSpellData(const SPDat_Spell_Struct &spell);
+bool IsSummonSpellData(const SPDat_Spell_Struct &spell);
+bool IsCureSpellData(const SPDat_Spell_Struct &spell);
+bool IsSlowSpellData(const SPDat_Spell_Struct &spell);
+bool IsHasteSpellData(const SPDat_Spell_Struct &spell);
+bool IsInvisSpellData(const SPDat_Spell_Struct &spell);
+bool IsRuneSpellData(const SPDat_Spell_Struct &spell);
+bool IsMagicRuneSpellData(const SPDat_Spell_Struct &spell);
+bool IsManaTapSpellData(const SPDat_Spell_Struct &spell);
+bool IsCompleteHealSpellData(const SPDat_Spell_Struct &spell);
+bool IsHealOverTimeSpellData(const SPDat_Spell_Struct &spell);
+bool IsCastonFadeDurationSpellData(const SPDat_Spell_Struct &spell);
+
 extern const SPDat_Spell_Struct* spells;
+extern const SpellTraits* spell_traits;
 extern int32 SPDAT_RECORDS;
 
 bool IsTargetableAESpell(uint16 spell_id);
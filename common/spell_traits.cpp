@@ -0,0 +1,271 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2021 EQEMu Development Team (http://eqemu.org)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include "spdat.h"
+#include <string.h>
+
+// nothing in here may touch the spells / SPDAT_RECORDS globals, shared_memory builds the traits
+// without them
+
+static bool SpellDataHasEffect(const SPDat_Spell_Struct &spell, int effect)
+{
+	for (int i = 0; i < EFFECT_COUNT; i++) {
+		if (spell.effect_id[i] == effect) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool SpellDataIsGroup(const SPDat_Spell_Struct &spell)
+{
+	return spell.target_type == ST_AEBard ||
+		spell.target_type == ST_Group ||
+		spell.target_type == ST_GroupTeleport;
+}
+
+bool IsBeneficialSpellData(const SPDat_Spell_Struct &spell)
+{
+	// You'd think just checking goodEffect flag would be enough?
+	if (spell.good_effect == 1) {
+		// If the target type is ST_Self or ST_Pet and is a SE_CancleMagic spell
+		// it is not Beneficial
+		SpellTargetType tt = spell.target_type;
+		if (tt != ST_Self && tt != ST_Pet &&
+				SpellDataHasEffect(spell, SE_CancelMagic))
+			return false;
+
+		// When our targettype is ST_Target, ST_AETarget, ST_Aniaml, ST_Undead, or ST_Pet
+		// We need to check more things!
+		if (tt == ST_Target || tt == ST_AETarget || tt == ST_Animal ||
+				tt == ST_Undead || tt == ST_Pet) {
+			uint16 sai = spell.spell_affect_index;
+
+			// If the resisttype is magic and SpellAffectIndex is Calm/memblur/dispell sight
+			// it's not beneficial
+			if (spell.resist_type == RESIST_MAGIC) {
+				// checking these SAI cause issues with the rng defensive proc line
+				// So I guess instead of fixing it for real, just a quick hack :P
+				if (spell.effect_id[0] != SE_DefensiveProc &&
+				    (sai == SAI_Calm || sai == SAI_Dispell_Sight || sai == SAI_Memory_Blur ||
+				     sai == SAI_Calm_Song))
+					return false;
+			} else {
+				// If the resisttype is not magic and spell is Bind Sight or Cast Sight
+				// It's not beneficial
+				if ((sai == SAI_Calm && SpellDataHasEffect(spell, SE_Harmony)) || (sai == SAI_Calm_Song && SpellDataHasEffect(spell, SE_BindSight)) || (sai == SAI_Dispell_Sight && spell.skill == 18 && !SpellDataHasEffect(spell, SE_VoiceGraft)))
+					return false;
+			}
+		}
+	}
+
+	// And finally, if goodEffect is not 0 or if it's a group spell it's beneficial
+	return spell.good_effect != 0 ||
+		spell.target_type == ST_AEBard ||
+		spell.target_type == ST_Group ||
+		spell.target_type == ST_GroupTeleport;
+}
+
+bool IsBlankSpellEffectData(const SPDat_Spell_Struct &spell, int effect_index)
+{
+	int effect     = spell.effect_id[effect_index];
+	int base_value = spell.base_value[effect_index];
+	int formula    = spell.formula[effect_index];
+
+	// SE_CHA is "spacer"
+	// SE_Stacking* are also considered blank where this is used
+	return effect == SE_Blank || (effect == SE_CHA && base_value == 0 && formula == 100) ||
+		effect == SE_StackingCommand_Block || effect == SE_StackingCommand_Overwrite;
+}
+
+// returns true for both detrimental and beneficial buffs
+bool IsBuffSpellData(const SPDat_Spell_Struct &spell)
+{
+	return spell.buff_duration || spell.buff_duration_formula;
+}
+
+// Ancient Lifebane (2115) is matched by id in IsLifetapSpell
+bool IsLifetapSpellData(const SPDat_Spell_Struct &spell)
+{
+	return spell.target_type == ST_Tap || spell.target_type == ST_TargetAETap;
+}
+
+bool IsDamageSpellData(const SPDat_Spell_Struct &spell)
+{
+	for (int o = 0; o < EFFECT_COUNT; o++) {
+		int tid = spell.effect_id[o];
+		if ((tid == SE_CurrentHPOnce || tid == SE_CurrentHP) &&
+				spell.target_type != ST_Tap && spell.buff_duration < 1 &&
+				spell.base_value[o] < 0)
+			return true;
+	}
+
+	return false;
+}
+
+bool IsPureNukeSpellData(const SPDat_Spell_Struct &spell)
+{
+	int effect_count = 0;
+
+	for (int i = 0; i < EFFECT_COUNT; i++)
+		if (!IsBlankSpellEffectData(spell, i))
+			effect_count++;
+
+	return effect_count == 1 && SpellDataHasEffect(spell, SE_CurrentHP) &&
+		spell.buff_duration == 0 && IsDamageSpellData(spell);
+}
+
+bool IsPartialCapableSpellData(const SPDat_Spell_Struct &spell)
+{
+	if (spell.no_partial_resist)
+		return false;
+
+	// spell uses 600 (partial) scale if first effect is damage, else it uses 200 scale.
+	// this includes DoTs.  no_partial_resist excludes spells like necro snares
+	for (int o = 0; o < EFFECT_COUNT; o++) {
+		auto tid = spell.effect_id[o];
+
+		if (IsBlankSpellEffectData(spell, o))
+			continue;
+
+		return (tid == SE_CurrentHPOnce || tid == SE_CurrentHP) && spell.base_value[o] < 0;
+	}
+
+	return false;
+}
+
+bool IsSummonSpellData(const SPDat_Spell_Struct &spell)
+{
+	return SpellDataHasEffect(spell, SE_SummonPet) ||
+		SpellDataHasEffect(spell, SE_SummonItem) ||
+		SpellDataHasEffect(spell, SE_SummonPC);
+}
+
+bool IsCureSpellData(const SPDat_Spell_Struct &spell)
+{
+	bool cure_effect = SpellDataHasEffect(spell, SE_DiseaseCounter) ||
+		SpellDataHasEffect(spell, SE_PoisonCounter) ||
+		SpellDataHasEffect(spell, SE_CurseCounter) ||
+		SpellDataHasEffect(spell, SE_CorruptionCounter);
+
+	return cure_effect && IsBeneficialSpellData(spell);
+}
+
+bool IsSlowSpellData(const SPDat_Spell_Struct &spell)
+{
+	for (int i = 0; i < EFFECT_COUNT; i++)
+		if ((spell.effect_id[i] == SE_AttackSpeed && spell.base_value[i] < 100) ||
+				(spell.effect_id[i] == SE_AttackSpeed4))
+			return true;
+
+	return false;
+}
+
+bool IsHasteSpellData(const SPDat_Spell_Struct &spell)
+{
+	for (int i = 0; i < EFFECT_COUNT; i++)
+		if (spell.effect_id[i] == SE_AttackSpeed)
+			return (spell.base_value[i] < 100);
+
+	return false;
+}
+
+bool IsInvisSpellData(const SPDat_Spell_Struct &spell)
+{
+	return SpellDataHasEffect(spell, SE_Invisibility) ||
+		SpellDataHasEffect(spell, SE_Invisibility2) ||
+		SpellDataHasEffect(spell, SE_InvisVsUndead) ||
+		SpellDataHasEffect(spell, SE_InvisVsUndead2) ||
+		SpellDataHasEffect(spell, SE_InvisVsAnimals);
+}
+
+bool IsRuneSpellData(const SPDat_Spell_Struct &spell)
+{
+	return SpellDataHasEffect(spell, SE_Rune);
+}
+
+bool IsMagicRuneSpellData(const SPDat_Spell_Struct &spell)
+{
+	return SpellDataHasEffect(spell, SE_AbsorbMagicAtt);
+}
+
+bool IsManaTapSpellData(const SPDat_Spell_Struct &spell)
+{
+	return spell.target_type == ST_Tap && SpellDataHasEffect(spell, SE_CurrentMana);
+}
+
+// Complete Heal (13) is matched by id in IsCompleteHealSpell
+bool IsCompleteHealSpellData(const SPDat_Spell_Struct &spell)
+{
+	return SpellDataHasEffect(spell, SE_CompleteHeal) ||
+		(SpellDataHasEffect(spell, SE_PercentalHeal) && !SpellDataIsGroup(spell));
+}
+
+bool IsHealOverTimeSpellData(const SPDat_Spell_Struct &spell)
+{
+	return SpellDataHasEffect(spell, SE_HealOverTime) && !SpellDataIsGroup(spell);
+}
+
+bool IsCastonFadeDurationSpellData(const SPDat_Spell_Struct &spell)
+{
+	return SpellDataHasEffect(spell, SE_CastOnFadeEffect) ||
+		SpellDataHasEffect(spell, SE_CastOnFadeEffectNPC) ||
+		SpellDataHasEffect(spell, SE_CastOnFadeEffectAlways);
+}
+
+void BuildSpellTraits(const SPDat_Spell_Struct &spell, SpellTraits &traits)
+{
+	memset(&traits, 0, sizeof(SpellTraits));
+
+	for (int i = 0; i < EFFECT_COUNT; i++) {
+		int effect = spell.effect_id[i];
+		if (effect >= 0 && effect < SpellTraits::EffectBits) {
+			traits.effects[effect >> 6] |= (uint64) 1 << (effect & 63);
+		}
+	}
+
+	struct {
+		bool (*classify)(const SPDat_Spell_Struct &);
+		uint32 flag;
+	} const classifiers[] = {
+		{IsBeneficialSpellData,         SpellTraits::Beneficial},
+		{IsBuffSpellData,               SpellTraits::Buff},
+		{IsLifetapSpellData,            SpellTraits::Lifetap},
+		{IsDamageSpellData,             SpellTraits::Damage},
+		{IsPureNukeSpellData,           SpellTraits::PureNuke},
+		{IsPartialCapableSpellData,     SpellTraits::PartialCapable},
+		{IsSummonSpellData,             SpellTraits::Summon},
+		{IsCureSpellData,               SpellTraits::Cure},
+		{IsSlowSpellData,               SpellTraits::Slow},
+		{IsHasteSpellData,              SpellTraits::Haste},
+		{IsInvisSpellData,              SpellTraits::Invis},
+		{IsRuneSpellData,               SpellTraits::Rune},
+		{IsMagicRuneSpellData,          SpellTraits::MagicRune},
+		{IsManaTapSpellData,            SpellTraits::ManaTap},
+		{IsCompleteHealSpellData,       SpellTraits::CompleteHeal},
+		{IsHealOverTimeSpellData,       SpellTraits::HealOverTime},
+		{IsCastonFadeDurationSpellData, SpellTraits::CastOnFadeDuration},
+	};
+
+	for (const auto &c : classifiers) {
+		if (c.classify(spell)) {
+			traits.flags |= c.flag;
+		}
+	}
+}
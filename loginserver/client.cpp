@@ -20,10 +20,18 @@ Client::Client(std::shared_ptr<EQStreamInterface> c, LSClientVersion v)
 	m_account_id       = 0;
 	m_play_server_id   = 0;
 	m_play_sequence_id = 0;
+	m_hash_account_id  = 0;
+	m_hash_queued      = false;
+	m_hash_deferred    = false;
+	m_alive            = std::make_shared<bool>(true);
 }
 
 bool Client::Process()
 {
+	if (m_client_status == cs_verifying_login && !m_hash_queued) {
+		QueueLoginHash();
+	}
+
 	EQApplicationPacket *app = m_connection->PopPacket();
 	while (app) {
 		if (server.options.IsTraceOn()) {
@@ -238,9 +246,18 @@ void Client::Handle_Login(const char *data, unsigned int size)
 			ParseAccountString(user, user, db_loginserver);
 
 			if (server.db->GetLoginDataFromAccountInfo(user, db_loginserver, db_account_password_hash, db_account_id)) {
-				result = VerifyLoginHash(user, db_loginserver, cred, db_account_password_hash);
+				m_client_status = cs_verifying_login;
+				m_hash_account_id = db_account_id;
+
+				m_hash_request.account_username          = user;
+				m_hash_request.source_loginserver        = db_loginserver;
+				m_hash_request.account_password          = cred;
+				m_hash_request.password_hash             = db_account_password_hash;
+				m_hash_request.encryption_mode           = server.options.GetEncryptionMode();
+				m_hash_request.update_insecure_passwords = server.options.IsUpdatingInsecurePasswords();
 
-				LogDebug("[VerifyLoginHash] Success [{0}]", (result ? "true" : "false"));
+				QueueLoginHash();
+				return;
 			}
 			else {
 				m_client_status = cs_creating_account;
@@ -251,6 +268,19 @@ void Client::Handle_Login(const char *data, unsigned int size)
 		}
 	}
 
+	FinishLogin(result, user, db_account_id, db_loginserver);
+}
+
+/**
+ * Sends the reply for a login once its credentials have been checked
+ *
+ * @param result
+ * @param user
+ * @param db_account_id
+ * @param db_loginserver
+ */
+void Client::FinishLogin(bool result, const std::string &user, unsigned int db_account_id, const std::string &db_loginserver)
+{
 	/**
 	 * Login accepted
 	 */
@@ -431,85 +461,69 @@ void Client::DoFailedLogin()
 }
 
 /**
- * Verifies a login hash, will also attempt to update a login hash if needed
- *
- * @param account_username
- * @param source_loginserver
- * @param account_password
- * @param password_hash
- * @return
+ * Hands the stored login off to the hash pool, when the pool is full the client keeps
+ * waiting and Process() tries again on the next pass
  */
-bool Client::VerifyLoginHash(
-	const std::string &account_username,
-	const std::string &source_loginserver,
-	const std::string &account_password,
-	const std::string &password_hash
-)
+void Client::QueueLoginHash()
 {
-	auto encryption_mode = server.options.GetEncryptionMode();
-	if (eqcrypt_verify_hash(account_username, account_password, password_hash, encryption_mode)) {
-		return true;
-	}
-	else {
-		if (server.options.IsUpdatingInsecurePasswords()) {
-			if (encryption_mode < EncryptionModeArgon2) {
-				encryption_mode = EncryptionModeArgon2;
-			}
+	// the client can be removed before its job finishes, the callback only runs if it still exists
+	std::weak_ptr<bool> alive = m_alive;
 
-			uint32 insecure_source_encryption_mode = 0;
-			if (password_hash.length() == CryptoHash::md5_hash_length) {
-				for (int i = EncryptionModeMD5; i <= EncryptionModeMD5Triple; ++i) {
-					if (i != encryption_mode &&
-						eqcrypt_verify_hash(account_username, account_password, password_hash, i)) {
-						insecure_source_encryption_mode = i;
-					}
-				}
-			}
-			else if (password_hash.length() == CryptoHash::sha1_hash_length && insecure_source_encryption_mode == 0) {
-				for (int i = EncryptionModeSHA; i <= EncryptionModeSHATriple; ++i) {
-					if (i != encryption_mode &&
-						eqcrypt_verify_hash(account_username, account_password, password_hash, i)) {
-						insecure_source_encryption_mode = i;
-					}
-				}
-			}
-			else if (password_hash.length() == CryptoHash::sha512_hash_length && insecure_source_encryption_mode == 0) {
-				for (int i = EncryptionModeSHA512; i <= EncryptionModeSHA512Triple; ++i) {
-					if (i != encryption_mode &&
-						eqcrypt_verify_hash(account_username, account_password, password_hash, i)) {
-						insecure_source_encryption_mode = i;
-					}
-				}
+	m_hash_queued = server.hash_pool->Enqueue(
+		m_hash_request,
+		[this, alive](const LoginHashResult &result) {
+			if (alive.expired()) {
+				return;
 			}
 
-			if (insecure_source_encryption_mode > 0) {
-				LogInfo(
-					"[{}] Updated insecure password user [{}] loginserver [{}] from mode [{}] ({}) to mode [{}] ({})",
-					__func__,
-					account_username,
-					source_loginserver,
-					GetEncryptionByModeId(insecure_source_encryption_mode),
-					insecure_source_encryption_mode,
-					GetEncryptionByModeId(encryption_mode),
-					encryption_mode
-				);
-
-				server.db->UpdateLoginserverAccountPasswordHash(
-					account_username,
-					source_loginserver,
-					eqcrypt_hash(
-						account_username,
-						account_password,
-						encryption_mode
-					)
-				);
-
-				return true;
-			}
+			OnLoginHashVerified(result);
 		}
+	);
+
+	if (!m_hash_queued && !m_hash_deferred) {
+		m_hash_deferred = true;
+		LogInfo(
+			"login [{0}] user [{1}] Login deferred, [{2}] password checks already pending",
+			m_hash_request.source_loginserver,
+			m_hash_request.account_username,
+			server.hash_pool->GetPending()
+		);
 	}
+}
 
-	return false;
+/**
+ * Finishes a login once the hash pool has checked its password, also stores the upgraded
+ * hash when the password matched an insecure mode
+ *
+ * @param result
+ */
+void Client::OnLoginHashVerified(const LoginHashResult &result)
+{
+	const std::string user           = m_hash_request.account_username;
+	const std::string db_loginserver = m_hash_request.source_loginserver;
+
+	m_hash_request.account_password.clear();
+	m_hash_queued   = false;
+	m_hash_deferred = false;
+
+	LogDebug("[VerifyLoginHash] Success [{0}]", (result.verified ? "true" : "false"));
+
+	if (result.insecure_source_encryption_mode > 0) {
+		LogInfo(
+			"[{}] Updated insecure password user [{}] loginserver [{}] from mode [{}] ({}) to mode [{}] ({})",
+			__func__,
+			user,
+			db_loginserver,
+			GetEncryptionByModeId(result.insecure_source_encryption_mode),
+			result.insecure_source_encryption_mode,
+			GetEncryptionByModeId(result.encryption_mode),
+			result.encryption_mode
+		);
+
+		server.db->UpdateLoginserverAccountPasswordHash(user, db_loginserver, result.updated_password_hash);
+	}
+
+	FinishLogin(result.verified, user, m_hash_account_id, db_loginserver);
 }
 
 /**
@@ -8,6 +8,7 @@
 #include "../common/net/dns.h"
 #include "../common/net/daybreak_connection.h"
 #include "login_types.h"
+#include "login_hash_pool.h"
 #include <memory>
 
 /**
@@ -142,20 +143,14 @@ public:
 	void DoFailedLogin();
 
 	/**
-	 * Verifies a login hash, will also attempt to update a login hash if needed
+	 * Sends the login reply once credentials have been checked
 	 *
-	 * @param account_username
-	 * @param source_loginserver
-	 * @param account_password
-	 * @param password_hash
-	 * @return
+	 * @param result
+	 * @param user
+	 * @param db_account_id
+	 * @param db_loginserver
 	 */
-	bool VerifyLoginHash(
-		const std::string &account_username,
-		const std::string &source_loginserver,
-		const std::string &account_password,
-		const std::string &password_hash
-	);
+	void FinishLogin(bool result, const std::string &user, unsigned int db_account_id, const std::string &db_loginserver);
 
 	void DoSuccessfulLogin(const std::string in_account_name, int db_account_id, const std::string &db_loginserver);
 	void CreateLocalAccount(const std::string &username, const std::string &password);
@@ -180,6 +175,15 @@ private:
 
 	std::string m_stored_user;
 	std::string m_stored_pass;
+
+	LoginHashRequest      m_hash_request;
+	unsigned int          m_hash_account_id;
+	bool                  m_hash_queued;
+	bool                  m_hash_deferred;
+	std::shared_ptr<bool> m_alive;
+	void QueueLoginHash();
+	void OnLoginHashVerified(const LoginHashResult &result);
+
 	void LoginOnNewConnection(std::shared_ptr<EQ::Net::DaybreakConnection> connection);
 	void LoginOnStatusChange(
 		std::shared_ptr<EQ::Net::DaybreakConnection> conn,
@@ -0,0 +1,121 @@
+#include "login_hash_pool.h"
+#include "encryption.h"
+
+/**
+ * @param threads
+ * @param max_pending
+ */
+LoginHashPool::LoginHashPool(size_t threads, size_t max_pending)
+	: m_pending(0), m_max_pending(max_pending), m_thread_count(threads), m_workers(threads)
+{
+}
+
+/**
+ * @param request
+ * @param callback
+ * @return
+ */
+bool LoginHashPool::Enqueue(const LoginHashRequest &request, Callback callback)
+{
+	if (m_pending >= m_max_pending) {
+		return false;
+	}
+
+	auto job = std::make_shared<Job>();
+	job->request  = request;
+	job->callback = std::move(callback);
+
+	m_workers.Enqueue(
+		[this, job]() {
+			job->result = Verify(job->request);
+
+			std::unique_lock<std::mutex> lock(m_lock);
+			m_completed.push_back(job);
+		}
+	);
+
+	++m_pending;
+	return true;
+}
+
+void LoginHashPool::Process()
+{
+	std::vector<std::shared_ptr<Job>> completed;
+	{
+		std::unique_lock<std::mutex> lock(m_lock);
+		if (m_completed.empty()) {
+			return;
+		}
+
+		completed.swap(m_completed);
+	}
+
+	for (auto &job : completed) {
+		--m_pending;
+		job->callback(job->result);
+	}
+}
+
+/**
+ * @param request
+ * @return
+ */
+LoginHashResult LoginHashPool::Verify(const LoginHashRequest &request)
+{
+	LoginHashResult result;
+	result.verified                        = false;
+	result.encryption_mode                 = request.encryption_mode;
+	result.insecure_source_encryption_mode = 0;
+
+	if (eqcrypt_verify_hash(
+		request.account_username,
+		request.account_password,
+		request.password_hash,
+		request.encryption_mode
+	)) {
+		result.verified = true;
+		return result;
+	}
+
+	if (!request.update_insecure_passwords) {
+		return result;
+	}
+
+	if (result.encryption_mode < EncryptionModeArgon2) {
+		result.encryption_mode = EncryptionModeArgon2;
+	}
+
+	int first_mode = 0;
+	int last_mode  = 0;
+	if (request.password_hash.length() == CryptoHash::md5_hash_length) {
+		first_mode = EncryptionModeMD5;
+		last_mode  = EncryptionModeMD5Triple;
+	}
+	else if (request.password_hash.length() == CryptoHash::sha1_hash_length) {
+		first_mode = EncryptionModeSHA;
+		last_mode  = EncryptionModeSHATriple;
+	}
+	else if (request.password_hash.length() == CryptoHash::sha512_hash_length) {
+		first_mode = EncryptionModeSHA512;
+		last_mode  = EncryptionModeSHA512Triple;
+	}
+
+	for (int i = first_mode; first_mode > 0 && i <= last_mode; ++i) {
+		if (i != result.encryption_mode &&
+			eqcrypt_verify_hash(request.account_username, request.account_password, request.password_hash, i)) {
+			result.insecure_source_encryption_mode = i;
+			break;
+		}
+	}
+
+	if (result.insecure_source_encryption_mode > 0) {
+		result.verified              = true;
+		result.updated_password_hash = eqcrypt_hash(
+			request.account_username,
+			request.account_password,
+			result.encryption_mode
+		);
+	}
+
+	return result;
+}
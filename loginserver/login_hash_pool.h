@@ -0,0 +1,89 @@
+#ifndef EQEMU_LOGIN_HASH_POOL_H
+#define EQEMU_LOGIN_HASH_POOL_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "../common/event/task_scheduler.h"
+
+struct LoginHashRequest {
+	std::string account_username;
+	std::string source_loginserver;
+	std::string account_password;
+	std::string password_hash;
+	int         encryption_mode;
+	bool        update_insecure_passwords;
+};
+
+struct LoginHashResult {
+	bool        verified;
+	int         encryption_mode;
+	int         insecure_source_encryption_mode;
+	std::string updated_password_hash;
+};
+
+/**
+ * Runs password hash checks (argon2 / scrypt and the legacy fallbacks) off the main loop
+ *
+ * Jobs run on a fixed set of worker threads; results are collected and handed back to their
+ * callbacks from Process() on the main loop, so callers never touch the database or a client
+ * connection from a worker. Enqueue refuses new work once max_pending jobs are outstanding,
+ * which lets the caller hold the session instead of growing the queue without bound
+ */
+class LoginHashPool {
+public:
+	typedef std::function<void(const LoginHashResult &)> Callback;
+
+	/**
+	 * @param threads
+	 * @param max_pending
+	 */
+	LoginHashPool(size_t threads, size_t max_pending);
+
+	/**
+	 * Queues a verification, returns false without queueing when the pool is full
+	 *
+	 * @param request
+	 * @param callback
+	 * @return
+	 */
+	bool Enqueue(const LoginHashRequest &request, Callback callback);
+
+	/**
+	 * Delivers finished jobs to their callbacks, called from the main loop
+	 */
+	void Process();
+
+	size_t GetPending() const { return m_pending; }
+	size_t GetMaxPending() const { return m_max_pending; }
+	size_t GetThreadCount() const { return m_thread_count; }
+
+	/**
+	 * Verifies a login hash, also works out a replacement hash when an insecure legacy mode matched
+	 *
+	 * @param request
+	 * @return
+	 */
+	static LoginHashResult Verify(const LoginHashRequest &request);
+
+private:
+	struct Job {
+		LoginHashRequest request;
+		LoginHashResult  result;
+		Callback         callback;
+	};
+
+	size_t m_pending;
+	size_t m_max_pending;
+	size_t m_thread_count;
+
+	std::mutex                        m_lock;
+	std::vector<std::shared_ptr<Job>> m_completed;
+
+	// declared last so the workers are joined before the completed list they write to goes away
+	EQ::Event::TaskScheduler m_workers;
+};
+
+#endif
@@ -8,6 +8,7 @@
 #include "options.h"
 #include "server_manager.h"
 #include "client_manager.h"
+#include "login_hash_pool.h"
 #include "loginserver_webserver.h"
 
 /**
@@ -27,6 +28,7 @@ public:
 	Options                            options;
 	ServerManager                      *server_manager;
 	ClientManager                      *client_manager{};
+	LoginHashPool                      *hash_pool{};
 };
 
 #endif
@@ -96,6 +96,7 @@ enum LSClientVersion {
 enum LSClientStatus {
 	cs_not_sent_session_ready,
 	cs_waiting_for_login,
+	cs_verifying_login,
 	cs_creating_account,
 	cs_failed_to_login,
 	cs_logged_in
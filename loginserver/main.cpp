@@ -17,6 +17,10 @@
 #include <sstream>
 #include <thread>
 
+#ifdef ENABLE_SECURITY
+#include <sodium.h>
+#endif
+
 LoginServer server;
 EQEmuLogSys LogSys;
 bool        run_server = true;
@@ -215,6 +219,43 @@ int main(int argc, char **argv)
 		return 1;
 	}
 
+	/**
+	 * create password hash pool, argon2 and scrypt are too slow to run on the main loop
+	 */
+	int hash_worker_threads = server.config.GetVariableInt("security", "hash_worker_threads", 0);
+	if (hash_worker_threads <= 0) {
+		hash_worker_threads = static_cast<int>(std::thread::hardware_concurrency());
+		if (hash_worker_threads < 2) {
+			hash_worker_threads = 2;
+		}
+	}
+
+	int hash_queue_depth = server.config.GetVariableInt("security", "hash_queue_depth", 512);
+	if (hash_queue_depth < 1) {
+		hash_queue_depth = 1;
+	}
+
+#ifdef ENABLE_SECURITY
+	/**
+	 * libsodium has to be initialised once before the hash pool workers use it from several threads
+	 */
+	if (sodium_init() == -1) {
+		LogError("libsodium Initialization Failure");
+		LogInfo("Server Manager Shutdown");
+		delete server.server_manager;
+
+		LogInfo("Database System Shutdown");
+		delete server.db;
+		return 1;
+	}
+#endif
+
+	LogInfo("Password Hash Pool Init");
+	server.hash_pool = new LoginHashPool(
+		static_cast<size_t>(hash_worker_threads),
+		static_cast<size_t>(hash_queue_depth)
+	);
+
 	/**
 	 * create client manager
 	 */
@@ -275,9 +316,12 @@ int main(int argc, char **argv)
 	LogInfo("[Config] [Security] IsTokenLoginAllowed [{0}]", server.options.IsTokenLoginAllowed());
 	LogInfo("[Config] [Security] IsPasswordLoginAllowed [{0}]", server.options.IsPasswordLoginAllowed());
 	LogInfo("[Config] [Security] IsUpdatingInsecurePasswords [{0}]", server.options.IsUpdatingInsecurePasswords());
+	LogInfo("[Config] [Security] HashWorkerThreads [{0}]", server.hash_pool->GetThreadCount());
+	LogInfo("[Config] [Security] HashQueueDepth [{0}]", server.hash_pool->GetMaxPending());
 
 	while (run_server) {
 		Timer::SetCurrentTime();
+		server.hash_pool->Process();
 		server.client_manager->Process();
 		EQ::EventLoop::Get().Process();
 
@@ -289,6 +333,9 @@ int main(int argc, char **argv)
 	LogInfo("Client Manager Shutdown");
 	delete server.client_manager;
 
+	LogInfo("Password Hash Pool Shutdown");
+	delete server.hash_pool;
+
 	LogInfo("Server Manager Shutdown");
 	delete server.server_manager;
 
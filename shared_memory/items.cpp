@@ -23,10 +23,24 @@
 #include "../common/memory_mapped_file.h"
 #include "../common/eqemu_exception.h"
 #include "../common/item_data.h"
+#include "../common/eqemu_logsys.h"
+#include "segment_stamp.h"
+
+void LoadItems(SharedDatabase *database, const std::string &prefix, bool force) {
+	auto Config = EQEmuConfig::get();
+	std::string file_name = Config->SharedMemDir + prefix + std::string("items");
+
+	std::string signature = GetSegmentSignature(database, "items", sizeof(EQ::ItemData));
+	if (!force && IsSegmentCurrent(file_name, signature)) {
+		LogInfo("Items are unchanged, keeping [{}]", file_name);
+		return;
+	}
 
-void LoadItems(SharedDatabase *database, const std::string &prefix) {
 	EQ::IPCMutex mutex("items");
-	mutex.Lock();
+	bool in_place = SegmentBuildsInPlace();
+	if (in_place) {
+		mutex.Lock();
+	}
 
 	int32 items = -1;
 	uint32 max_item = 0;
@@ -37,12 +51,20 @@ void LoadItems(SharedDatabase *database, const std::string &prefix) {
 
 	uint32 size = static_cast<uint32>(EQ::FixedMemoryHashSet<EQ::ItemData>::estimated_size(items, max_item));
 
-	auto Config = EQEmuConfig::get();
-	std::string file_name = Config->SharedMemDir + prefix + std::string("items");
-	EQ::MemoryMappedFile mmf(file_name, size);
-	mmf.ZeroFile();
+	std::string build_name = GetSegmentBuildName(file_name);
+	{
+		EQ::MemoryMappedFile mmf(build_name, size);
+		mmf.ZeroFile();
+
+		void *ptr = mmf.Get();
+		database->LoadItems(ptr, size, items, max_item);
+	}
+
+	if (!in_place) {
+		mutex.Lock();
+	}
 
-	void *ptr = mmf.Get();
-	database->LoadItems(ptr, size, items, max_item);
+	CommitSegment(build_name, file_name);
+	WriteSegmentStamp(file_name, signature);
 	mutex.Unlock();
 }
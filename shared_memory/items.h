@@ -23,6 +23,6 @@
 #include "../common/eqemu_config.h"
 
 class SharedDatabase;
-void LoadItems(SharedDatabase *database, const std::string &prefix);
+void LoadItems(SharedDatabase *database, const std::string &prefix, bool force);
 
 #endif
@@ -24,10 +24,33 @@
 #include "../common/eqemu_exception.h"
 #include "../common/fixed_memory_variable_hash_set.h"
 #include "../common/loottable.h"
+#include "../common/eqemu_logsys.h"
+#include "../common/repositories/criteria/content_filter_criteria.h"
+#include "segment_stamp.h"
+
+void LoadLoot(SharedDatabase *database, const std::string &prefix, bool force) {
+	auto Config = EQEmuConfig::get();
+	std::string file_name_lt = Config->SharedMemDir + prefix + std::string("loot_table");
+	std::string file_name_ld = Config->SharedMemDir + prefix + std::string("loot_drop");
+
+	//both files come from all four tables and the content filter, they are only ever rebuilt together
+	std::string signature = GetSegmentSignature(
+		database,
+		"loottable, loottable_entries, lootdrop, lootdrop_entries",
+		sizeof(LootTable_Struct) + sizeof(LootTableEntries_Struct) + sizeof(LootDrop_Struct) + sizeof(LootDropEntries_Struct),
+		ContentFilterCriteria::apply()
+	);
+
+	if (!force && IsSegmentCurrent(file_name_lt, signature) && IsSegmentCurrent(file_name_ld, signature)) {
+		LogInfo("Loot is unchanged, keeping [{}] and [{}]", file_name_lt, file_name_ld);
+		return;
+	}
 
-void LoadLoot(SharedDatabase *database, const std::string &prefix) {
 	EQ::IPCMutex mutex("loot");
-	mutex.Lock();
+	bool in_place = SegmentBuildsInPlace();
+	if (in_place) {
+		mutex.Lock();
+	}
 
 	uint32 loot_table_count, loot_table_max, loot_table_entries_count;
 	uint32 loot_drop_count, loot_drop_max, loot_drop_entries_count;
@@ -44,22 +67,31 @@ void LoadLoot(SharedDatabase *database, const std::string &prefix) {
 		(loot_drop_count * sizeof(LootDrop_Struct)) +				//loot table headers
 		(loot_drop_entries_count * sizeof(LootDropEntries_Struct));	//number of loot table entries
 
-	auto Config = EQEmuConfig::get();
-	std::string file_name_lt = Config->SharedMemDir + prefix + std::string("loot_table");
-	std::string file_name_ld = Config->SharedMemDir + prefix + std::string("loot_drop");
+	std::string build_name_lt = GetSegmentBuildName(file_name_lt);
+	std::string build_name_ld = GetSegmentBuildName(file_name_ld);
+	{
+		EQ::MemoryMappedFile mmf_loot_table(build_name_lt, loot_table_size);
+		EQ::MemoryMappedFile mmf_loot_drop(build_name_ld, loot_drop_size);
+		mmf_loot_table.ZeroFile();
+		mmf_loot_drop.ZeroFile();
+
+		EQ::FixedMemoryVariableHashSet<LootTable_Struct> loot_table_hash(reinterpret_cast<byte*>(mmf_loot_table.Get()),
+			loot_table_size, loot_table_max);
 
-	EQ::MemoryMappedFile mmf_loot_table(file_name_lt, loot_table_size);
-	EQ::MemoryMappedFile mmf_loot_drop(file_name_ld, loot_drop_size);
-	mmf_loot_table.ZeroFile();
-	mmf_loot_drop.ZeroFile();
+		EQ::FixedMemoryVariableHashSet<LootDrop_Struct> loot_drop_hash(reinterpret_cast<byte*>(mmf_loot_drop.Get()),
+			loot_drop_size, loot_drop_max);
 
-	EQ::FixedMemoryVariableHashSet<LootTable_Struct> loot_table_hash(reinterpret_cast<byte*>(mmf_loot_table.Get()),
-		loot_table_size, loot_table_max);
+		database->LoadLootTables(mmf_loot_table.Get(), loot_table_max);
+		database->LoadLootDrops(mmf_loot_drop.Get(), loot_drop_max);
+	}
 
-	EQ::FixedMemoryVariableHashSet<LootDrop_Struct> loot_drop_hash(reinterpret_cast<byte*>(mmf_loot_drop.Get()),
-		loot_drop_size, loot_drop_max);
+	if (!in_place) {
+		mutex.Lock();
+	}
 
-	database->LoadLootTables(mmf_loot_table.Get(), loot_table_max);
-	database->LoadLootDrops(mmf_loot_drop.Get(), loot_drop_max);
+	CommitSegment(build_name_lt, file_name_lt);
+	CommitSegment(build_name_ld, file_name_ld);
+	WriteSegmentStamp(file_name_lt, signature);
+	WriteSegmentStamp(file_name_ld, signature);
 	mutex.Unlock();
 }
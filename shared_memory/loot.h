@@ -23,6 +23,6 @@
 #include "../common/eqemu_config.h"
 
 class SharedDatabase;
-void LoadLoot(SharedDatabase *database, const std::string &prefix);
+void LoadLoot(SharedDatabase *database, const std::string &prefix, bool force);
 
 #endif
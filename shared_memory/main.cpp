@@ -186,6 +186,7 @@ int main(int argc, char **argv)
 	bool load_skill_caps = false;
 	bool load_spells     = false;
 	bool load_bd         = false;
+	bool force_rebuild   = false;
 
 	if (argc > 1) {
 		for (int i = 1; i < argc; ++i) {
@@ -229,6 +230,11 @@ int main(int argc, char **argv)
 					}
 					break;
 				case '-': {
+					if (strcasecmp("-force", argv[i]) == 0) {
+						force_rebuild = true;
+						break;
+					}
+
 					auto split = SplitString(argv[i], '=');
 					if (split.size() >= 2) {
 						auto command  = split[0];
@@ -251,7 +257,7 @@ int main(int argc, char **argv)
 	if (load_all || load_items) {
 		LogInfo("Loading items");
 		try {
-			LoadItems(&content_db, hotfix_name);
+			LoadItems(&content_db, hotfix_name, force_rebuild);
 		} catch (std::exception &ex) {
 			LogError("{}", ex.what());
 			return 1;
@@ -271,7 +277,7 @@ int main(int argc, char **argv)
 	if (load_all || load_loot) {
 		LogInfo("Loading loot");
 		try {
-			LoadLoot(&content_db, hotfix_name);
+			LoadLoot(&content_db, hotfix_name, force_rebuild);
 		} catch (std::exception &ex) {
 			LogError("{}", ex.what());
 			return 1;
@@ -291,7 +297,7 @@ int main(int argc, char **argv)
 	if (load_all || load_spells) {
 		LogInfo("Loading spells");
 		try {
-			LoadSpells(&content_db, hotfix_name);
+			LoadSpells(&content_db, hotfix_name, force_rebuild);
 		} catch (std::exception &ex) {
 			LogError("{}", ex.what());
 			return 1;
@@ -0,0 +1,166 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2013 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#include <stdio.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef _WINDOWS
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+#include "segment_stamp.h"
+#include "../common/global_define.h"
+#include "../common/shareddb.h"
+#include "../common/eqemu_exception.h"
+#include "../common/string_util.h"
+#include "../common/version.h"
+
+//bump when the stamp format or the way a segment is laid out from its signature changes
+#define SEGMENT_STAMP_VERSION 1
+
+namespace {
+	std::string StampName(const std::string &file_name)
+	{
+		return file_name + ".stamp";
+	}
+}
+
+std::string GetSegmentSignature(SharedDatabase *database, const std::string &tables, uint32 layout_size, const std::string &filter)
+{
+	//CHECKSUM TABLE still scans on the server but nothing is sent back or parsed, which is the expensive part
+	auto results = database->QueryDatabase(StringFormat("CHECKSUM TABLE %s", tables.c_str()));
+	if (!results.Success() || results.RowCount() == 0) {
+		return "";
+	}
+
+	std::string signature = StringFormat(
+		"stamp %d schema %d layout %u",
+		SEGMENT_STAMP_VERSION,
+		CURRENT_BINARY_DATABASE_VERSION,
+		layout_size
+	);
+
+	for (auto row = results.begin(); row != results.end(); ++row) {
+		//a NULL checksum means the table is missing, never treat that as current
+		if (!row[0] || !row[1]) {
+			return "";
+		}
+
+		signature += StringFormat(" %s %s", row[0], row[1]);
+	}
+
+	if (!filter.empty()) {
+		signature += " filter" + filter;
+	}
+
+	return signature;
+}
+
+bool IsSegmentCurrent(const std::string &file_name, const std::string &signature)
+{
+	if (signature.empty()) {
+		return false;
+	}
+
+	struct stat st;
+	if (stat(file_name.c_str(), &st) != 0 || st.st_size == 0) {
+		return false;
+	}
+
+	FILE *f = fopen(StampName(file_name).c_str(), "rb");
+	if (!f) {
+		return false;
+	}
+
+	std::string stamp;
+	char buffer[4096];
+	size_t read = 0;
+	while ((read = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+		stamp.append(buffer, read);
+	}
+	fclose(f);
+
+	return stamp == signature;
+}
+
+bool SegmentBuildsInPlace()
+{
+#ifdef _WINDOWS
+	//mappings are named after the file and a mapped file can't be replaced
+	return true;
+#else
+	return false;
+#endif
+}
+
+std::string GetSegmentBuildName(const std::string &file_name)
+{
+	//the stamp goes first so a build that dies part way is never mistaken for current
+	remove(StampName(file_name).c_str());
+
+	if (SegmentBuildsInPlace()) {
+		return file_name;
+	}
+
+	std::string build_name = StringFormat("%s.%d.build", file_name.c_str(), (int) getpid());
+	remove(build_name.c_str());
+	return build_name;
+}
+
+void CommitSegment(const std::string &build_name, const std::string &file_name)
+{
+	if (build_name == file_name) {
+		return;
+	}
+
+	if (rename(build_name.c_str(), file_name.c_str()) != 0) {
+		remove(build_name.c_str());
+		EQ_EXCEPT("Shared Memory", "Unable to move the rebuilt segment into place.");
+	}
+}
+
+void WriteSegmentStamp(const std::string &file_name, const std::string &signature)
+{
+	if (signature.empty()) {
+		return;
+	}
+
+	std::string stamp_name = StampName(file_name);
+	std::string temp_name  = StringFormat("%s.%d.tmp", stamp_name.c_str(), (int) getpid());
+
+	FILE *f = fopen(temp_name.c_str(), "wb");
+	if (!f) {
+		return;
+	}
+
+	bool ok = fwrite(signature.data(), 1, signature.size(), f) == signature.size();
+	ok = fclose(f) == 0 && ok;
+
+#ifdef _WINDOWS
+	remove(stamp_name.c_str());
+#endif
+
+	//a stamp that fails to land only costs a rebuild on the next run
+	if (!ok || rename(temp_name.c_str(), stamp_name.c_str()) != 0) {
+		remove(temp_name.c_str());
+	}
+}
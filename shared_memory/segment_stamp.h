@@ -0,0 +1,46 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2013 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#ifndef __EQEMU_SHARED_MEMORY_SEGMENT_STAMP_H
+#define __EQEMU_SHARED_MEMORY_SEGMENT_STAMP_H
+
+#include <string>
+#include "../common/types.h"
+
+class SharedDatabase;
+
+/*
+ * Every segment gets a <file>.stamp beside it holding the signature it was built from:
+ * the database schema version, the byte size of the struct laid out in the segment, any
+ * load filter (content flags / expansion) and the server side CHECKSUM of each source
+ * table. A run whose signature matches the stamp leaves the segment alone.
+ *
+ * Outside of windows a segment is built under a temporary name and renamed over the old
+ * one, so zones already running keep the generation they mapped and zones booting during
+ * the rebuild attach either the old or the new file, never a half written one.
+ */
+std::string GetSegmentSignature(SharedDatabase *database, const std::string &tables, uint32 layout_size, const std::string &filter = "");
+bool IsSegmentCurrent(const std::string &file_name, const std::string &signature);
+
+//true when the segment has to be written in place, under the segment mutex for the whole load
+bool SegmentBuildsInPlace();
+std::string GetSegmentBuildName(const std::string &file_name);
+void CommitSegment(const std::string &build_name, const std::string &file_name);
+void WriteSegmentStamp(const std::string &file_name, const std::string &signature);
+
+#endif
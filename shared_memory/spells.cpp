@@ -23,24 +23,50 @@
 #include "../common/memory_mapped_file.h"
 #include "../common/eqemu_exception.h"
 #include "../common/spdat.h"
+#include "../common/eqemu_logsys.h"
+#include "segment_stamp.h"
+
+void LoadSpells(SharedDatabase *database, const std::string &prefix, bool force) {
+	auto Config = EQEmuConfig::get();
+	std::string file_name = Config->SharedMemDir + prefix + std::string("spells");
+
+	std::string signature = GetSegmentSignature(
+		database,
+		"spells_new, damageshieldtypes",
+		sizeof(SPDat_Spell_Struct) + sizeof(SpellTraits)
+	);
+	if (!force && IsSegmentCurrent(file_name, signature)) {
+		LogInfo("Spells are unchanged, keeping [{}]", file_name);
+		return;
+	}
 
-void LoadSpells(SharedDatabase *database, const std::string &prefix) {
 	EQ::IPCMutex mutex("spells");
-	mutex.Lock();
+	bool in_place = SegmentBuildsInPlace();
+	if (in_place) {
+		mutex.Lock();
+	}
+
 	int records = database->GetMaxSpellID() + 1;
 	if(records == 0) {
 		EQ_EXCEPT("Shared Memory", "Unable to get any spells from the database.");
 	}
 
-	uint32 size = records * sizeof(SPDat_Spell_Struct) + sizeof(uint32);
+	uint32 size = (uint32) GetSpellsSegmentSize(records);
 
-	auto Config = EQEmuConfig::get();
-	std::string file_name = Config->SharedMemDir + prefix + std::string("spells");
-	EQ::MemoryMappedFile mmf(file_name, size);
-	mmf.ZeroFile();
+	std::string build_name = GetSegmentBuildName(file_name);
+	{
+		EQ::MemoryMappedFile mmf(build_name, size);
+		mmf.ZeroFile();
+
+		void *ptr = mmf.Get();
+		database->LoadSpells(ptr, records);
+	}
 
-	void *ptr = mmf.Get();
-	database->LoadSpells(ptr, records);
+	if (!in_place) {
+		mutex.Lock();
+	}
+
+	CommitSegment(build_name, file_name);
+	WriteSegmentStamp(file_name, signature);
 	mutex.Unlock();
 }
-
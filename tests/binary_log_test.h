@@ -0,0 +1,183 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2013 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#ifndef __EQEMU_TESTS_BINARY_LOG_H
+#define __EQEMU_TESTS_BINARY_LOG_H
+
+#include <cstdio>
+#include <limits>
+#include <map>
+#include "cppunit/cpptest.h"
+#include "../common/binary_log.h"
+#include "../common/binary_log_reader.h"
+#include "../common/string_util.h"
+
+class BinaryLogTest : public Test::Suite {
+	typedef void(BinaryLogTest::*TestFunction)(void);
+public:
+	BinaryLogTest() {
+		TEST_ADD(BinaryLogTest::ArgRoundTripTest);
+		TEST_ADD(BinaryLogTest::FileRoundTripTest);
+	}
+
+	~BinaryLogTest() {
+	}
+
+	private:
+	void ArgRoundTripTest() {
+		std::string payload;
+		BinaryLog::EncodeArgs(
+			payload,
+			std::numeric_limits<int64>::min(),
+			std::numeric_limits<uint64>::max(),
+			-1,
+			true,
+			'z',
+			0.25,
+			std::string("name")
+		);
+
+		BinaryLog::RecordReader reader(payload.data(), payload.size());
+		BinaryLog::LogArg arg;
+
+		TEST_ASSERT(BinaryLog::ReadArg(reader, arg));
+		TEST_ASSERT(arg.type == BinaryLog::ArgInt && arg.i == std::numeric_limits<int64>::min());
+		TEST_ASSERT(BinaryLog::ReadArg(reader, arg));
+		TEST_ASSERT(arg.type == BinaryLog::ArgUInt && arg.u == std::numeric_limits<uint64>::max());
+		TEST_ASSERT(BinaryLog::ReadArg(reader, arg));
+		TEST_ASSERT(arg.type == BinaryLog::ArgInt && arg.i == -1);
+		TEST_ASSERT(BinaryLog::ReadArg(reader, arg));
+		TEST_ASSERT(arg.type == BinaryLog::ArgBool && arg.u == 1);
+		TEST_ASSERT(BinaryLog::ReadArg(reader, arg));
+		TEST_ASSERT(arg.type == BinaryLog::ArgChar && arg.u == 'z');
+		TEST_ASSERT(BinaryLog::ReadArg(reader, arg));
+		TEST_ASSERT(arg.type == BinaryLog::ArgDouble && arg.d == 0.25);
+		TEST_ASSERT(BinaryLog::ReadArg(reader, arg));
+		TEST_ASSERT(arg.type == BinaryLog::ArgString && arg.s.compare("name") == 0);
+		TEST_ASSERT(reader.Position() == payload.size());
+
+		// nothing left, reading past the end has to fail rather than run off the buffer
+		TEST_ASSERT(!BinaryLog::ReadArg(reader, arg));
+	}
+
+	void FileRoundTripTest() {
+		const char *file_name        = "binary_log_test.binlog";
+		const char *category_names[] = {"None", "Combat"};
+
+		BinaryLogWriter writer;
+		TEST_ASSERT(writer.Open(file_name, "Tests", category_names, 2));
+
+		std::string target = "a large rat";
+		for (int i = 0; i < 2; ++i) {
+			writer.Write(BinaryLog::StyleFmt, 1, 1, __FILE__, __func__, __LINE__, "{} hits {} for {} ({:.1f}%)", "Guard", target, -42 - i, 12.5);
+		}
+		writer.Write(BinaryLog::StylePrintf, 2, 1, __FILE__, __func__, __LINE__, "%s has %u items, %d%% done [%c] [%5.2f]", "bag", 10u, 50, 'x', 3.14159);
+		writer.Close();
+
+		std::string data;
+		FILE *f = fopen(file_name, "rb");
+		TEST_ASSERT(f != nullptr);
+		if (!f) {
+			return;
+		}
+
+		char   buffer[4096];
+		size_t read = 0;
+		while ((read = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+			data.append(buffer, read);
+		}
+		fclose(f);
+		remove(file_name);
+
+		TEST_ASSERT(data.size() > 6 && memcmp(data.data(), BinaryLog::Magic, sizeof(BinaryLog::Magic)) == 0);
+
+		std::map<uint64, std::string> categories;
+		std::map<uint64, uint8>       format_styles;
+		std::map<uint64, std::string> format_texts;
+		std::vector<std::string>      messages;
+		std::vector<uint64>           message_levels;
+
+		size_t pos = sizeof(BinaryLog::Magic) + sizeof(uint16);
+		while (pos < data.size()) {
+			BinaryLog::RecordReader header(data.data() + pos, data.size() - pos);
+			uint8  type   = header.GetByte();
+			uint64 length = header.GetVarint();
+			size_t used   = header.Position();
+
+			TEST_ASSERT(header.Ok() && length <= data.size() - pos - used);
+			if (!header.Ok() || length > data.size() - pos - used) {
+				return;
+			}
+
+			BinaryLog::RecordReader record(data.data() + pos + used, static_cast<size_t>(length));
+			pos += used + static_cast<size_t>(length);
+
+			if (type == BinaryLog::RecordCategory) {
+				uint64 id = record.GetVarint();
+				categories[id] = record.GetString();
+			}
+			else if (type == BinaryLog::RecordFormat) {
+				uint64 id = record.GetVarint();
+				format_styles[id] = record.GetByte();
+				record.GetString();
+				record.GetString();
+				record.GetVarint();
+				format_texts[id] = record.GetString();
+			}
+			else if (type == BinaryLog::RecordEntry) {
+				record.GetVarint();
+				uint64 format_id = record.GetVarint();
+				uint64 category  = record.GetVarint();
+				uint8  level     = record.GetByte();
+				uint8  arg_count = record.GetByte();
+
+				TEST_ASSERT(category == 1);
+				TEST_ASSERT(format_texts.count(format_id) == 1);
+
+				std::vector<BinaryLog::LogArg> args(arg_count);
+				for (auto &arg : args) {
+					TEST_ASSERT(BinaryLog::ReadArg(record, arg));
+				}
+
+				messages.push_back(
+					format_styles[format_id] == BinaryLog::StylePrintf
+						? BinaryLog::RenderPrintf(format_texts[format_id], args)
+						: BinaryLog::RenderFmt(format_texts[format_id], args)
+				);
+				message_levels.push_back(level);
+			}
+		}
+
+		TEST_ASSERT(categories.size() == 2 && categories[1].compare("Combat") == 0);
+
+		// the repeated call site is stored once
+		TEST_ASSERT(format_texts.size() == 2);
+
+		TEST_ASSERT(messages.size() == 3);
+		if (messages.size() != 3) {
+			return;
+		}
+
+		TEST_ASSERT(messages[0].compare(fmt::format("{} hits {} for {} ({:.1f}%)", "Guard", target, -42, 12.5)) == 0);
+		TEST_ASSERT(messages[1].compare(fmt::format("{} hits {} for {} ({:.1f}%)", "Guard", target, -43, 12.5)) == 0);
+		TEST_ASSERT(messages[2].compare(StringFormat("%s has %u items, %d%% done [%c] [%5.2f]", "bag", 10u, 50, 'x', 3.14159)) == 0);
+		TEST_ASSERT(message_levels[0] == 1 && message_levels[2] == 2);
+	}
+};
+
+#endif
@@ -29,6 +29,8 @@
 #include "string_util_test.h"
 #include "data_verification_test.h"
 #include "skills_util_test.h"
+#include "binary_log_test.h"
+#include "servertalk_batch_test.h"
 #include "../common/eqemu_config.h"
 
 const EQEmuConfig *Config;
@@ -49,6 +51,8 @@ int main() {
 		tests.add(new StringUtilTest());
 		tests.add(new DataVerificationTest());
 		tests.add(new SkillsUtilsTest());
+		tests.add(new BinaryLogTest());
+		tests.add(new ServertalkBatchTest());
 		tests.run(*output, true);
 	} catch(...) {
 		return -1;
@@ -0,0 +1,253 @@
+/*	EQEMu: Everquest Server Emulator
+	Copyright (C) 2001-2013 EQEMu Development Team (http://eqemulator.net)
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; version 2 of the License.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY except by those people which sell it, which
+	are required to give you total support for your newly bought product;
+	without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+	A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program; if not, write to the Free Software
+	Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+*/
+
+#ifndef __EQEMU_TESTS_SERVERTALK_BATCH_H
+#define __EQEMU_TESTS_SERVERTALK_BATCH_H
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include "cppunit/cpptest.h"
+#include "../common/net/servertalk_batch.h"
+
+class ServertalkBatchTest : public Test::Suite {
+	typedef void(ServertalkBatchTest::*TestFunction)(void);
+public:
+	ServertalkBatchTest() {
+		TEST_ADD(ServertalkBatchTest::UnpackBatchTest);
+		TEST_ADD(ServertalkBatchTest::UnpackTruncatedTest);
+		TEST_ADD(ServertalkBatchTest::UnpackOverlongTest);
+		TEST_ADD(ServertalkBatchTest::UnpackBadDeflateTest);
+		TEST_ADD(ServertalkBatchTest::CoalesceTest);
+		TEST_ADD(ServertalkBatchTest::CompressedRoundTripTest);
+	}
+
+	~ServertalkBatchTest() {
+	}
+
+	private:
+	struct Message {
+		uint16_t    opcode;
+		std::string data;
+	};
+
+	struct Frame {
+		EQ::Net::ServertalkPacketType type;
+		std::vector<char>             payload;
+	};
+
+	static void AppendMessage(std::vector<char> &out, uint16_t opcode, const std::string &data) {
+		size_t   offset = out.size();
+		uint32_t length = (uint32_t)data.length();
+		out.resize(offset + 6 + data.length());
+		memcpy(&out[offset], &length, sizeof(uint32_t));
+		memcpy(&out[offset + 4], &opcode, sizeof(uint16_t));
+		if (!data.empty()) {
+			memcpy(&out[offset + 6], data.data(), data.length());
+		}
+	}
+
+	static bool Unpack(EQ::Net::ServertalkPacketType type, std::vector<char> &payload, std::vector<Message> &messages) {
+		std::vector<char>      scratch;
+		EQ::Net::StaticPacket p(payload.empty() ? nullptr : &payload[0], payload.size());
+
+		return EQ::Net::ServertalkBatcher::Unpack(type, p, scratch, [&](EQ::Net::Packet &message) {
+			Message m;
+			m.opcode = message.GetUInt16(4);
+			m.data.assign((const char *)message.Data() + 6, message.Length() - 6);
+			messages.push_back(m);
+		});
+	}
+
+	// splits what the batcher wrote back into frames
+	static std::vector<Frame> SplitFrames(const std::vector<char> &written) {
+		std::vector<Frame> frames;
+
+		size_t offset = 0;
+		while (written.size() - offset >= 5) {
+			uint32_t length = 0;
+			memcpy(&length, &written[offset], sizeof(uint32_t));
+
+			Frame frame;
+			frame.type = (EQ::Net::ServertalkPacketType)written[offset + 4];
+			frame.payload.assign(written.begin() + offset + 5, written.begin() + offset + 5 + length);
+			frames.push_back(frame);
+
+			offset += 5 + length;
+		}
+
+		return frames;
+	}
+
+	void UnpackBatchTest() {
+		std::vector<char> payload;
+		AppendMessage(payload, 0x1001, "first");
+		AppendMessage(payload, 0x1002, "");
+		AppendMessage(payload, 0x1003, "third");
+
+		std::vector<Message> messages;
+		TEST_ASSERT(Unpack(EQ::Net::ServertalkMessageBatch, payload, messages));
+		TEST_ASSERT(messages.size() == 3);
+		if (messages.size() != 3) {
+			return;
+		}
+
+		TEST_ASSERT(messages[0].opcode == 0x1001 && messages[0].data == "first");
+		TEST_ASSERT(messages[1].opcode == 0x1002 && messages[1].data.empty());
+		TEST_ASSERT(messages[2].opcode == 0x1003 && messages[2].data == "third");
+	}
+
+	void UnpackTruncatedTest() {
+		std::vector<char> payload;
+		AppendMessage(payload, 0x1001, "first");
+		AppendMessage(payload, 0x1002, "second");
+
+		// cut inside the second message's header
+		payload.resize(payload.size() - 6 - 3);
+
+		std::vector<Message> messages;
+		TEST_ASSERT(!Unpack(EQ::Net::ServertalkMessageBatch, payload, messages));
+	}
+
+	void UnpackOverlongTest() {
+		std::vector<char> payload;
+		AppendMessage(payload, 0x1001, "short");
+
+		uint32_t declared = 0xFFFFFFF0;
+		memcpy(&payload[0], &declared, sizeof(uint32_t));
+
+		std::vector<Message> messages;
+		TEST_ASSERT(!Unpack(EQ::Net::ServertalkMessageBatch, payload, messages));
+		TEST_ASSERT(messages.empty());
+
+		declared = 6;
+		memcpy(&payload[0], &declared, sizeof(uint32_t));
+		messages.clear();
+		TEST_ASSERT(!Unpack(EQ::Net::ServertalkMessageBatch, payload, messages));
+		TEST_ASSERT(messages.empty());
+	}
+
+	void UnpackBadDeflateTest() {
+		std::vector<Message> messages;
+
+		// too short to hold the inflated length
+		std::vector<char> payload(3, 0);
+		TEST_ASSERT(!Unpack(EQ::Net::ServertalkCompressedBatch, payload, messages));
+
+		// an inflated length past the limit is refused before anything is allocated
+		payload.assign(16, 0);
+		uint32_t raw_length = (uint32_t)EQ::Net::ServertalkBatcher::MaxInflatedSize + 1;
+		memcpy(&payload[0], &raw_length, sizeof(uint32_t));
+		TEST_ASSERT(!Unpack(EQ::Net::ServertalkCompressedBatch, payload, messages));
+
+		// garbage where the deflate stream should be
+		raw_length = 64;
+		memcpy(&payload[0], &raw_length, sizeof(uint32_t));
+		for (size_t i = sizeof(uint32_t); i < payload.size(); ++i) {
+			payload[i] = (char)(0xA5 ^ i);
+		}
+		TEST_ASSERT(!Unpack(EQ::Net::ServertalkCompressedBatch, payload, messages));
+		TEST_ASSERT(messages.empty());
+	}
+
+	void CoalesceTest() {
+		std::vector<char>           written;
+		EQ::Net::ServertalkBatcher batcher([&](const char *data, size_t length) {
+			written.insert(written.end(), data, data + length);
+		});
+
+		batcher.SetBatching(true);
+		batcher.SetPeerCapabilities(EQ::Net::ServertalkBatcher::Capabilities);
+
+		// keyed on the first byte, an empty message has no key and keeps what came before it
+		batcher.SetCoalesce(0x2000, [](const char *data, size_t length, uint64_t &key) {
+			if (length == 0) {
+				return false;
+			}
+
+			key = (uint8_t)data[0];
+			return true;
+		});
+
+		batcher.Queue(0x2000, "a1", 2);
+		batcher.Queue(0x2000, "b1", 2);
+		batcher.Queue(0x3000, "other", 5);
+		batcher.Queue(0x2000, "a2", 2);
+		batcher.Queue(0x2000, "", 0);
+		batcher.Queue(0x2000, "a3", 2);
+		batcher.Flush();
+
+		TEST_ASSERT(batcher.GetMessages() == 6);
+		TEST_ASSERT(batcher.GetCoalesced() == 1);
+
+		auto frames = SplitFrames(written);
+		TEST_ASSERT(frames.size() == 1);
+		if (frames.size() != 1) {
+			return;
+		}
+
+		TEST_ASSERT(frames[0].type == EQ::Net::ServertalkMessageBatch);
+
+		std::vector<Message> messages;
+		TEST_ASSERT(Unpack(frames[0].type, frames[0].payload, messages));
+		TEST_ASSERT(messages.size() == 5);
+		if (messages.size() != 5) {
+			return;
+		}
+
+		TEST_ASSERT(messages[0].data == "b1");
+		TEST_ASSERT(messages[1].opcode == 0x3000 && messages[1].data == "other");
+		TEST_ASSERT(messages[2].data == "a2");
+		TEST_ASSERT(messages[3].data.empty());
+		TEST_ASSERT(messages[4].data == "a3");
+	}
+
+	void CompressedRoundTripTest() {
+		std::vector<char>           written;
+		EQ::Net::ServertalkBatcher batcher([&](const char *data, size_t length) {
+			written.insert(written.end(), data, data + length);
+		});
+
+		batcher.SetBatching(true);
+		batcher.SetCompressThreshold(64);
+		batcher.SetPeerCapabilities(EQ::Net::ServertalkBatcher::Capabilities);
+
+		std::string body(200, 'x');
+		for (uint16_t i = 0; i < 8; ++i) {
+			batcher.Queue(0x4000 + i, body.data(), body.length());
+		}
+		batcher.Flush();
+
+		auto frames = SplitFrames(written);
+		TEST_ASSERT(frames.size() == 1);
+		if (frames.size() != 1) {
+			return;
+		}
+
+		TEST_ASSERT(frames[0].type == EQ::Net::ServertalkCompressedBatch);
+
+		std::vector<Message> messages;
+		TEST_ASSERT(Unpack(frames[0].type, frames[0].payload, messages));
+		TEST_ASSERT(messages.size() == 8);
+		for (size_t i = 0; i < messages.size(); ++i) {
+			TEST_ASSERT(messages[i].opcode == 0x4000 + i && messages[i].data == body);
+		}
+	}
+};
+
+#endif
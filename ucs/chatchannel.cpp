@@ -24,6 +24,7 @@
 #include "database.h"
 #include <cstdlib>
 #include <algorithm>
+#include <memory>
 
 extern Database database;
 extern uint32 ChatMessagesSent;
@@ -59,42 +60,39 @@ ChatChannel::ChatChannel(std::string inName, std::string inOwner, std::string in
 
 ChatChannel::~ChatChannel() {
 
-	LinkedListIterator<Client*> iterator(ClientsInChannel);
+	ClientsInChannel.clear();
 
-	iterator.Reset();
-
-	while(iterator.MoreElements())
-		iterator.RemoveCurrent(false);
+	ClientIndex.clear();
 }
 
 ChatChannel* ChatChannelList::CreateChannel(std::string Name, std::string Owner, std::string Password, bool Permanent, int MinimumStatus) {
 
-	ChatChannel *NewChannel = new ChatChannel(CapitaliseName(Name), Owner, Password, Permanent, MinimumStatus);
+	std::string NormalisedName = CapitaliseName(Name);
 
-	ChatChannels.Insert(NewChannel);
+	auto it = ChatChannels.find(NormalisedName);
 
-	return NewChannel;
-}
+	if(it != ChatChannels.end()) {
 
-ChatChannel* ChatChannelList::FindChannel(std::string Name) {
+		LogInfo("Channel [{}] already exists, not creating it again", NormalisedName.c_str());
 
-	std::string NormalisedName = CapitaliseName(Name);
+		return it->second;
+	}
 
-	LinkedListIterator<ChatChannel*> iterator(ChatChannels);
+	ChatChannel *NewChannel = new ChatChannel(NormalisedName, Owner, Password, Permanent, MinimumStatus);
 
-	iterator.Reset();
+	ChatChannels[NormalisedName] = NewChannel;
 
-	while(iterator.MoreElements()) {
+	return NewChannel;
+}
 
-		ChatChannel *CurrentChannel = iterator.GetData();
+ChatChannel* ChatChannelList::FindChannel(std::string Name) {
 
-		if(CurrentChannel && (CurrentChannel->Name == NormalisedName))
-			return iterator.GetData();
+	auto it = ChatChannels.find(CapitaliseName(Name));
 
-		iterator.Advance();
-	}
+	if(it == ChatChannels.end())
+		return nullptr;
 
-	return nullptr;
+	return it->second;
 }
 
 void ChatChannelList::SendAllChannels(Client *c) {
@@ -110,24 +108,16 @@ void ChatChannelList::SendAllChannels(Client *c) {
 
 	int ChannelsInLine = 0;
 
-	LinkedListIterator<ChatChannel*> iterator(ChatChannels);
-
-	iterator.Reset();
-
 	std::string Message;
 
 	char CountString[10];
 
-	while(iterator.MoreElements()) {
-
-		ChatChannel *CurrentChannel = iterator.GetData();
+	for(auto &it : ChatChannels) {
 
-		if(!CurrentChannel || (CurrentChannel->GetMinStatus() > c->GetAccountStatus())) {
-
-			iterator.Advance();
+		ChatChannel *CurrentChannel = it.second;
 
+		if(!CurrentChannel || (CurrentChannel->GetMinStatus() > c->GetAccountStatus()))
 			continue;
-		}
 
 		if(ChannelsInLine > 0)
 			Message += ", ";
@@ -148,8 +138,6 @@ void ChatChannelList::SendAllChannels(Client *c) {
 
 			Message.clear();
 		}
-
-		iterator.Advance();
 	}
 
 	if(ChannelsInLine > 0)
@@ -161,51 +149,34 @@ void ChatChannelList::RemoveChannel(ChatChannel *Channel) {
 
 	LogDebug("RemoveChannel ([{}])", Channel->GetName().c_str());
 
-	LinkedListIterator<ChatChannel*> iterator(ChatChannels);
-
-	iterator.Reset();
+	auto it = ChatChannels.find(Channel->GetName());
 
-	while(iterator.MoreElements()) {
-
-		if(iterator.GetData() == Channel) {
-
-			iterator.RemoveCurrent();
+	if((it == ChatChannels.end()) || (it->second != Channel))
+		return;
 
-			return;
-		}
+	ChatChannels.erase(it);
 
-		iterator.Advance();
-	}
+	safe_delete(Channel);
 }
 
 void ChatChannelList::RemoveAllChannels() {
 
 	LogDebug("RemoveAllChannels");
 
-	LinkedListIterator<ChatChannel*> iterator(ChatChannels);
-
-	iterator.Reset();
+	for(auto &it : ChatChannels)
+		safe_delete(it.second);
 
-	while(iterator.MoreElements())
-		iterator.RemoveCurrent();
+	ChatChannels.clear();
 }
 
 int ChatChannel::MemberCount(int Status) {
 
 	int Count = 0;
 
-	LinkedListIterator<Client*> iterator(ClientsInChannel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
+	for(auto ChannelClient : ClientsInChannel) {
 
-		Client *ChannelClient = iterator.GetData();
-
-		if(ChannelClient && (!ChannelClient->GetHideMe() || (ChannelClient->GetAccountStatus() < Status)))
+		if(!ChannelClient->GetHideMe() || (ChannelClient->GetAccountStatus() < Status))
 			Count++;
-
-		iterator.Advance();
 	}
 
 	return Count;
@@ -249,22 +220,16 @@ void ChatChannel::AddClient(Client *c) {
 
 	LogDebug("Adding [{}] to channel [{}]", c->GetName().c_str(), Name.c_str());
 
-	LinkedListIterator<Client*> iterator(ClientsInChannel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
+	for(auto CurrentClient : ClientsInChannel) {
 
-		Client *CurrentClient = iterator.GetData();
-
-		if(CurrentClient && CurrentClient->IsAnnounceOn())
+		if(CurrentClient->IsAnnounceOn())
 			if(!HideMe || (CurrentClient->GetAccountStatus() > AccountStatus))
 				CurrentClient->AnnounceJoin(this, c);
-
-		iterator.Advance();
 	}
 
-	ClientsInChannel.Insert(c);
+	ClientIndex[c] = ClientsInChannel.size();
+
+	ClientsInChannel.push_back(c);
 
 }
 
@@ -278,30 +243,29 @@ bool ChatChannel::RemoveClient(Client *c) {
 
 	int AccountStatus = c->GetAccountStatus();
 
-	int PlayersInChannel = 0;
+	auto Member = ClientIndex.find(c);
 
-	LinkedListIterator<Client*> iterator(ClientsInChannel);
+	if(Member != ClientIndex.end()) {
 
-	iterator.Reset();
+		// swap the last member into the hole so removal doesn't shift the whole list
+		size_t Slot = Member->second;
 
-	while(iterator.MoreElements()) {
+		ClientsInChannel[Slot] = ClientsInChannel.back();
 
-		Client *CurrentClient = iterator.GetData();
+		ClientIndex[ClientsInChannel[Slot]] = Slot;
 
-		if(CurrentClient == c) {
-			iterator.RemoveCurrent(false);
-		}
-		else if(CurrentClient) {
+		ClientsInChannel.pop_back();
 
-			PlayersInChannel++;
+		ClientIndex.erase(c);
+	}
 
-			if(CurrentClient->IsAnnounceOn())
-				if(!HideMe || (CurrentClient->GetAccountStatus() > AccountStatus))
-					CurrentClient->AnnounceLeave(this, c);
+	int PlayersInChannel = ClientsInChannel.size();
 
-			iterator.Advance();
-		}
+	for(auto CurrentClient : ClientsInChannel) {
 
+		if(CurrentClient->IsAnnounceOn())
+			if(!HideMe || (CurrentClient->GetAccountStatus() > AccountStatus))
+				CurrentClient->AnnounceLeave(this, c);
 	}
 
 	if((PlayersInChannel == 0) && !Permanent) {
@@ -350,20 +314,12 @@ void ChatChannel::SendChannelMembers(Client *c) {
 
 	int MembersInLine = 0;
 
-	LinkedListIterator<Client*> iterator(ClientsInChannel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
-
-		Client *ChannelClient = iterator.GetData();
+	for(auto ChannelClient : ClientsInChannel) {
 
 		// Don't list hidden characters with status higher or equal than the character requesting the list.
 		//
-		if(!ChannelClient || (ChannelClient->GetHideMe() && (ChannelClient->GetAccountStatus() >= AccountStatus))) {
-			iterator.Advance();
+		if(ChannelClient->GetHideMe() && (ChannelClient->GetAccountStatus() >= AccountStatus))
 			continue;
-		}
 
 		if(MembersInLine > 0)
 			Message += ", ";
@@ -380,8 +336,6 @@ void ChatChannel::SendChannelMembers(Client *c) {
 
 			Message.clear();
 		}
-
-		iterator.Advance();
 	}
 
 	if(MembersInLine > 0)
@@ -393,47 +347,43 @@ void ChatChannel::SendMessageToChannel(std::string Message, Client* Sender) {
 
 	if(!Sender) return;
 
-	std::string cv_messages[EQ::versions::ClientVersionCount];
+	// one packet per client version, every member on that version is queued the same packet
+	std::unique_ptr<EQApplicationPacket> cv_packets[EQ::versions::ClientVersionCount];
 
 	ChatMessagesSent++;
 
-	LinkedListIterator<Client*> iterator(ClientsInChannel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
-
-		Client *ChannelClient = iterator.GetData();
-
-		if(ChannelClient)
-		{
-			LogDebug("Sending message to [{}] from [{}]",
-				ChannelClient->GetName().c_str(), Sender->GetName().c_str());
-
-			if (cv_messages[static_cast<uint32>(ChannelClient->GetClientVersion())].length() == 0) {
-				switch (ChannelClient->GetClientVersion()) {
-				case EQ::versions::ClientVersion::Titanium:
-					ServerToClient45SayLink(cv_messages[static_cast<uint32>(ChannelClient->GetClientVersion())], Message);
-					break;
-				case EQ::versions::ClientVersion::SoF:
-				case EQ::versions::ClientVersion::SoD:
-				case EQ::versions::ClientVersion::UF:
-					ServerToClient50SayLink(cv_messages[static_cast<uint32>(ChannelClient->GetClientVersion())], Message);
-					break;
-				case EQ::versions::ClientVersion::RoF:
-					ServerToClient55SayLink(cv_messages[static_cast<uint32>(ChannelClient->GetClientVersion())], Message);
-					break;
-				case EQ::versions::ClientVersion::RoF2:
-				default:
-					cv_messages[static_cast<uint32>(ChannelClient->GetClientVersion())] = Message;
-					break;
-				}
+	LogDebug("Sending message to [{}] members of [{}] from [{}]",
+		ClientsInChannel.size(), Name.c_str(), Sender->GetName().c_str());
+
+	for(auto ChannelClient : ClientsInChannel) {
+
+		uint32 cv = static_cast<uint32>(ChannelClient->GetClientVersion());
+
+		if (!cv_packets[cv]) {
+			std::string cv_message;
+
+			switch (ChannelClient->GetClientVersion()) {
+			case EQ::versions::ClientVersion::Titanium:
+				ServerToClient45SayLink(cv_message, Message);
+				break;
+			case EQ::versions::ClientVersion::SoF:
+			case EQ::versions::ClientVersion::SoD:
+			case EQ::versions::ClientVersion::UF:
+				ServerToClient50SayLink(cv_message, Message);
+				break;
+			case EQ::versions::ClientVersion::RoF:
+				ServerToClient55SayLink(cv_message, Message);
+				break;
+			case EQ::versions::ClientVersion::RoF2:
+			default:
+				cv_message = Message;
+				break;
 			}
 
-			ChannelClient->SendChannelMessage(Name, cv_messages[static_cast<uint32>(ChannelClient->GetClientVersion())], Sender);
+			cv_packets[cv].reset(Client::MakeChannelMessagePacket(Name, cv_message, Sender, ChannelClient->IsUnderfootOrLater()));
 		}
 
-		iterator.Advance();
+		ChannelClient->QueuePacket(cv_packets[cv].get());
 	}
 }
 
@@ -441,23 +391,12 @@ void ChatChannel::SetModerated(bool inModerated) {
 
 	Moderated = inModerated;
 
-	LinkedListIterator<Client*> iterator(ClientsInChannel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
-
-		Client *ChannelClient = iterator.GetData();
-
-		if(ChannelClient) {
+	for(auto ChannelClient : ClientsInChannel) {
 
-			if(Moderated)
-				ChannelClient->GeneralChannelMessage("Channel " + Name + " is now moderated.");
-			else
-				ChannelClient->GeneralChannelMessage("Channel " + Name + " is no longer moderated.");
-		}
-
-		iterator.Advance();
+		if(Moderated)
+			ChannelClient->GeneralChannelMessage("Channel " + Name + " is now moderated.");
+		else
+			ChannelClient->GeneralChannelMessage("Channel " + Name + " is no longer moderated.");
 	}
 
 }
@@ -465,19 +404,7 @@ bool ChatChannel::IsClientInChannel(Client *c) {
 
 	if(!c) return false;
 
-	LinkedListIterator<Client*> iterator(ClientsInChannel);
-
-	iterator.Reset();
-
-	while(iterator.MoreElements()) {
-
-		if(iterator.GetData() == c)
-			return true;
-
-		iterator.Advance();
-	}
-
-	return false;
+	return ClientIndex.find(c) != ClientIndex.end();
 }
 
 ChatChannel *ChatChannelList::AddClientToChannel(std::string ChannelName, Client *c) {
@@ -576,24 +503,25 @@ ChatChannel *ChatChannelList::RemoveClientFromChannel(std::string inChannelName,
 
 void ChatChannelList::Process() {
 
-	LinkedListIterator<ChatChannel*> iterator(ChatChannels);
+	auto it = ChatChannels.begin();
 
-	iterator.Reset();
+	while(it != ChatChannels.end()) {
 
-	while(iterator.MoreElements()) {
-
-		ChatChannel *CurrentChannel = iterator.GetData();
+		ChatChannel *CurrentChannel = it->second;
 
 		if(CurrentChannel && CurrentChannel->ReadyToDelete()) {
 
 			LogDebug("Empty temporary password protected channel [{}] being destroyed",
 				CurrentChannel->GetName().c_str());
 
-			RemoveChannel(CurrentChannel);
-		}
+			safe_delete(CurrentChannel);
 
-		iterator.Advance();
+			it = ChatChannels.erase(it);
+
+			continue;
+		}
 
+		++it;
 	}
 }
 
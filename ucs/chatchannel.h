@@ -2,9 +2,9 @@
 #define CHATCHANNEL_H
 
 //#include "clientlist.h"
-#include "../common/linked_list.h"
 #include "../common/timer.h"
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class Client;
@@ -58,7 +58,10 @@ private:
 
 	Timer DeleteTimer;
 
-	LinkedList<Client*> ClientsInChannel;
+	// members for fan-out in no particular order (removal swaps the last member into the gap),
+	// indexed by client for membership checks and removal
+	std::vector<Client*> ClientsInChannel;
+	std::unordered_map<Client*, size_t> ClientIndex;
 
 	std::vector<std::string> Moderators;
 	std::vector<std::string> Invitees;
@@ -81,7 +84,8 @@ public:
 
 private:
 
-	LinkedList<ChatChannel*> ChatChannels;
+	// keyed by the CapitaliseName form of the channel name
+	std::unordered_map<std::string, ChatChannel*> ChatChannels;
 
 };
 
@@ -1468,6 +1468,15 @@ void Client::SendChannelMessage(std::string ChannelName, std::string Message, Cl
 
 	if (!Sender) return;
 
+	auto outapp = MakeChannelMessagePacket(ChannelName, Message, Sender, UnderfootOrLater);
+
+	QueuePacket(outapp);
+
+	safe_delete(outapp);
+}
+
+EQApplicationPacket *Client::MakeChannelMessagePacket(const std::string &ChannelName, const std::string &Message, Client *Sender, bool UnderfootOrLater) {
+
 	std::string FQSenderName = WorldShortName + "." + Sender->GetName();
 
 	int PacketLength = ChannelName.length() + Message.length() + FQSenderName.length() + 3;
@@ -1486,9 +1495,7 @@ void Client::SendChannelMessage(std::string ChannelName, std::string Message, Cl
 	if (UnderfootOrLater)
 		VARSTRUCT_ENCODE_STRING(PacketBuffer, "SPAM:0:");
 
-	QueuePacket(outapp);
-
-	safe_delete(outapp);
+	return outapp;
 }
 
 void Client::ToggleAnnounce(std::string State)
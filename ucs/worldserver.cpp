@@ -22,6 +22,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 #include "../common/packet_functions.h"
 #include "../common/md5.h"
 #include "../common/string_util.h"
+#include "../common/rulesys.h"
 #include "worldserver.h"
 #include "clientlist.h"
 #include "ucsconfig.h"
@@ -49,6 +50,7 @@ void Client55ToServerSayLink(std::string& serverSayLink, const std::string& clie
 WorldServer::WorldServer()
 {
 	m_connection = std::make_unique<EQ::Net::ServertalkClient>(Config->WorldIP, Config->WorldTCPPort, false, "UCS", Config->SharedKey);
+	m_connection->SetBatching(RuleB(Network, ServertalkBatching));
 	m_connection->OnMessage(std::bind(&WorldServer::ProcessMessage, this, std::placeholders::_1, std::placeholders::_2));
 }
 
@@ -0,0 +1,324 @@
+/**
+ * EQEmulator: Everquest Server Emulator
+ * Copyright (C) 2001-2018 EQEmulator Development Team (https://github.com/EQEmu/Server)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY except by those people which sell it, which
+ * are required to give you total support for your newly bought product;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+*/
+
+/**
+ * Renders or filters the .binlog files written by the binary log sink (log_to_binary)
+ *
+ * log_decoder [options] <file.binlog> [file.binlog ...]
+ *
+ *   -c <category>   only entries in this category, id or name, may be repeated
+ *   -l <level>      only entries at or below this debug level (1-3)
+ *   -g <text>       only entries whose rendered text contains text
+ *   -s              summary of entries and bytes per call site instead of the entries
+ *   -w              include the source file and line for each entry
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <fmt/format.h>
+
+#include "../../common/binary_log_reader.h"
+
+using BinaryLog::LogArg;
+using BinaryLog::RecordReader;
+
+struct LogFormat {
+	uint8       style;
+	std::string file;
+	std::string func;
+	uint64      line;
+	std::string text;
+	uint64      entries;
+	uint64      bytes;
+	uint64      category;
+};
+
+struct DecoderOptions {
+	std::set<std::string> categories;
+	int                   max_level  = 3;
+	std::string           grep;
+	bool                  summary    = false;
+	bool                  show_where = false;
+};
+
+std::string FormatTime(uint64 time_ms)
+{
+	time_t    seconds = static_cast<time_t>(time_ms / 1000);
+	struct tm *local  = localtime(&seconds);
+	char      stamp[80];
+
+	if (!local || !strftime(stamp, sizeof(stamp), "%m-%d-%Y %H:%M:%S", local)) {
+		return std::to_string(time_ms);
+	}
+
+	return fmt::format("{}.{:03}", stamp, time_ms % 1000);
+}
+
+bool LoadFile(const char *file_name, std::string &data)
+{
+	FILE *f = fopen(file_name, "rb");
+	if (!f) {
+		return false;
+	}
+
+	char   buffer[64 * 1024];
+	size_t read = 0;
+	while ((read = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+		data.append(buffer, read);
+	}
+
+	fclose(f);
+	return true;
+}
+
+/**
+ * @param file_name
+ * @param options
+ * @return
+ */
+bool DecodeFile(const char *file_name, const DecoderOptions &options)
+{
+	std::string data;
+	if (!LoadFile(file_name, data)) {
+		fprintf(stderr, "Unable to open %s\n", file_name);
+		return false;
+	}
+
+	const size_t header_size = sizeof(BinaryLog::Magic) + sizeof(uint16);
+	if (data.size() < header_size || memcmp(data.data(), BinaryLog::Magic, sizeof(BinaryLog::Magic)) != 0) {
+		fprintf(stderr, "%s is not a binary log\n", file_name);
+		return false;
+	}
+
+	uint16 version = static_cast<uint8>(data[4]) | (static_cast<uint8>(data[5]) << 8);
+	if (version > BinaryLog::Version) {
+		fprintf(stderr, "%s is binary log version %u, this decoder reads up to %u\n", file_name, version, BinaryLog::Version);
+		return false;
+	}
+
+	std::map<uint64, std::string> categories;
+	std::map<uint64, LogFormat>   formats;
+	std::vector<LogArg>           args;
+	uint64                        entries = 0;
+
+	size_t pos = header_size;
+	while (pos < data.size()) {
+		RecordReader header(data.data() + pos, data.size() - pos);
+		uint8        type   = header.GetByte();
+		uint64       length = header.GetVarint();
+		size_t       used   = header.Position();
+
+		// a record the writer never finished, nothing after it can be trusted
+		if (!header.Ok() || length > data.size() - pos - used) {
+			break;
+		}
+
+		RecordReader record(data.data() + pos + used, static_cast<size_t>(length));
+		pos += used + static_cast<size_t>(length);
+
+		switch (type) {
+			case BinaryLog::RecordProcess: {
+				uint64      pid      = record.GetVarint();
+				std::string platform = record.GetString();
+				uint64      started  = record.GetVarint();
+				if (!options.summary) {
+					printf("# %s pid %llu started %s\n", platform.c_str(), (unsigned long long) pid, FormatTime(started).c_str());
+				}
+				break;
+			}
+			case BinaryLog::RecordCategory: {
+				uint64 id = record.GetVarint();
+				categories[id] = record.GetString();
+				break;
+			}
+			case BinaryLog::RecordFormat: {
+				uint64    id = record.GetVarint();
+				LogFormat format;
+				format.style    = record.GetByte();
+				format.file     = record.GetString();
+				format.func     = record.GetString();
+				format.line     = record.GetVarint();
+				format.text     = record.GetString();
+				format.entries  = 0;
+				format.bytes    = 0;
+				format.category = 0;
+				formats[id] = format;
+				break;
+			}
+			case BinaryLog::RecordEntry: {
+				uint64 time_ms     = record.GetVarint();
+				uint64 format_id   = record.GetVarint();
+				uint64 category    = record.GetVarint();
+				int    debug_level = record.GetByte();
+				int    arg_count   = record.GetByte();
+
+				auto format = formats.find(format_id);
+				if (!record.Ok() || format == formats.end()) {
+					break;
+				}
+
+				format->second.entries++;
+				format->second.bytes += used + length;
+				format->second.category = category;
+				++entries;
+
+				if (options.summary || debug_level > options.max_level) {
+					break;
+				}
+
+				std::string category_name = categories.count(category) ? categories[category] : std::to_string(category);
+				if (!options.categories.empty() &&
+					!options.categories.count(category_name) &&
+					!options.categories.count(std::to_string(category))) {
+					break;
+				}
+
+				args.resize(arg_count);
+				bool ok = true;
+				for (auto &arg : args) {
+					if (!BinaryLog::ReadArg(record, arg)) {
+						ok = false;
+						break;
+					}
+				}
+
+				if (!ok) {
+					break;
+				}
+
+				std::string message = format->second.style == BinaryLog::StylePrintf
+					? BinaryLog::RenderPrintf(format->second.text, args)
+					: BinaryLog::RenderFmt(format->second.text, args);
+
+				if (!options.grep.empty() && message.find(options.grep) == std::string::npos) {
+					break;
+				}
+
+				if (options.show_where) {
+					printf(
+						"[%s] [%s] [%s:%llu] %s\n",
+						FormatTime(time_ms).c_str(),
+						category_name.c_str(),
+						format->second.file.c_str(),
+						(unsigned long long) format->second.line,
+						message.c_str()
+					);
+				}
+				else {
+					printf("[%s] [%s] %s\n", FormatTime(time_ms).c_str(), category_name.c_str(), message.c_str());
+				}
+				break;
+			}
+			default:
+				break;
+		}
+	}
+
+	if (options.summary) {
+		std::vector<const LogFormat *> sites;
+		for (auto &f : formats) {
+			sites.push_back(&f.second);
+		}
+
+		std::sort(
+			sites.begin(), sites.end(), [](const LogFormat *a, const LogFormat *b) {
+				return a->bytes > b->bytes;
+			}
+		);
+
+		printf("%s: %llu entries, %zu bytes\n", file_name, (unsigned long long) entries, data.size());
+		printf("%10s %10s  %-20s %s\n", "entries", "bytes", "category", "call site");
+		for (auto site : sites) {
+			std::string category_name = categories.count(site->category) ? categories[site->category] : "";
+			printf(
+				"%10llu %10llu  %-20s %s:%llu %s\n",
+				(unsigned long long) site->entries,
+				(unsigned long long) site->bytes,
+				category_name.c_str(),
+				site->file.c_str(),
+				(unsigned long long) site->line,
+				site->text.c_str()
+			);
+		}
+	}
+
+	return true;
+}
+
+void PrintUsage()
+{
+	printf("Usage: log_decoder [options] <file.binlog> [file.binlog ...]\n");
+	printf("  -c <category>  only entries in this category, id or name, may be repeated\n");
+	printf("  -l <level>     only entries at or below this debug level (1-3)\n");
+	printf("  -g <text>      only entries whose rendered text contains text\n");
+	printf("  -s             summary of entries and bytes per call site\n");
+	printf("  -w             include the source file and line for each entry\n");
+}
+
+int main(int argc, char **argv)
+{
+	DecoderOptions           options;
+	std::vector<const char *> files;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		if (arg == "-c" && i + 1 < argc) {
+			options.categories.insert(argv[++i]);
+		}
+		else if (arg == "-l" && i + 1 < argc) {
+			options.max_level = atoi(argv[++i]);
+		}
+		else if (arg == "-g" && i + 1 < argc) {
+			options.grep = argv[++i];
+		}
+		else if (arg == "-s") {
+			options.summary = true;
+		}
+		else if (arg == "-w") {
+			options.show_where = true;
+		}
+		else if (!arg.empty() && arg[0] == '-') {
+			PrintUsage();
+			return 1;
+		}
+		else {
+			files.push_back(argv[i]);
+		}
+	}
+
+	if (files.empty()) {
+		PrintUsage();
+		return 1;
+	}
+
+	bool ok = true;
+	for (auto file : files) {
+		ok = DecodeFile(file, options) && ok;
+	}
+
+	return ok ? 0 : 1;
+}
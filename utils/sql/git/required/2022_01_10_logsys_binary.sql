@@ -0,0 +1 @@
+ALTER TABLE `logsys_categories` ADD `log_to_binary` SMALLINT(11) NOT NULL DEFAULT 0 AFTER `log_to_gmsay`;
@@ -0,0 +1,642 @@
+/**
+ * EQEmulator: Everquest Server Emulator
+ * Copyright (C) 2001-2020 EQEmulator Development Team (https://github.com/EQEmu/Server)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY except by those people which sell it, which
+ * are required to give you total support for your newly bought product;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ */
+
+#include "client_list_index.h"
+#include "cliententry.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+/**
+ * @param cle
+ * @param at_front
+ */
+void ClientListIndex::Add(ClientListEntry *cle, bool at_front)
+{
+	if (m_entries.find(cle) != m_entries.end()) {
+		return;
+	}
+
+	Keys keys;
+	keys.order        = at_front ? --m_front_order : m_back_order++;
+	keys.name         = ToLower(cle->name());
+	keys.account_id   = cle->AccountID();
+	keys.character_id = cle->CharID();
+	keys.ls_id        = cle->LSID();
+	keys.ip           = cle->GetIP();
+
+	Slot slot{keys.order, cle};
+
+	m_by_id[cle->GetID()] = cle;
+	Insert(m_by_name, keys.name, slot);
+	Insert(m_by_account_id, keys.account_id, slot);
+	Insert(m_by_character_id, keys.character_id, slot);
+	Insert(m_by_ls_id, keys.ls_id, slot);
+	Insert(m_by_ip, keys.ip, slot);
+	SetColumns(cle, keys);
+
+	m_entries.emplace(cle, std::move(keys));
+}
+
+/**
+ * @param cle
+ */
+void ClientListIndex::Remove(ClientListEntry *cle)
+{
+	auto iter = m_entries.find(cle);
+	if (iter == m_entries.end()) {
+		return;
+	}
+
+	const Keys &keys = iter->second;
+
+	auto by_id = m_by_id.find(cle->GetID());
+	if (by_id != m_by_id.end() && by_id->second == cle) {
+		m_by_id.erase(by_id);
+	}
+
+	Erase(m_by_name, keys.name, cle);
+	Erase(m_by_account_id, keys.account_id, cle);
+	Erase(m_by_character_id, keys.character_id, cle);
+	Erase(m_by_ls_id, keys.ls_id, cle);
+	Erase(m_by_ip, keys.ip, cle);
+	ClearColumns(keys);
+
+	m_entries.erase(iter);
+}
+
+/**
+ * Entries that aren't in the list yet (still being constructed) or anymore (being deleted) are ignored
+ *
+ * @param cle
+ */
+void ClientListIndex::Update(ClientListEntry *cle)
+{
+	auto iter = m_entries.find(cle);
+	if (iter == m_entries.end()) {
+		return;
+	}
+
+	Keys &keys = iter->second;
+	Slot slot{keys.order, cle};
+
+	if (strcasecmp(keys.name.c_str(), cle->name()) != 0) {
+		Erase(m_by_name, keys.name, cle);
+		keys.name = ToLower(cle->name());
+		Insert(m_by_name, keys.name, slot);
+	}
+
+	if (keys.account_id != cle->AccountID()) {
+		Erase(m_by_account_id, keys.account_id, cle);
+		keys.account_id = cle->AccountID();
+		Insert(m_by_account_id, keys.account_id, slot);
+	}
+
+	if (keys.character_id != cle->CharID()) {
+		Erase(m_by_character_id, keys.character_id, cle);
+		keys.character_id = cle->CharID();
+		Insert(m_by_character_id, keys.character_id, slot);
+	}
+
+	if (keys.ls_id != cle->LSID()) {
+		Erase(m_by_ls_id, keys.ls_id, cle);
+		keys.ls_id = cle->LSID();
+		Insert(m_by_ls_id, keys.ls_id, slot);
+	}
+
+	if (keys.ip != cle->GetIP()) {
+		Erase(m_by_ip, keys.ip, cle);
+		keys.ip = cle->GetIP();
+		Insert(m_by_ip, keys.ip, slot);
+	}
+
+	UpdateColumns(cle, keys);
+}
+
+void ClientListIndex::Clear()
+{
+	m_entries.clear();
+	m_by_id.clear();
+	m_by_name.clear();
+	m_by_account_id.clear();
+	m_by_character_id.clear();
+	m_by_ls_id.clear();
+	m_by_ip.clear();
+	m_slots.clear();
+	m_slot_order.clear();
+	m_free_slots.clear();
+	m_class_column.clear();
+	m_race_column.clear();
+	m_level_column.clear();
+	m_zone_column.clear();
+	m_guild_column.clear();
+	m_in_world.clear();
+	m_lfg.clear();
+	m_front_order = 0;
+	m_back_order  = 0;
+}
+
+/**
+ * @param id
+ * @return
+ */
+ClientListEntry *ClientListIndex::GetByID(uint32 id) const
+{
+	auto iter = m_by_id.find(id);
+	return iter != m_by_id.end() ? iter->second : nullptr;
+}
+
+/**
+ * @param name
+ * @return
+ */
+ClientListEntry *ClientListIndex::FindByName(const char *name) const
+{
+	return First(m_by_name, ToLower(name));
+}
+
+/**
+ * @param account_id
+ * @return
+ */
+ClientListEntry *ClientListIndex::FindByAccountID(uint32 account_id) const
+{
+	return First(m_by_account_id, account_id);
+}
+
+/**
+ * @param character_id
+ * @return
+ */
+ClientListEntry *ClientListIndex::FindByCharacterID(uint32 character_id) const
+{
+	return First(m_by_character_id, character_id);
+}
+
+/**
+ * @param ls_id
+ * @return
+ */
+ClientListEntry *ClientListIndex::FindByLSID(uint32 ls_id) const
+{
+	return First(m_by_ls_id, ls_id);
+}
+
+/**
+ * @param character_id
+ * @param into
+ */
+void ClientListIndex::GetByCharacterID(uint32 character_id, std::vector<ClientListEntry *> &into) const
+{
+	All(m_by_character_id, character_id, into);
+}
+
+/**
+ * @param ls_id
+ * @param into
+ */
+void ClientListIndex::GetByLSID(uint32 ls_id, std::vector<ClientListEntry *> &into) const
+{
+	All(m_by_ls_id, ls_id, into);
+}
+
+/**
+ * @param ip
+ * @param into
+ */
+void ClientListIndex::GetByIP(uint32 ip, std::vector<ClientListEntry *> &into) const
+{
+	All(m_by_ip, ip, into);
+}
+
+/**
+ * @param selection
+ * @param class_id
+ */
+void ClientListIndex::IntersectClass(Bitmap &selection, uint8 class_id) const
+{
+	IntersectColumn(selection, m_class_column, class_id);
+}
+
+/**
+ * @param selection
+ * @param class_mask
+ */
+void ClientListIndex::IntersectClassMask(Bitmap &selection, uint32 class_mask) const
+{
+	Bitmap classes;
+	for (auto &column : m_class_column) {
+		if (column.first < 32 && (class_mask & (1u << column.first))) {
+			Union(classes, column.second);
+		}
+	}
+
+	Intersect(selection, classes);
+}
+
+/**
+ * @param selection
+ * @param race_id
+ */
+void ClientListIndex::IntersectRace(Bitmap &selection, uint16 race_id) const
+{
+	IntersectColumn(selection, m_race_column, race_id);
+}
+
+/**
+ * @param selection
+ * @param low
+ * @param high
+ */
+void ClientListIndex::IntersectLevels(Bitmap &selection, uint32 low, uint32 high) const
+{
+	Bitmap levels;
+	for (auto &column : m_level_column) {
+		uint32 bucket_low  = column.first * LevelBucketSize;
+		uint32 bucket_high = bucket_low + LevelBucketSize - 1;
+		if (bucket_high >= low && bucket_low <= high) {
+			Union(levels, column.second);
+		}
+	}
+
+	Intersect(selection, levels);
+}
+
+/**
+ * @param into
+ */
+void ClientListIndex::GetZoneIDs(std::vector<uint32> &into) const
+{
+	for (auto &column : m_zone_column) {
+		into.push_back(column.first);
+	}
+}
+
+/**
+ * @param into
+ */
+void ClientListIndex::GetGuildIDs(std::vector<uint32> &into) const
+{
+	for (auto &column : m_guild_column) {
+		into.push_back(column.first);
+	}
+}
+
+/**
+ * @param selection
+ * @param into
+ */
+void ClientListIndex::Resolve(const Bitmap &selection, std::vector<ClientListEntry *> &into) const
+{
+	std::vector<std::pair<int64, ClientListEntry *>> selected;
+
+	for (size_t word = 0; word < selection.size(); ++word) {
+		uint64 bits = selection[word];
+		while (bits) {
+			uint32 bit  = 0;
+			uint64 scan = bits;
+			while (!(scan & 1)) {
+				scan >>= 1;
+				++bit;
+			}
+
+			bits &= bits - 1;
+
+			uint32 slot = static_cast<uint32>(word * 64 + bit);
+			if (slot < m_slots.size() && m_slots[slot]) {
+				selected.emplace_back(m_slot_order[slot], m_slots[slot]);
+			}
+		}
+	}
+
+	std::sort(
+		selected.begin(), selected.end(), [](const std::pair<int64, ClientListEntry *> &a, const std::pair<int64, ClientListEntry *> &b) {
+			return a.first < b.first;
+		}
+	);
+
+	for (auto &entry : selected) {
+		into.push_back(entry.second);
+	}
+}
+
+/**
+ * Gives the entry a slot and sets its bit in every column
+ *
+ * @param cle
+ * @param keys
+ */
+void ClientListIndex::SetColumns(ClientListEntry *cle, Keys &keys)
+{
+	if (!m_free_slots.empty()) {
+		keys.slot = m_free_slots.back();
+		m_free_slots.pop_back();
+		m_slots[keys.slot]      = cle;
+		m_slot_order[keys.slot] = keys.order;
+	}
+	else {
+		keys.slot = static_cast<uint32>(m_slots.size());
+		m_slots.push_back(cle);
+		m_slot_order.push_back(keys.order);
+	}
+
+	keys.class_id     = cle->class_();
+	keys.race_id      = cle->race();
+	keys.level_bucket = cle->level() / LevelBucketSize;
+	keys.zone_id      = cle->zone();
+	keys.guild_id     = cle->GuildID();
+	keys.in_world     = cle->Online() >= CLE_Status::Zoning;
+	keys.lfg          = cle->LFG();
+
+	SetBit(m_class_column[keys.class_id], keys.slot);
+	SetBit(m_race_column[keys.race_id], keys.slot);
+	SetBit(m_level_column[keys.level_bucket], keys.slot);
+	SetBit(m_zone_column[keys.zone_id], keys.slot);
+	SetBit(m_guild_column[keys.guild_id], keys.slot);
+
+	if (keys.in_world) {
+		SetBit(m_in_world, keys.slot);
+	}
+
+	if (keys.lfg) {
+		SetBit(m_lfg, keys.slot);
+	}
+}
+
+/**
+ * @param keys
+ */
+void ClientListIndex::ClearColumns(const Keys &keys)
+{
+	RemoveBit(m_class_column, keys.class_id, keys.slot);
+	RemoveBit(m_race_column, keys.race_id, keys.slot);
+	RemoveBit(m_level_column, keys.level_bucket, keys.slot);
+	RemoveBit(m_zone_column, keys.zone_id, keys.slot);
+	RemoveBit(m_guild_column, keys.guild_id, keys.slot);
+	ClearBit(m_in_world, keys.slot);
+	ClearBit(m_lfg, keys.slot);
+
+	m_slots[keys.slot] = nullptr;
+	m_free_slots.push_back(keys.slot);
+}
+
+/**
+ * @param cle
+ * @param keys
+ */
+void ClientListIndex::UpdateColumns(ClientListEntry *cle, Keys &keys)
+{
+	uint8  class_id     = cle->class_();
+	uint16 race_id      = cle->race();
+	uint8  level_bucket = cle->level() / LevelBucketSize;
+	uint32 zone_id      = cle->zone();
+	uint32 guild_id     = cle->GuildID();
+	bool   in_world     = cle->Online() >= CLE_Status::Zoning;
+	bool   lfg          = cle->LFG();
+
+	if (class_id != keys.class_id) {
+		MoveBit(m_class_column, keys.class_id, class_id, keys.slot);
+		keys.class_id = class_id;
+	}
+
+	if (race_id != keys.race_id) {
+		MoveBit(m_race_column, keys.race_id, race_id, keys.slot);
+		keys.race_id = race_id;
+	}
+
+	if (level_bucket != keys.level_bucket) {
+		MoveBit(m_level_column, keys.level_bucket, level_bucket, keys.slot);
+		keys.level_bucket = level_bucket;
+	}
+
+	if (zone_id != keys.zone_id) {
+		MoveBit(m_zone_column, keys.zone_id, zone_id, keys.slot);
+		keys.zone_id = zone_id;
+	}
+
+	if (guild_id != keys.guild_id) {
+		MoveBit(m_guild_column, keys.guild_id, guild_id, keys.slot);
+		keys.guild_id = guild_id;
+	}
+
+	if (in_world != keys.in_world) {
+		in_world ? SetBit(m_in_world, keys.slot) : ClearBit(m_in_world, keys.slot);
+		keys.in_world = in_world;
+	}
+
+	if (lfg != keys.lfg) {
+		lfg ? SetBit(m_lfg, keys.slot) : ClearBit(m_lfg, keys.slot);
+		keys.lfg = lfg;
+	}
+}
+
+/**
+ * @param bitmap
+ * @param slot
+ */
+void ClientListIndex::SetBit(Bitmap &bitmap, uint32 slot)
+{
+	size_t word = slot / 64;
+	if (word >= bitmap.size()) {
+		bitmap.resize(word + 1, 0);
+	}
+
+	bitmap[word] |= (uint64(1) << (slot % 64));
+}
+
+/**
+ * @param bitmap
+ * @param slot
+ */
+void ClientListIndex::ClearBit(Bitmap &bitmap, uint32 slot)
+{
+	size_t word = slot / 64;
+	if (word < bitmap.size()) {
+		bitmap[word] &= ~(uint64(1) << (slot % 64));
+	}
+}
+
+/**
+ * @param selection
+ * @param other
+ */
+void ClientListIndex::Intersect(Bitmap &selection, const Bitmap &other)
+{
+	if (selection.size() > other.size()) {
+		selection.resize(other.size());
+	}
+
+	for (size_t word = 0; word < selection.size(); ++word) {
+		selection[word] &= other[word];
+	}
+}
+
+/**
+ * @param selection
+ * @param other
+ */
+void ClientListIndex::Union(Bitmap &selection, const Bitmap &other)
+{
+	if (selection.size() < other.size()) {
+		selection.resize(other.size(), 0);
+	}
+
+	for (size_t word = 0; word < other.size(); ++word) {
+		selection[word] |= other[word];
+	}
+}
+
+/**
+ * An emptied value is dropped so GetZoneIDs and GetGuildIDs only report values someone still has
+ *
+ * @param column
+ * @param key
+ * @param slot
+ */
+template<typename Key>
+void ClientListIndex::RemoveBit(std::unordered_map<Key, Bitmap> &column, const Key &key, uint32 slot)
+{
+	auto iter = column.find(key);
+	if (iter == column.end()) {
+		return;
+	}
+
+	ClearBit(iter->second, slot);
+
+	for (auto word : iter->second) {
+		if (word) {
+			return;
+		}
+	}
+
+	column.erase(iter);
+}
+
+/**
+ * @param column
+ * @param from
+ * @param to
+ * @param slot
+ */
+template<typename Key>
+void ClientListIndex::MoveBit(std::unordered_map<Key, Bitmap> &column, const Key &from, const Key &to, uint32 slot)
+{
+	RemoveBit(column, from, slot);
+	SetBit(column[to], slot);
+}
+
+template<typename Key>
+void ClientListIndex::IntersectColumn(Bitmap &selection, const std::unordered_map<Key, Bitmap> &column, const Key &key)
+{
+	auto iter = column.find(key);
+	if (iter == column.end()) {
+		selection.clear();
+		return;
+	}
+
+	Intersect(selection, iter->second);
+}
+
+/**
+ * Matches strcasecmp, which is what the name lookups used before
+ *
+ * @param name
+ * @return
+ */
+std::string ClientListIndex::ToLower(const char *name)
+{
+	std::string lower(name ? name : "");
+	for (auto &c : lower) {
+		c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+	}
+
+	return lower;
+}
+
+template<typename Key>
+void ClientListIndex::Insert(std::unordered_map<Key, Bucket> &index, const Key &key, const Slot &slot)
+{
+	index[key].push_back(slot);
+}
+
+template<typename Key>
+void ClientListIndex::Erase(std::unordered_map<Key, Bucket> &index, const Key &key, ClientListEntry *cle)
+{
+	auto iter = index.find(key);
+	if (iter == index.end()) {
+		return;
+	}
+
+	Bucket &bucket = iter->second;
+	for (size_t i = 0; i < bucket.size(); ++i) {
+		if (bucket[i].cle == cle) {
+			bucket[i] = bucket.back();
+			bucket.pop_back();
+			break;
+		}
+	}
+
+	if (bucket.empty()) {
+		index.erase(iter);
+	}
+}
+
+template<typename Key>
+ClientListEntry *ClientListIndex::First(const std::unordered_map<Key, Bucket> &index, const Key &key)
+{
+	auto iter = index.find(key);
+	if (iter == index.end()) {
+		return nullptr;
+	}
+
+	const Slot *first = nullptr;
+	for (auto &slot : iter->second) {
+		if (!first || slot.order < first->order) {
+			first = &slot;
+		}
+	}
+
+	return first ? first->cle : nullptr;
+}
+
+template<typename Key>
+void ClientListIndex::All(
+	const std::unordered_map<Key, Bucket> &index,
+	const Key &key,
+	std::vector<ClientListEntry *> &into
+)
+{
+	auto iter = index.find(key);
+	if (iter == index.end()) {
+		return;
+	}
+
+	Bucket bucket = iter->second;
+	std::sort(
+		bucket.begin(), bucket.end(), [](const Slot &a, const Slot &b) {
+			return a.order < b.order;
+		}
+	);
+
+	for (auto &slot : bucket) {
+		into.push_back(slot.cle);
+	}
+}
@@ -0,0 +1,205 @@
+/**
+ * EQEmulator: Everquest Server Emulator
+ * Copyright (C) 2001-2020 EQEmulator Development Team (https://github.com/EQEmu/Server)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; version 2 of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY except by those people which sell it, which
+ * are required to give you total support for your newly bought product;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+ * A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ */
+
+#ifndef EQEMU_CLIENT_LIST_INDEX_H
+#define EQEMU_CLIENT_LIST_INDEX_H
+
+#include "../common/types.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class ClientListEntry;
+
+/**
+ * Hash indexes over the entries of ClientList::clientlist
+ *
+ * Entries are keyed by their id (the handle zones hold on to as the wid), case insensitive
+ * character name, account id, character id, loginserver account id and IP. Keys are not unique
+ * (an account can have a stale entry next to a live one, everyone at character select has
+ * character id 0), so every key maps to a bucket and lookups return the entry that comes first
+ * in the list, the same one the old linear scans found.
+ *
+ * ClientListEntry calls ClientList::UpdateCLEIndex whenever one of its fields changes, which
+ * moves the entry between buckets when an indexed key changed
+ *
+ * For /who and LFG searches every entry also owns a dense slot, and class, race, level bucket,
+ * zone, guild, in world and LFG are kept as one bitmap per value over those slots. A search
+ * intersects the bitmaps for its criteria and only tests the entries left over
+ */
+class ClientListIndex {
+public:
+	typedef std::vector<uint64> Bitmap;
+
+	static const uint8 LevelBucketSize = 10;
+
+	/**
+	 * @param cle
+	 * @param at_front entry was put at the head of the list rather than appended
+	 */
+	void Add(ClientListEntry *cle, bool at_front);
+	void Remove(ClientListEntry *cle);
+	void Update(ClientListEntry *cle);
+	void Clear();
+
+	ClientListEntry *GetByID(uint32 id) const;
+	ClientListEntry *FindByName(const char *name) const;
+	ClientListEntry *FindByAccountID(uint32 account_id) const;
+	ClientListEntry *FindByCharacterID(uint32 character_id) const;
+	ClientListEntry *FindByLSID(uint32 ls_id) const;
+
+	/**
+	 * Every entry with the key, in list order
+	 *
+	 * @param character_id
+	 * @param into
+	 */
+	void GetByCharacterID(uint32 character_id, std::vector<ClientListEntry *> &into) const;
+	void GetByLSID(uint32 ls_id, std::vector<ClientListEntry *> &into) const;
+	void GetByIP(uint32 ip, std::vector<ClientListEntry *> &into) const;
+
+	size_t Count() const { return m_entries.size(); }
+
+	/**
+	 * Entries that are zoning or in a zone
+	 *
+	 * @return
+	 */
+	Bitmap SelectInWorld() const { return m_in_world; }
+	Bitmap SelectLFG() const { return m_lfg; }
+
+	void IntersectClass(Bitmap &selection, uint8 class_id) const;
+
+	/**
+	 * @param selection
+	 * @param class_mask bit n set selects class n, the LFG window's class filter
+	 */
+	void IntersectClassMask(Bitmap &selection, uint32 class_mask) const;
+	void IntersectRace(Bitmap &selection, uint16 race_id) const;
+
+	/**
+	 * Keeps whole level buckets, callers still compare the exact level of what is left
+	 *
+	 * @param selection
+	 * @param low
+	 * @param high
+	 */
+	void IntersectLevels(Bitmap &selection, uint32 low, uint32 high) const;
+
+	/**
+	 * Zone and guild ids at least one entry is in, so name searches only resolve those names
+	 *
+	 * @param into
+	 */
+	void GetZoneIDs(std::vector<uint32> &into) const;
+	void GetGuildIDs(std::vector<uint32> &into) const;
+
+	/**
+	 * The selected entries, in list order
+	 *
+	 * @param selection
+	 * @param into
+	 */
+	void Resolve(const Bitmap &selection, std::vector<ClientListEntry *> &into) const;
+
+private:
+	struct Slot {
+		int64           order;
+		ClientListEntry *cle;
+	};
+
+	typedef std::vector<Slot> Bucket;
+
+	struct Keys {
+		int64       order;
+		std::string name; // lower case
+		uint32      account_id;
+		uint32      character_id;
+		uint32      ls_id;
+		uint32      ip;
+
+		uint32 slot;
+		uint8  class_id;
+		uint16 race_id;
+		uint8  level_bucket;
+		uint32 zone_id;
+		uint32 guild_id;
+		bool   in_world;
+		bool   lfg;
+	};
+
+	static void SetBit(Bitmap &bitmap, uint32 slot);
+	static void ClearBit(Bitmap &bitmap, uint32 slot);
+	static void Intersect(Bitmap &selection, const Bitmap &other);
+	static void Union(Bitmap &selection, const Bitmap &other);
+
+	template<typename Key>
+	static void RemoveBit(std::unordered_map<Key, Bitmap> &column, const Key &key, uint32 slot);
+
+	template<typename Key>
+	static void MoveBit(std::unordered_map<Key, Bitmap> &column, const Key &from, const Key &to, uint32 slot);
+
+	template<typename Key>
+	static void IntersectColumn(Bitmap &selection, const std::unordered_map<Key, Bitmap> &column, const Key &key);
+
+	void SetColumns(ClientListEntry *cle, Keys &keys);
+	void ClearColumns(const Keys &keys);
+	void UpdateColumns(ClientListEntry *cle, Keys &keys);
+
+	static std::string ToLower(const char *name);
+
+	template<typename Key>
+	static void Insert(std::unordered_map<Key, Bucket> &index, const Key &key, const Slot &slot);
+
+	template<typename Key>
+	static void Erase(std::unordered_map<Key, Bucket> &index, const Key &key, ClientListEntry *cle);
+
+	template<typename Key>
+	static ClientListEntry *First(const std::unordered_map<Key, Bucket> &index, const Key &key);
+
+	template<typename Key>
+	static void All(const std::unordered_map<Key, Bucket> &index, const Key &key, std::vector<ClientListEntry *> &into);
+
+	std::unordered_map<ClientListEntry *, Keys>   m_entries;
+	std::unordered_map<uint32, ClientListEntry *> m_by_id;
+	std::unordered_map<std::string, Bucket>       m_by_name;
+	std::unordered_map<uint32, Bucket>            m_by_account_id;
+	std::unordered_map<uint32, Bucket>            m_by_character_id;
+	std::unordered_map<uint32, Bucket>            m_by_ls_id;
+	std::unordered_map<uint32, Bucket>            m_by_ip;
+
+	std::vector<ClientListEntry *> m_slots;
+	std::vector<int64>             m_slot_order;
+	std::vector<uint32>            m_free_slots;
+
+	std::unordered_map<uint8, Bitmap>  m_class_column;
+	std::unordered_map<uint16, Bitmap> m_race_column;
+	std::unordered_map<uint8, Bitmap>  m_level_column;
+	std::unordered_map<uint32, Bitmap> m_zone_column;
+	std::unordered_map<uint32, Bitmap> m_guild_column;
+	Bitmap                             m_in_world;
+	Bitmap                             m_lfg;
+
+	// Insert() puts entries ahead of everything, Append() behind, order mirrors the list
+	int64 m_front_order = 0;
+	int64 m_back_order  = 0;
+};
+
+#endif
@@ -125,10 +125,20 @@ ClientListEntry::~ClientListEntry()
 	tell_queue.clear();
 }
 
+/**
+ * Bumps the revision EQW::ClientDelta publishes from and lets ClientList re-key the entry
+ */
+void ClientListEntry::MarkChanged()
+{
+	++m_revision;
+	client_list.UpdateCLEIndex(this);
+}
+
 void ClientListEntry::SetChar(uint32 iCharID, const char *iCharName)
 {
 	pcharid = iCharID;
 	strn0cpy(pname, iCharName, sizeof(pname));
+	MarkChanged();
 }
 
 void ClientListEntry::SetOnline(ZoneServer *iZS, CLE_Status iOnline)
@@ -155,7 +165,13 @@ void ClientListEntry::SetOnline(CLE_Status iOnline)
 		numplayers--;
 	}
 	if (iOnline != CLE_Status::Online || pOnline < CLE_Status::Online) {
+		bool changed = pOnline != iOnline;
 		pOnline = iOnline;
+
+		// after the assignment, the index reads the new state
+		if (changed) {
+			MarkChanged();
+		}
 	}
 	if (iOnline < CLE_Status::Zoning) {
 		Camp();
@@ -241,6 +257,7 @@ void ClientListEntry::Update(ZoneServer *iZS, ServerClientList_Struct *scl, CLE_
 		memcpy(pLFGComments, scl->LFGComments, sizeof(pLFGComments));
 	}
 
+	MarkChanged();
 	SetOnline(iOnline);
 }
 
@@ -259,6 +276,7 @@ void ClientListEntry::LeavingZone(ZoneServer *iZS, CLE_Status iOnline)
 	}
 	pzoneserver = 0;
 	pzone       = 0;
+	MarkChanged();
 }
 
 void ClientListEntry::ClearVars(bool iAll)
@@ -292,6 +310,8 @@ void ClientListEntry::ClearVars(bool iAll)
 	for (auto &elem : tell_queue)
 		safe_delete_array(elem);
 	tell_queue.clear();
+
+	MarkChanged();
 }
 
 void ClientListEntry::Camp(ZoneServer *iZS)
@@ -369,6 +389,8 @@ bool ClientListEntry::CheckAuth(uint32 loginserver_account_id, const char *key_p
 				padmin = pworldadmin;
 			}
 		}
+
+		MarkChanged();
 		return true;
 	}
 	return false;
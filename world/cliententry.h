@@ -76,7 +76,7 @@ public:
 	inline CLE_Status Online()		{ return pOnline; }
 	inline const uint32	GetID() const	{ return id; }
 	inline const uint32	GetIP() const	{ return pIP; }
-	inline void			SetIP(const uint32& iIP) { pIP = iIP; }
+	inline void			SetIP(const uint32& iIP) { pIP = iIP; MarkChanged(); }
 	inline void			KeepAlive()		{ stale = 0; }
 	inline uint8			GetStaleCounter() const { return stale; }
 	void	LeavingZone(ZoneServer* iZS = 0, CLE_Status iOnline = CLE_Status::Offline);
@@ -95,11 +95,11 @@ public:
 	inline uint32		AccountID() const		{ return paccountid; }
 	inline const char*	AccountName() const		{ return paccountname; }
 	inline int16		Admin() const			{ return padmin; }
-	inline void			SetAdmin(uint16 iAdmin)	{ padmin = iAdmin; }
+	inline void			SetAdmin(uint16 iAdmin)	{ padmin = iAdmin; MarkChanged(); }
 
 	// Character info
 	inline ZoneServer*	Server() const		{ return pzoneserver; }
-	inline void			ClearServer()		{ pzoneserver = 0; }
+	inline void			ClearServer()		{ pzoneserver = 0; MarkChanged(); }
 	inline uint32		CharID() const		{ return pcharid; }
 	inline const char*	name() const		{ return pname; }
 	inline uint32		zone() const		{ return pzone; }
@@ -110,11 +110,11 @@ public:
 	inline uint8			Anon()				{ return panon; }
 	inline uint8			TellsOff() const	{ return ptellsoff; }
 	inline uint32		GuildID() const	{ return pguild_id; }
-	inline void			SetGuild(uint32 guild_id) { pguild_id = guild_id; }
+	inline void			SetGuild(uint32 guild_id) { pguild_id = guild_id; MarkChanged(); }
 	inline bool			LFG() const			{ return pLFG; }
 	inline uint8			GetGM() const		{ return gm; }
-	inline void			SetGM(uint8 igm)	{ gm = igm; }
-	inline void			SetZone(uint32 zone) { pzone = zone; }
+	inline void			SetGM(uint8 igm)	{ gm = igm; MarkChanged(); }
+	inline void			SetZone(uint32 zone) { pzone = zone; MarkChanged(); }
 	inline bool	IsLocalClient() const { return plocal; }
 	inline uint8			GetLFGFromLevel() const { return pLFGFromLevel; }
 	inline uint8			GetLFGToLevel() const { return pLFGToLevel; }
@@ -122,6 +122,9 @@ public:
 	inline const char*		GetLFGComments() const { return pLFGComments; }
 	inline uint8	GetClientVersion() { return pClientVersion; }
 
+	// bumped whenever anything published about the entry changes, see ClientList::PublishClientDelta
+	inline uint32	GetRevision() const { return m_revision; }
+
 	inline bool TellQueueFull() const { return tell_queue.size() >= RuleI(World, TellQueueSize); }
 	inline bool TellQueueEmpty() const { return tell_queue.empty(); }
 	inline void PushToTellQueue(ServerChannelMessage_Struct *scm) { tell_queue.push_back(scm); }
@@ -132,8 +135,10 @@ public:
 
 private:
 	void	ClearVars(bool iAll = false);
+	void	MarkChanged();
 
 	const uint32	id;
+	uint32	m_revision = 1;
 	uint32	pIP;
 	CLE_Status pOnline;
 	uint8	stale;
@@ -35,6 +35,7 @@
 #include "wguild_mgr.h"
 #include "world_store.h"
 #include <set>
+#include <unordered_set>
 
 extern WebInterfaceList web_interface;
 
@@ -86,16 +87,18 @@ void ClientList::CLERemoveZSRef(ZoneServer* iZS) {
 }
 
 ClientListEntry* ClientList::GetCLE(uint32 iID) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
+	return m_cle_index.GetByID(iID);
+}
 
-	iterator.Reset();
-	while(iterator.MoreElements()) {
-		if (iterator.GetData()->GetID() == iID) {
-			return iterator.GetData();
-		}
-		iterator.Advance();
-	}
-	return 0;
+/**
+ * Every removal from clientlist goes through here so the entry leaves the indexes before it is deleted
+ *
+ * @param iterator
+ */
+void ClientList::RemoveCurrentCLE(LinkedListIterator<ClientListEntry *> &iterator)
+{
+	m_cle_index.Remove(iterator.GetData());
+	iterator.RemoveCurrent();
 }
 
 //Check current CLE Entry IPs against incoming connection
@@ -122,7 +125,7 @@ void ClientList::GetCLEIP(uint32 iIP) {
 					} else {
 						LogClientLogin("Disconnect: Account [{}] on IP [{}]", countCLEIPs->LSName(), long2ip(countCLEIPs->GetIP()).c_str());
 						countCLEIPs->SetOnline(CLE_Status::Offline);
-						iterator.RemoveCurrent();
+						RemoveCurrentCLE(iterator);
 						continue;
 					}
 				}
@@ -138,7 +141,7 @@ void ClientList::GetCLEIP(uint32 iIP) {
 							} else {
 								LogClientLogin("Disconnect: Account [{}] on IP [{}]", countCLEIPs->LSName(), long2ip(countCLEIPs->GetIP()).c_str());
 								countCLEIPs->SetOnline(CLE_Status::Offline); // Remove the connection
-								iterator.RemoveCurrent();
+								RemoveCurrentCLE(iterator);
 								continue;
 							}
 						}
@@ -150,7 +153,7 @@ void ClientList::GetCLEIP(uint32 iIP) {
 						} else {
 							LogClientLogin("Disconnect: Account [{}] on IP [{}]", countCLEIPs->LSName(), long2ip(countCLEIPs->GetIP()).c_str());
 							countCLEIPs->SetOnline(CLE_Status::Offline); // Remove the connection
-							iterator.RemoveCurrent();
+							RemoveCurrentCLE(iterator);
 							continue;
 						}
 					} else if (IPInstances > RuleI(World, AddMaxClientsPerIP)) { // else they are eligible for the higher limit, but if they exceed that
@@ -161,7 +164,7 @@ void ClientList::GetCLEIP(uint32 iIP) {
 						} else {
 							LogClientLogin("Disconnect: Account [{}] on IP [{}]", countCLEIPs->LSName(), long2ip(countCLEIPs->GetIP()).c_str());
 							countCLEIPs->SetOnline(CLE_Status::Offline); // Remove the connection
-							iterator.RemoveCurrent();
+							RemoveCurrentCLE(iterator);
 							continue;
 						}
 					}
@@ -173,18 +176,14 @@ void ClientList::GetCLEIP(uint32 iIP) {
 }
 
 uint32 ClientList::GetCLEIPCount(uint32 iIP) {
-	ClientListEntry* countCLEIPs = 0;
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
+	std::vector<ClientListEntry *> entries;
+	m_cle_index.GetByIP(iIP, entries);
 
 	int IPInstances = 0;
-	iterator.Reset();
-
-	while (iterator.MoreElements()) {
-		countCLEIPs = iterator.GetData();
-		if ((countCLEIPs->GetIP() == iIP) && ((countCLEIPs->Admin() < (RuleI(World, ExemptMaxClientsStatus))) || (RuleI(World, ExemptMaxClientsStatus) < 0)) && countCLEIPs->Online() >= CLE_Status::Online) { // If the IP matches, and the connection admin status is below the exempt status, or exempt status is less than 0 (no-one is exempt)
+	for (auto countCLEIPs : entries) {
+		if (((countCLEIPs->Admin() < (RuleI(World, ExemptMaxClientsStatus))) || (RuleI(World, ExemptMaxClientsStatus) < 0)) && countCLEIPs->Online() >= CLE_Status::Online) { // If the connection admin status is below the exempt status, or exempt status is less than 0 (no-one is exempt)
 			IPInstances++; // Increment the occurences of this IP address
 		}
-		iterator.Advance();
 	}
 
 	return IPInstances;
@@ -208,63 +207,26 @@ void ClientList::DisconnectByIP(uint32 iIP) {
 				safe_delete(pack);
 			}
 			countCLEIPs->SetOnline(CLE_Status::Offline);
-			iterator.RemoveCurrent();
+			RemoveCurrentCLE(iterator);
 		}
 		iterator.Advance();
 	}
 }
 
 ClientListEntry* ClientList::FindCharacter(const char* name) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
-
-	iterator.Reset();
-	while(iterator.MoreElements())
-	{
-		if (strcasecmp(iterator.GetData()->name(), name) == 0) {
-			return iterator.GetData();
-		}
-		iterator.Advance();
-	}
-	return nullptr;
+	return m_cle_index.FindByName(name);
 }
 
 ClientListEntry* ClientList::FindCLEByAccountID(uint32 iAccID) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
-
-	iterator.Reset();
-	while(iterator.MoreElements()) {
-		if (iterator.GetData()->AccountID() == iAccID) {
-			return iterator.GetData();
-		}
-		iterator.Advance();
-	}
-	return nullptr;
+	return m_cle_index.FindByAccountID(iAccID);
 }
 
 ClientListEntry* ClientList::FindCLEByCharacterID(uint32 iCharID) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
-
-	iterator.Reset();
-	while(iterator.MoreElements()) {
-		if (iterator.GetData()->CharID() == iCharID) {
-			return iterator.GetData();
-		}
-		iterator.Advance();
-	}
-	return nullptr;
+	return m_cle_index.FindByCharacterID(iCharID);
 }
 
 ClientListEntry* ClientList::FindCLEByLSID(uint32 iLSID) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
-
-	iterator.Reset();
-	while (iterator.MoreElements()) {
-		if (iterator.GetData()->LSID() == iLSID) {
-			return iterator.GetData();
-		}
-		iterator.Advance();
-	}
-	return nullptr;
+	return m_cle_index.FindByLSID(iLSID);
 }
 
 void ClientList::SendCLEList(const int16& admin, const char* to, WorldTCPConnection* connection, const char* iName) {
@@ -329,6 +291,7 @@ void ClientList::CLEAdd(uint32 iLSID, const char *iLoginServerName, const char*
 	auto tmp = new ClientListEntry(GetNextCLEID(), iLSID, iLoginServerName, iLoginName, iLoginKey, iWorldAdmin, ip, local);
 
 	clientlist.Append(tmp);
+	m_cle_index.Add(tmp, false);
 }
 
 void ClientList::CLCheckStale() {
@@ -337,7 +300,7 @@ void ClientList::CLCheckStale() {
 	iterator.Reset();
 	while(iterator.MoreElements()) {
 		if (iterator.GetData()->CheckStale()) {
-			iterator.RemoveCurrent();
+			RemoveCurrentCLE(iterator);
 		}
 		else
 			iterator.Advance();
@@ -346,25 +309,20 @@ void ClientList::CLCheckStale() {
 
 void ClientList::ClientUpdate(ZoneServer *zoneserver, ServerClientList_Struct *scl)
 {
-	LinkedListIterator<ClientListEntry *> iterator(clientlist);
-	ClientListEntry                       *cle;
-	iterator.Reset();
-	while (iterator.MoreElements()) {
-		if (iterator.GetData()->GetID() == scl->wid) {
-			cle = iterator.GetData();
-			if (scl->remove == 2) {
-				cle->LeavingZone(zoneserver, CLE_Status::Offline);
-			}
-			else if (scl->remove == 1) {
-				cle->LeavingZone(zoneserver, CLE_Status::Zoning);
-			}
-			else {
-				cle->Update(zoneserver, scl);
-			}
-			return;
+	ClientListEntry *cle = GetCLE(scl->wid);
+	if (cle) {
+		if (scl->remove == 2) {
+			cle->LeavingZone(zoneserver, CLE_Status::Offline);
 		}
-		iterator.Advance();
+		else if (scl->remove == 1) {
+			cle->LeavingZone(zoneserver, CLE_Status::Zoning);
+		}
+		else {
+			cle->Update(zoneserver, scl);
+		}
+		return;
 	}
+
 	if (scl->remove == 2) {
 		cle = new ClientListEntry(GetNextCLEID(), zoneserver, scl, CLE_Status::Online);
 	}
@@ -430,33 +388,29 @@ void ClientList::ClientUpdate(ZoneServer *zoneserver, ServerClientList_Struct *s
 	);
 
 	clientlist.Insert(cle);
+	m_cle_index.Add(cle, true);
 	zoneserver->ChangeWID(scl->charid, cle->GetID());
 }
 
 void ClientList::CLEKeepAlive(uint32 numupdates, uint32* wid) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
-	uint32 i;
-
-	iterator.Reset();
-	while(iterator.MoreElements()) {
-		for (i=0; i<numupdates; i++) {
-			if (wid[i] == iterator.GetData()->GetID())
-				iterator.GetData()->KeepAlive();
+	for (uint32 i = 0; i < numupdates; i++) {
+		ClientListEntry *cle = GetCLE(wid[i]);
+		if (cle) {
+			cle->KeepAlive();
 		}
-		iterator.Advance();
 	}
 }
 
 ClientListEntry *ClientList::CheckAuth(uint32 iLSID, const char *iKey)
 {
-	LinkedListIterator<ClientListEntry *> iterator(clientlist);
+	// only entries with a matching loginserver account id can pass ClientListEntry::CheckAuth
+	std::vector<ClientListEntry *> entries;
+	m_cle_index.GetByLSID(iLSID, entries);
 
-	iterator.Reset();
-	while (iterator.MoreElements()) {
-		if (iterator.GetData()->CheckAuth(iLSID, iKey)) {
-			return iterator.GetData();
+	for (auto cle : entries) {
+		if (cle->CheckAuth(iLSID, iKey)) {
+			return cle;
 		}
-		iterator.Advance();
 	}
 
 	return 0;
@@ -521,10 +475,7 @@ void ClientList::SendOnlineGuildMembers(uint32 FromID, uint32 GuildID)
 
 void ClientList::SendWhoAll(uint32 fromid,const char* to, int16 admin, Who_All_Struct* whom, WorldTCPConnection* connection) {
 	try{
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
-	LinkedListIterator<ClientListEntry*> countclients(clientlist);
 	ClientListEntry* cle = 0;
-	ClientListEntry* countcle = 0;
 	//char tmpgm[25] = "";
 	//char accinfo[150] = "";
 	char line[300] = "";
@@ -560,40 +511,37 @@ void ClientList::SendWhoAll(uint32 fromid,const char* to, int16 admin, Who_All_S
 			whom->wrace = FROGLOK; // This is what EQEmu uses for the Froglok Race number.
 	}
 
+	std::string cache_key;
+	if (RuleI(World, WhoResultCacheMS) > 0) {
+		cache_key = GetWhoCacheKey(admin, whom, whomlen);
+
+		auto cached = m_who_cache.find(cache_key);
+		if (cached != m_who_cache.end() && cached->second.expires > Timer::GetCurrentTime()) {
+			auto pack2 = new ServerPacket(ServerOP_WhoAllReply, cached->second.body.size());
+			memcpy(pack2->pBuffer, cached->second.body.data(), cached->second.body.size());
+			memcpy(pack2->pBuffer, &fromid, sizeof(uint32));
+			SendPacket(to, pack2);
+			safe_delete(pack2);
+			return;
+		}
+	}
+
+	std::vector<ClientListEntry *> matches;
+	GetWhoMatches(admin, whom, whomlen, matches);
+
 	uint32 totalusers=0;
 	uint32 totallength=0;
-	countclients.Reset();
-	while(countclients.MoreElements()){
-		countcle = countclients.GetData();
-		const char* tmpZone = ZoneName(countcle->zone());
-		if (
-	(countcle->Online() >= CLE_Status::Zoning) &&
-	(!countcle->GetGM() || countcle->Anon() != 1 || admin >= countcle->Admin()) &&
-	(whom == 0 || (
-		((countcle->Admin() >= AccountStatus::QuestTroupe && countcle->GetGM()) || whom->gmlookup == 0xFFFF) &&
-		(whom->lvllow == 0xFFFF || (countcle->level() >= whom->lvllow && countcle->level() <= whom->lvlhigh && (countcle->Anon()==0 || admin > countcle->Admin()))) &&
-		(whom->wclass == 0xFFFF || (countcle->class_() == whom->wclass && (countcle->Anon()==0 || admin > countcle->Admin()))) &&
-		(whom->wrace == 0xFFFF || (countcle->race() == whom->wrace && (countcle->Anon()==0 || admin > countcle->Admin()))) &&
-		(whomlen == 0 || (
-			(tmpZone != 0 && strncasecmp(tmpZone, whom->whom, whomlen) == 0) ||
-			strncasecmp(countcle->name(),whom->whom, whomlen) == 0 ||
-			(strncasecmp(guild_mgr.GetGuildName(countcle->GuildID()), whom->whom, whomlen) == 0) ||
-			(admin >= AccountStatus::GMAdmin && strncasecmp(countcle->AccountName(), whom->whom, whomlen) == 0)
-		))
-	))
-) {
-			if((countcle->Anon()>0 && admin >= countcle->Admin() && admin > AccountStatus::Player) || countcle->Anon()==0 ){
-				totalusers++;
-				if(totalusers<=20 || admin >= AccountStatus::GMAdmin)
-					totallength=totallength+strlen(countcle->name())+strlen(countcle->AccountName())+strlen(guild_mgr.GetGuildName(countcle->GuildID()))+5;
-			}
-			else if((countcle->Anon()>0 && admin<=countcle->Admin()) || (countcle->Anon()==0 && !countcle->GetGM())) {
-				totalusers++;
-				if(totalusers<=20 || admin >= AccountStatus::GMAdmin)
-					totallength=totallength+strlen(countcle->name())+strlen(guild_mgr.GetGuildName(countcle->GuildID()))+5;
-			}
+	for (auto countcle : matches) {
+		if((countcle->Anon()>0 && admin >= countcle->Admin() && admin > AccountStatus::Player) || countcle->Anon()==0 ){
+			totalusers++;
+			if(totalusers<=20 || admin >= AccountStatus::GMAdmin)
+				totallength=totallength+strlen(countcle->name())+strlen(countcle->AccountName())+strlen(guild_mgr.GetGuildName(countcle->GuildID()))+5;
+		}
+		else if((countcle->Anon()>0 && admin<=countcle->Admin()) || (countcle->Anon()==0 && !countcle->GetGM())) {
+			totalusers++;
+			if(totalusers<=20 || admin >= AccountStatus::GMAdmin)
+				totallength=totallength+strlen(countcle->name())+strlen(guild_mgr.GetGuildName(countcle->GuildID()))+5;
 		}
-		countclients.Advance();
 	}
 	uint32 plid=fromid;
 	uint32 playerineqstring=5001;
@@ -640,33 +588,13 @@ void ClientList::SendWhoAll(uint32 fromid,const char* to, int16 admin, Who_All_S
 	memcpy(bufptr,&totalusers, sizeof(uint32));
 	bufptr+=sizeof(uint32);
 
-	iterator.Reset();
 	int idx=-1;
-	while(iterator.MoreElements()) {
-		cle = iterator.GetData();
-
-		const char* tmpZone = ZoneName(cle->zone());
-		if (
-	(cle->Online() >= CLE_Status::Zoning) &&
-	(!cle->GetGM() || cle->Anon() != 1 || admin >= cle->Admin()) &&
-	(whom == 0 || (
-		((cle->Admin() >= AccountStatus::QuestTroupe && cle->GetGM()) || whom->gmlookup == 0xFFFF) &&
-		(whom->lvllow == 0xFFFF || (cle->level() >= whom->lvllow && cle->level() <= whom->lvlhigh && (cle->Anon()==0 || admin>cle->Admin()))) &&
-		(whom->wclass == 0xFFFF || (cle->class_() == whom->wclass && (cle->Anon()==0 || admin>cle->Admin()))) &&
-		(whom->wrace == 0xFFFF || (cle->race() == whom->wrace && (cle->Anon()==0 || admin>cle->Admin()))) &&
-		(whomlen == 0 || (
-			(tmpZone != 0 && strncasecmp(tmpZone, whom->whom, whomlen) == 0) ||
-			strncasecmp(cle->name(),whom->whom, whomlen) == 0 ||
-			(strncasecmp(guild_mgr.GetGuildName(cle->GuildID()), whom->whom, whomlen) == 0) ||
-			(admin >= AccountStatus::GMAdmin && strncasecmp(cle->AccountName(), whom->whom, whomlen) == 0)
-		))
-	))
-) {
+	for (auto match : matches) {
+		cle = match;
 			line[0] = 0;
 			uint32 rankstring = 0xFFFFFFFF;
 				if((cle->Anon()==1 && cle->GetGM() && cle->Admin()>admin) || (idx>=20 && admin < AccountStatus::GMAdmin)){ //hide gms that are anon from lesser gms and normal players, cut off at 20
 					rankstring = 0;
-					iterator.Advance();
 					continue;
 				} else if (cle->GetGM()) {
 					if (cle->Admin() >= AccountStatus::GMImpossible)
@@ -780,9 +708,18 @@ void ClientList::SendWhoAll(uint32 fromid,const char* to, int16 admin, Who_All_S
 	ending=207;
 	memcpy(bufptr,&ending, sizeof(uint32));
 	bufptr+=sizeof(uint32);
+	}
+
+	if (!cache_key.empty()) {
+		if (m_who_cache.size() >= WhoCacheMaxEntries) {
+			PruneWhoCache();
 		}
-		iterator.Advance();
+
+		WhoCacheEntry &entry = m_who_cache[cache_key];
+		entry.body.assign(reinterpret_cast<const char *>(pack2->pBuffer), pack2->size);
+		entry.expires = Timer::GetCurrentTime() + RuleI(World, WhoResultCacheMS);
 	}
+
 	//zoneserver_list.SendPacket(pack2); // NO NO NO WHY WOULD YOU SEND IT TO EVERY ZONE SERVER?!?
 	SendPacket(to,pack2);
 	safe_delete(pack2);
@@ -793,6 +730,139 @@ void ClientList::SendWhoAll(uint32 fromid,const char* to, int16 admin, Who_All_S
 	}
 }
 
+/**
+ * Everything a /who all request lists, in client list order
+ *
+ * Class, race and level narrow the search through the index bitmaps first; the zone and guild
+ * names a partial name can match are resolved once per request instead of once per entry
+ *
+ * @param admin
+ * @param whom
+ * @param whomlen
+ * @param matches
+ */
+void ClientList::GetWhoMatches(int16 admin, Who_All_Struct *whom, int whomlen, std::vector<ClientListEntry *> &matches)
+{
+	auto selection = m_cle_index.SelectInWorld();
+
+	std::unordered_set<uint32> zone_matches;
+	std::unordered_set<uint32> guild_matches;
+
+	if (whom) {
+		if (whom->wclass != 0xFFFF) {
+			if (whom->wclass > 0xFF) {
+				return;
+			}
+
+			m_cle_index.IntersectClass(selection, static_cast<uint8>(whom->wclass));
+		}
+
+		if (whom->wrace != 0xFFFF) {
+			if (whom->wrace > 0xFFFF) {
+				return;
+			}
+
+			m_cle_index.IntersectRace(selection, static_cast<uint16>(whom->wrace));
+		}
+
+		if (whom->lvllow != 0xFFFF) {
+			m_cle_index.IntersectLevels(selection, whom->lvllow, whom->lvlhigh);
+		}
+
+		if (whomlen > 0) {
+			std::vector<uint32> ids;
+			m_cle_index.GetZoneIDs(ids);
+			for (auto zone_id : ids) {
+				const char *zone_name = ZoneName(zone_id);
+				if (zone_name != 0 && strncasecmp(zone_name, whom->whom, whomlen) == 0) {
+					zone_matches.insert(zone_id);
+				}
+			}
+
+			ids.clear();
+			m_cle_index.GetGuildIDs(ids);
+			for (auto guild_id : ids) {
+				if (strncasecmp(guild_mgr.GetGuildName(guild_id), whom->whom, whomlen) == 0) {
+					guild_matches.insert(guild_id);
+				}
+			}
+		}
+	}
+
+	std::vector<ClientListEntry *> candidates;
+	m_cle_index.Resolve(selection, candidates);
+
+	for (auto cle : candidates) {
+		if (
+	(cle->Online() >= CLE_Status::Zoning) &&
+	(!cle->GetGM() || cle->Anon() != 1 || admin >= cle->Admin()) &&
+	(whom == 0 || (
+		((cle->Admin() >= AccountStatus::QuestTroupe && cle->GetGM()) || whom->gmlookup == 0xFFFF) &&
+		(whom->lvllow == 0xFFFF || (cle->level() >= whom->lvllow && cle->level() <= whom->lvlhigh && (cle->Anon()==0 || admin>cle->Admin()))) &&
+		(whom->wclass == 0xFFFF || (cle->class_() == whom->wclass && (cle->Anon()==0 || admin>cle->Admin()))) &&
+		(whom->wrace == 0xFFFF || (cle->race() == whom->wrace && (cle->Anon()==0 || admin>cle->Admin()))) &&
+		(whomlen == 0 || (
+			zone_matches.count(cle->zone()) ||
+			strncasecmp(cle->name(),whom->whom, whomlen) == 0 ||
+			guild_matches.count(cle->GuildID()) ||
+			(admin >= AccountStatus::GMAdmin && strncasecmp(cle->AccountName(), whom->whom, whomlen) == 0)
+		))
+	))
+) {
+			matches.push_back(cle);
+		}
+	}
+}
+
+/**
+ * Everything the reply depends on apart from who asked
+ *
+ * @param admin
+ * @param whom
+ * @param whomlen
+ * @return
+ */
+std::string ClientList::GetWhoCacheKey(int16 admin, Who_All_Struct *whom, int whomlen)
+{
+	if (!whom) {
+		return fmt::format("{}", admin);
+	}
+
+	std::string search(whom->whom, whomlen);
+	for (auto &c : search) {
+		c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+	}
+
+	return fmt::format(
+		"{}:{}:{}:{}:{}:{}:{}",
+		admin,
+		whom->wrace,
+		whom->wclass,
+		whom->lvllow,
+		whom->lvlhigh,
+		whom->gmlookup,
+		search
+	);
+}
+
+void ClientList::PruneWhoCache()
+{
+	uint32 now = Timer::GetCurrentTime();
+
+	for (auto iter = m_who_cache.begin(); iter != m_who_cache.end();) {
+		if (iter->second.expires <= now) {
+			iter = m_who_cache.erase(iter);
+		}
+		else {
+			++iter;
+		}
+	}
+
+	if (m_who_cache.size() >= WhoCacheMaxEntries) {
+		m_who_cache.clear();
+	}
+}
+
 void ClientList::SendFriendsWho(ServerFriendsWho_Struct *FriendsWho, WorldTCPConnection* connection) {
 
 	std::vector<ClientListEntry*> FriendsCLEs;
@@ -940,35 +1010,34 @@ void ClientList::SendLFGMatches(ServerLFGMatchesRequest_Struct *smrs) {
 
 	// Send back matches when someone searches player's Looking For A Group.
 
-	LinkedListIterator<ClientListEntry*> Iterator(clientlist);
-	ClientListEntry* CLE = 0;
-	int Matches = 0;
-
-	Iterator.Reset();
-
-	// We run the ClientList twice. The first time is to determine how big the outgoing packet needs to be.
-	while(Iterator.MoreElements()) {
-		CLE = Iterator.GetData();
-		if(CLE->LFG()) {
-			unsigned int BitMask = 1 << CLE->class_();
-			// First we check that the player meets the level and class criteria of the person
-			// doing the search.
-			if((CLE->level() >= smrs->FromLevel) && (CLE->level() <= smrs->ToLevel) &&
-				(BitMask & smrs->Classes))
-				// Then we check if if the player doing the search meets the level criteria specified
-				// by the player who is LFG.
-				//
-				// GetLFGMatchFilter returns the setting of the 'Only players who match my posted filters
-				//						can query me' checkbox.
-				//
-				// FromLevel and ToLevel are the settings of the 'Want group levels:' boxes.
-				if(!CLE->GetLFGMatchFilter() || ((smrs->QuerierLevel >= CLE->GetLFGFromLevel()) &&
-								(smrs->QuerierLevel <= CLE->GetLFGToLevel())))
-					Matches++;
-		}
-		Iterator.Advance();
+	// The index narrows the search down to LFG entries of the wanted classes and level range,
+	// the exact checks run on what is left.
+	auto selection = m_cle_index.SelectLFG();
+	m_cle_index.IntersectClassMask(selection, smrs->Classes);
+	m_cle_index.IntersectLevels(selection, smrs->FromLevel, smrs->ToLevel);
+
+	std::vector<ClientListEntry *> candidates;
+	m_cle_index.Resolve(selection, candidates);
+
+	std::vector<ClientListEntry *> matches;
+	for (auto CLE : candidates) {
+		unsigned int BitMask = CLE->class_() < 32 ? (1u << CLE->class_()) : 0;
+		// First we check that the player meets the level and class criteria of the person
+		// doing the search.
+		if (CLE->LFG() && (CLE->level() >= smrs->FromLevel) && (CLE->level() <= smrs->ToLevel) &&
+			(BitMask & smrs->Classes))
+			// Then we check if if the player doing the search meets the level criteria specified
+			// by the player who is LFG.
+			//
+			// GetLFGMatchFilter returns the setting of the 'Only players who match my posted filters
+			//						can query me' checkbox.
+			//
+			// FromLevel and ToLevel are the settings of the 'Want group levels:' boxes.
+			if(!CLE->GetLFGMatchFilter() || ((smrs->QuerierLevel >= CLE->GetLFGFromLevel()) &&
+							(smrs->QuerierLevel <= CLE->GetLFGToLevel())))
+				matches.push_back(CLE);
 	}
-	auto Pack = new ServerPacket(ServerOP_LFGMatches, (sizeof(ServerLFGMatchesResponse_Struct) * Matches) + 4);
+	auto Pack = new ServerPacket(ServerOP_LFGMatches, (sizeof(ServerLFGMatchesResponse_Struct) * matches.size()) + 4);
 
 	char *Buf = (char *)Pack->pBuffer;
 	// FromID is the Entity ID of the player doing the search.
@@ -976,31 +1045,18 @@ void ClientList::SendLFGMatches(ServerLFGMatchesRequest_Struct *smrs) {
 
 	ServerLFGMatchesResponse_Struct* Buffer = (ServerLFGMatchesResponse_Struct*)Buf;
 
-	Iterator.Reset();
-
-	if(Matches) {
-		while(Iterator.MoreElements() && (Matches > 0)) {
-			CLE = Iterator.GetData();
-			if(CLE->LFG()) {
-				unsigned int BitMask = 1 << CLE->class_();
-				if((CLE->level() >= smrs->FromLevel) && (CLE->level() <= smrs->ToLevel) &&
-					(BitMask & smrs->Classes)) {
-					Matches--;
-					strcpy(Buffer->Name, CLE->name());
-					Buffer->Class_ = CLE->class_();
-					Buffer->Level = CLE->level();
-					Buffer->Zone = CLE->zone();
-					// If the LFG player is anon, level and class are still displayed, but
-					// zone shows as UNAVAILABLE.
-					Buffer->Anon = (CLE->Anon() != 0);
-					// The client can filter on Guildname
-					Buffer->GuildID = CLE->GuildID();
-					strcpy(Buffer->Comments, CLE->GetLFGComments());
-					Buffer++;
-				}
-			}
-			Iterator.Advance();
-		}
+	for (auto CLE : matches) {
+		strcpy(Buffer->Name, CLE->name());
+		Buffer->Class_ = CLE->class_();
+		Buffer->Level = CLE->level();
+		Buffer->Zone = CLE->zone();
+		// If the LFG player is anon, level and class are still displayed, but
+		// zone shows as UNAVAILABLE.
+		Buffer->Anon = (CLE->Anon() != 0);
+		// The client can filter on Guildname
+		Buffer->GuildID = CLE->GuildID();
+		strcpy(Buffer->Comments, CLE->GetLFGComments());
+		Buffer++;
 	}
 	SendPacket(smrs->FromName,Pack);
 	safe_delete(Pack);
@@ -1300,15 +1356,11 @@ void ClientList::SendGuildPacket(uint32 guild_id, ServerPacket* pack) {
 }
 
 void ClientList::UpdateClientGuild(uint32 char_id, uint32 guild_id) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
+	std::vector<ClientListEntry *> entries;
+	m_cle_index.GetByCharacterID(char_id, entries);
 
-	iterator.Reset();
-	while(iterator.MoreElements()) {
-		ClientListEntry *cle = iterator.GetData();
-		if (cle->CharID() == char_id) {
-			cle->SetGuild(guild_id);
-		}
-		iterator.Advance();
+	for (auto cle : entries) {
+		cle->SetGuild(guild_id);
 	}
 }
 
@@ -1319,7 +1371,7 @@ void ClientList::RemoveCLEByLSID(uint32 iLSID)
 	iterator.Reset();
 	while (iterator.MoreElements()) {
 		if (iterator.GetData()->LSAccountID() == iLSID) {
-			iterator.RemoveCurrent();
+			RemoveCurrentCLE(iterator);
 		}
 		else {
 			iterator.Advance();
@@ -1328,13 +1380,13 @@ void ClientList::RemoveCLEByLSID(uint32 iLSID)
 }
 
 bool ClientList::IsAccountInGame(uint32 iLSID) {
-	LinkedListIterator<ClientListEntry*> iterator(clientlist);
-	iterator.Reset();
-	while (iterator.MoreElements()) {
-		if (iterator.GetData()->LSID() == iLSID && iterator.GetData()->Online() == CLE_Status::InZone) {
+	std::vector<ClientListEntry *> entries;
+	m_cle_index.GetByLSID(iLSID, entries);
+
+	for (auto cle : entries) {
+		if (cle->Online() == CLE_Status::InZone) {
 			return true;
 		}
-		iterator.Advance();
 	}
 
 	return false;
@@ -1430,8 +1482,39 @@ void ClientList::SendClientVersionSummary(const char *Name)
 	);
 }
 
+/**
+ * @param server
+ * @param out
+ */
+static void GetZoneServerJson(ZoneServer *server, Json::Value &out)
+{
+	out["CAddress"]        = server->GetCAddress();
+	out["CLocalAddress"]   = server->GetCLocalAddress();
+	out["CompileTime"]     = server->GetCompileTime();
+	out["CPort"]           = server->GetCPort();
+	out["ID"]              = server->GetID();
+	out["InstanceID"]      = server->GetInstanceID();
+	out["IP"]              = server->GetIP();
+	out["LaunchedName"]    = server->GetLaunchedName();
+	out["LaunchName"]      = server->GetLaunchName();
+	out["Port"]            = server->GetPort();
+	out["PrevZoneID"]      = server->GetPrevZoneID();
+	out["UUID"]            = server->GetUUID();
+	out["ZoneID"]          = server->GetZoneID();
+	out["ZoneLongName"]    = server->GetZoneLongName();
+	out["ZoneName"]        = server->GetZoneName();
+	out["ZoneOSProcessID"] = server->GetZoneOSProcessID();
+	out["NumPlayers"]      = server->NumPlayers();
+	out["BootingUp"]       = server->IsBootingUp();
+	out["StaticZone"]      = server->IsStaticZone();
+}
+
 void ClientList::OnTick(EQ::Timer *t)
 {
+	if (EventSubscriptionWatcher::Get()->IsSubscribed("EQW::ClientDelta")) {
+		PublishClientDelta();
+	}
+
 	if (!EventSubscriptionWatcher::Get()->IsSubscribed("EQW::ClientUpdate")) {
 		return;
 	}
@@ -1464,25 +1547,7 @@ void ClientList::OnTick(EQ::Timer *t)
 
 		auto server = cle->Server();
 		if (server) {
-			outclient["Server"]["CAddress"] = server->GetCAddress();
-			outclient["Server"]["CLocalAddress"] = server->GetCLocalAddress();
-			outclient["Server"]["CompileTime"] = server->GetCompileTime();
-			outclient["Server"]["CPort"] = server->GetCPort();
-			outclient["Server"]["ID"] = server->GetID();
-			outclient["Server"]["InstanceID"] = server->GetInstanceID();
-			outclient["Server"]["IP"] = server->GetIP();
-			outclient["Server"]["LaunchedName"] = server->GetLaunchedName();
-			outclient["Server"]["LaunchName"] = server->GetLaunchName();
-			outclient["Server"]["Port"] = server->GetPort();
-			outclient["Server"]["PrevZoneID"] = server->GetPrevZoneID();
-			outclient["Server"]["UUID"] = server->GetUUID();
-			outclient["Server"]["ZoneID"] = server->GetZoneID();
-			outclient["Server"]["ZoneLongName"] = server->GetZoneLongName();
-			outclient["Server"]["ZoneName"] = server->GetZoneName();
-			outclient["Server"]["ZoneOSProcessID"] = server->GetZoneOSProcessID();
-			outclient["Server"]["NumPlayers"] = server->NumPlayers();
-			outclient["Server"]["BootingUp"] = server->IsBootingUp();
-			outclient["Server"]["StaticZone"] = server->IsStaticZone();
+			GetZoneServerJson(server, outclient["Server"]);
 		}
 		else {
 			outclient["Server"] = Json::Value();
@@ -1515,6 +1580,216 @@ void ClientList::OnTick(EQ::Timer *t)
 	web_interface.SendEvent(out);
 }
 
+// column order of a compact EQW::ClientDelta row, must match GetClientDeltaRow
+static const char *ClientDeltaFields[] = {
+	"ID",
+	"Online",
+	"IP",
+	"LSID",
+	"LSAccountID",
+	"LSName",
+	"WorldAdmin",
+	"AccountID",
+	"AccountName",
+	"Admin",
+	"ServerID",
+	"CharID",
+	"name",
+	"zone",
+	"instance",
+	"level",
+	"class_",
+	"race",
+	"Anon",
+	"TellsOff",
+	"GuildID",
+	"LFG",
+	"GM",
+	"LocalClient",
+	"LFGFromLevel",
+	"LFGToLevel",
+	"LFGMatchFilter",
+	"LFGComments",
+	"ClientVersion"
+};
+
+/**
+ * Same fields as EQW::ClientUpdate, except the zone server is referenced by ServerID and sent
+ * separately, so a busy zone changing its player count doesn't resend everyone in it
+ *
+ * @param cle
+ * @param compact values only, in ClientDeltaFields order
+ * @param out
+ */
+void ClientList::GetClientDeltaRow(ClientListEntry *cle, bool compact, Json::Value &out)
+{
+	auto server = cle->Server();
+
+	Json::Value values[] = {
+		cle->GetID(),
+		cle->Online(),
+		cle->GetIP(),
+		cle->LSID(),
+		cle->LSAccountID(),
+		cle->LSName(),
+		cle->WorldAdmin(),
+		cle->AccountID(),
+		cle->AccountName(),
+		cle->Admin(),
+		server ? server->GetID() : 0,
+		cle->CharID(),
+		cle->name(),
+		cle->zone(),
+		cle->instance(),
+		cle->level(),
+		cle->class_(),
+		cle->race(),
+		cle->Anon(),
+		cle->TellsOff(),
+		cle->GuildID(),
+		cle->LFG(),
+		cle->GetGM(),
+		cle->IsLocalClient(),
+		cle->GetLFGFromLevel(),
+		cle->GetLFGToLevel(),
+		cle->GetLFGMatchFilter(),
+		cle->GetLFGComments(),
+		cle->GetClientVersion()
+	};
+
+	static_assert(
+		sizeof(values) / sizeof(values[0]) == sizeof(ClientDeltaFields) / sizeof(ClientDeltaFields[0]),
+		"ClientDeltaFields out of sync with GetClientDeltaRow"
+	);
+
+	out = compact ? Json::Value(Json::arrayValue) : Json::Value(Json::objectValue);
+	for (size_t i = 0; i < sizeof(ClientDeltaFields) / sizeof(ClientDeltaFields[0]); ++i) {
+		if (compact) {
+			out.append(values[i]);
+		}
+		else {
+			out[ClientDeltaFields[i]] = values[i];
+		}
+	}
+}
+
+/**
+ * EQW::ClientDelta, only the entries and zone servers that changed since the last publication
+ *
+ * A full snapshot goes out on the first publication, every World:ClientDeltaSnapshotTicks ticks
+ * and whenever one is asked for through EQW::RequestClientSnapshot; a consumer that joins in
+ * between applies deltas once it has seen a snapshot. Nothing is sent on a tick where nothing
+ * changed
+ */
+void ClientList::PublishClientDelta()
+{
+	const bool compact        = RuleB(World, ClientDeltaCompact);
+	const int  snapshot_ticks = RuleI(World, ClientDeltaSnapshotTicks);
+
+	bool snapshot = m_delta_snapshot_requested || (snapshot_ticks > 0 && m_delta_ticks >= (uint32) snapshot_ticks);
+	if (snapshot) {
+		m_delta_entries.clear();
+		m_delta_servers.clear();
+		m_delta_snapshot_requested = false;
+		m_delta_ticks              = 0;
+	}
+	else {
+		++m_delta_ticks;
+	}
+
+	++m_delta_sequence;
+
+	Json::Value updated(Json::arrayValue);
+	Json::Value removed(Json::arrayValue);
+	Json::Value servers(Json::arrayValue);
+	Json::Value removed_servers(Json::arrayValue);
+
+	Json::StreamWriterBuilder writer;
+	writer["indentation"] = "";
+
+	std::unordered_map<uint32, bool> seen_servers;
+
+	LinkedListIterator<ClientListEntry *> iterator(clientlist);
+	iterator.Reset();
+	while (iterator.MoreElements()) {
+		ClientListEntry *cle      = iterator.GetData();
+		ZoneServer      *server   = cle->Server();
+		uint32          server_id = server ? server->GetID() : 0;
+
+		// revisions start at 1, a new entry is always sent
+		PublishedEntry &published = m_delta_entries[cle->GetID()];
+		if (published.revision != cle->GetRevision() || published.server_id != server_id) {
+			Json::Value row;
+			GetClientDeltaRow(cle, compact, row);
+			updated.append(row);
+
+			published.revision  = cle->GetRevision();
+			published.server_id = server_id;
+		}
+
+		published.seen_sequence = m_delta_sequence;
+
+		if (server && seen_servers.emplace(server_id, true).second) {
+			Json::Value server_json;
+			GetZoneServerJson(server, server_json);
+
+			// a handful of zone servers, comparing the rendered object is cheap enough
+			std::string fingerprint = Json::writeString(writer, server_json);
+			auto        published   = m_delta_servers.find(server_id);
+			if (published == m_delta_servers.end() || published->second != fingerprint) {
+				m_delta_servers[server_id] = std::move(fingerprint);
+				servers.append(server_json);
+			}
+		}
+
+		iterator.Advance();
+	}
+
+	for (auto iter = m_delta_entries.begin(); iter != m_delta_entries.end();) {
+		if (iter->second.seen_sequence != m_delta_sequence) {
+			removed.append(iter->first);
+			iter = m_delta_entries.erase(iter);
+			continue;
+		}
+
+		++iter;
+	}
+
+	for (auto iter = m_delta_servers.begin(); iter != m_delta_servers.end();) {
+		if (seen_servers.find(iter->first) == seen_servers.end()) {
+			removed_servers.append(iter->first);
+			iter = m_delta_servers.erase(iter);
+			continue;
+		}
+
+		++iter;
+	}
+
+	if (!snapshot && updated.empty() && removed.empty() && servers.empty() && removed_servers.empty()) {
+		return;
+	}
+
+	Json::Value out;
+	out["event"]                   = "EQW::ClientDelta";
+	out["data"]["sequence"]        = m_delta_sequence;
+	out["data"]["snapshot"]        = snapshot;
+	out["data"]["updated"]         = updated;
+	out["data"]["removed"]         = removed;
+	out["data"]["servers"]         = servers;
+	out["data"]["removed_servers"] = removed_servers;
+
+	if (compact) {
+		Json::Value fields(Json::arrayValue);
+		for (auto field : ClientDeltaFields) {
+			fields.append(field);
+		}
+
+		out["data"]["fields"] = fields;
+	}
+
+	web_interface.SendEvent(out);
+}
+
 /**
  * @param response
  */
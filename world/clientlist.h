@@ -9,8 +9,10 @@
 #include "../common/servertalk.h"
 #include "../common/event/timer.h"
 #include "../common/net/console_server_connection.h"
+#include "client_list_index.h"
 #include <vector>
 #include <string>
+#include <unordered_map>
 
 class Client;
 class ZoneServer;
@@ -35,6 +37,13 @@ public:
 	void	ZoneBootup(ZoneServer* zs);
 	void	RemoveCLEReferances(ClientListEntry* cle);
 
+	/**
+	 * Called by ClientListEntry whenever one of its fields changes so the lookup indexes follow it
+	 *
+	 * @param cle
+	 */
+	void	UpdateCLEIndex(ClientListEntry* cle) { m_cle_index.Update(cle); }
+
 
 	//from ZSList
 
@@ -72,6 +81,11 @@ public:
 
 	void GetClientList(Json::Value &response);
 
+	/**
+	 * The next EQW::ClientDelta publication carries every entry instead of only the changed ones
+	 */
+	void RequestClientSnapshot() { m_delta_snapshot_requested = true; }
+
 	void SendCharacterMessage(uint32_t character_id, int chat_type, const std::string& message);
 	void SendCharacterMessage(const std::string& character_name, int chat_type, const std::string& message);
 	void SendCharacterMessage(ClientListEntry* character, int chat_type, const std::string& message);
@@ -81,7 +95,13 @@ public:
 
 private:
 	void OnTick(EQ::Timer *t);
+	void PublishClientDelta();
+	void GetClientDeltaRow(ClientListEntry *cle, bool compact, Json::Value &out);
 	inline uint32 GetNextCLEID() { return NextCLEID++; }
+	void RemoveCurrentCLE(LinkedListIterator<ClientListEntry *> &iterator);
+	void GetWhoMatches(int16 admin, Who_All_Struct *whom, int whomlen, std::vector<ClientListEntry *> &matches);
+	std::string GetWhoCacheKey(int16 admin, Who_All_Struct *whom, int whomlen);
+	void PruneWhoCache();
 
 	//this is the list of people actively connected to zone
 	LinkedList<Client*> list;
@@ -89,10 +109,36 @@ private:
 	//this is the list of people in any zone, not nescesarily connected to world
 	Timer	CLStale_timer;
 	uint32 NextCLEID;
+
+	// declared ahead of clientlist so it is still around while the list deletes its entries
+	ClientListIndex m_cle_index;
 	LinkedList<ClientListEntry *> clientlist;
 
 
 	std::unique_ptr<EQ::Timer> m_tick;
+
+	// recent /who all replies by request, reused for World:WhoResultCacheMS
+	struct WhoCacheEntry {
+		std::string body;
+		uint32      expires;
+	};
+
+	static const size_t WhoCacheMaxEntries = 256;
+
+	std::unordered_map<std::string, WhoCacheEntry> m_who_cache;
+
+	// EQW::ClientDelta state, what each subscriber has been sent so far
+	struct PublishedEntry {
+		uint32 revision;
+		uint32 server_id;
+		uint32 seen_sequence;
+	};
+
+	std::unordered_map<uint32, PublishedEntry> m_delta_entries;
+	std::unordered_map<uint32, std::string>    m_delta_servers;
+	uint32                                     m_delta_sequence           = 0;
+	uint32                                     m_delta_ticks              = 0;
+	bool                                       m_delta_snapshot_requested = true;
 };
 
 #endif /*CLIENTLIST_H_*/
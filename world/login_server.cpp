@@ -28,6 +28,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 #include "../common/packet_dump.h"
 #include "../common/string_util.h"
 #include "../common/eqemu_logsys.h"
+#include "../common/rulesys.h"
 #include "login_server.h"
 #include "login_server_list.h"
 #include "zoneserver.h"
@@ -469,6 +470,7 @@ bool LoginServer::Connect()
 			"World",
 			""
 		);
+		m_client->SetBatching(RuleB(Network, ServertalkBatching));
 		m_client->OnConnect(
 			[this](EQ::Net::ServertalkClient *client) {
 				if (client) {
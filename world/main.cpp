@@ -528,9 +528,11 @@ int main(int argc, char **argv)
 	server_connection = std::make_unique<EQ::Net::ServertalkServer>();
 
 	EQ::Net::ServertalkServerOptions server_opts;
-	server_opts.port        = Config->WorldTCPPort;
-	server_opts.ipv6        = false;
-	server_opts.credentials = Config->SharedKey;
+	server_opts.port               = Config->WorldTCPPort;
+	server_opts.ipv6               = false;
+	server_opts.credentials        = Config->SharedKey;
+	server_opts.batching           = RuleB(Network, ServertalkBatching);
+	server_opts.compress_threshold = RuleI(Network, ServertalkCompressThreshold);
 	server_connection->Listen(server_opts);
 	LogInfo("Server (TCP) listener started");
 
@@ -121,6 +121,13 @@ void WebInterface::SendEvent(const Json::Value &value)
 	}
 }
 
+void WebInterface::SendEvent(const std::string &serialized)
+{
+	EQ::Net::DynamicPacket p;
+	p.PutString(0, serialized);
+	m_connection->Send(ServerOP_WebInterfaceEvent, p);
+}
+
 void WebInterface::AddCall(const std::string &method, WebInterfaceCall call)
 {
 	m_calls.insert(std::make_pair(method, call));
@@ -166,8 +173,24 @@ void WebInterfaceList::SendResponse(const std::string &uuid, std::string &id, co
 }
 
 void WebInterfaceList::SendEvent(const Json::Value &value) {
+	if (m_interfaces.empty()) {
+		return;
+	}
+
+	// rendered once without indentation, not once per connection
+	std::string serialized;
+	try {
+		Json::StreamWriterBuilder writer;
+		writer["indentation"] = "";
+		serialized = Json::writeString(writer, value);
+	}
+	catch (std::exception &) {
+		//Log error
+		return;
+	}
+
 	for (auto &i : m_interfaces) {
-		i.second->SendEvent(value);
+		i.second->SendEvent(serialized);
 	}
 }
 
@@ -20,6 +20,7 @@ public:
 	void SendError(const std::string &message);
 	void SendError(const std::string &message, const std::string &id);
 	void SendEvent(const Json::Value &value);
+	void SendEvent(const std::string &serialized);
 	void AddCall(const std::string &method, WebInterfaceCall call);
 private:
 	void OnCall(uint16 opcode, EQ::Net::Packet &p);
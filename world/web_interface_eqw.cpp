@@ -73,6 +73,14 @@ void EQW__GetLoginServerCount(WebInterface *i, const std::string& method, const
 	i->SendResponse(id, ret);
 }
 
+void EQW__RequestClientSnapshot(WebInterface *i, const std::string& method, const std::string& id, const Json::Value& params) {
+	client_list.RequestClientSnapshot();
+
+	Json::Value ret;
+	ret["status"] = "complete";
+	i->SendResponse(id, ret);
+}
+
 void RegisterEQW(WebInterface *i)
 {
 	i->AddCall("EQW::GetConfig", std::bind(EQW__GetConfig, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4));
@@ -83,4 +91,5 @@ void RegisterEQW(WebInterface *i)
 	i->AddCall("EQW::GetZoneCount", std::bind(EQW__GetZoneCount, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4));
 	i->AddCall("EQW::GetLauncherCount", std::bind(EQW__GetLauncherCount, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4));
 	i->AddCall("EQW::GetLoginServerCount", std::bind(EQW__GetLoginServerCount, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4));
+	i->AddCall("EQW::RequestClientSnapshot", std::bind(EQW__RequestClientSnapshot, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4));
 }
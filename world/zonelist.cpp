@@ -29,6 +29,8 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 #include "web_interface.h"
 #include "world_store.h"
 
+#include <algorithm>
+
 extern uint32 numzones;
 extern EQ::Random emu_random;
 extern WebInterfaceList web_interface;
@@ -39,6 +41,7 @@ ZSList::ZSList()
 {
 	NextID = 1;
 	CurGroupID = 1;
+	m_next_route_order = 0;
 	memset(pLockedZones, 0, sizeof(pLockedZones));
 
 	m_tick = std::make_unique<EQ::Timer>(5000, true, std::bind(&ZSList::OnTick, this, std::placeholders::_1));
@@ -65,7 +68,15 @@ void ZSList::ShowUpTime(WorldTCPConnection* con, const char* adminname) {
 
 void ZSList::Add(ZoneServer* zoneserver) {
 	zone_server_list.push_back(std::unique_ptr<ZoneServer>(zoneserver));
+
+	RouteKeys keys;
+	keys.order = m_next_route_order++;
+	AddRoutes(zoneserver, keys);
+
 	zoneserver->SendGroupIDs();
+
+	// meshed zones fall back to world for broadcasts until the newcomer accepts direct connections
+	SendZoneMeshPeers();
 }
 
 void ZSList::Remove(const std::string &uuid)
@@ -74,11 +85,23 @@ void ZSList::Remove(const std::string &uuid)
 	while (iter != zone_server_list.end()) {
 		if ((*iter)->GetUUID().compare(uuid) == 0) {
 			auto port = (*iter)->GetCPort();
+			bool meshed = (*iter)->GetMeshPort() != 0;
+
+			auto route = m_routes.find(iter->get());
+			if (route != m_routes.end()) {
+				RemoveRoutes(iter->get(), route->second);
+				m_routes.erase(route);
+			}
+
 			zone_server_list.erase(iter);
 
 			if (port != 0) {
 				m_ports_free.push_back(port);
 			}
+
+			if (meshed) {
+				SendZoneMeshPeers();
+			}
 			return;
 		}
 		iter++;
@@ -86,6 +109,13 @@ void ZSList::Remove(const std::string &uuid)
 }
 
 void ZSList::KillAll() {
+	m_routes.clear();
+	m_by_id.clear();
+	m_by_port.clear();
+	m_by_zone_id.clear();
+	m_by_instance_id.clear();
+	m_by_name.clear();
+
 	auto iterator = zone_server_list.begin();
 	while (iterator != zone_server_list.end()) {
 		(*iterator)->Disconnect();
@@ -130,106 +160,143 @@ bool ZSList::SendPacket(ServerPacket* pack) {
 }
 
 bool ZSList::SendPacket(uint32 ZoneID, ServerPacket* pack) {
-	auto iterator = zone_server_list.begin();
-	while (iterator != zone_server_list.end()) {
-		if ((*iterator)->GetZoneID() == ZoneID) {
-			ZoneServer* tmp = (*iterator).get();
-			tmp->SendPacket(pack);
-			return true;
-		}
-		iterator++;
+	ZoneServer *zs = FirstRoute(m_by_zone_id, ZoneID);
+	if (zs) {
+		zs->SendPacket(pack);
+		return true;
 	}
 	return(false);
 }
 
 bool ZSList::SendPacket(uint32 ZoneID, uint16 instanceID, ServerPacket* pack) {
-	if (instanceID != 0)
-	{
-		auto iterator = zone_server_list.begin();
-		while (iterator != zone_server_list.end()) {
-			if ((*iterator)->GetInstanceID() == instanceID) {
-				ZoneServer* tmp = (*iterator).get();
-				tmp->SendPacket(pack);
-				return true;
-			}
-			iterator++;
-		}
-	}
-	else
-	{
-		auto iterator = zone_server_list.begin();
-		while (iterator != zone_server_list.end()) {
-			if ((*iterator)->GetZoneID() == ZoneID
-				&& (*iterator)->GetInstanceID() == 0) {
-				ZoneServer* tmp = (*iterator).get();
-				tmp->SendPacket(pack);
-				return true;
-			}
-			iterator++;
-		}
+	ZoneServer *zs = instanceID != 0 ? FindByInstanceID(instanceID) : FindByZoneID(ZoneID);
+	if (zs) {
+		zs->SendPacket(pack);
+		return true;
 	}
 	return(false);
 }
 
 ZoneServer* ZSList::FindByName(const char* zonename) {
-	auto iterator = zone_server_list.begin();
-	while (iterator != zone_server_list.end()) {
-		if (strcasecmp((*iterator)->GetZoneName(), zonename) == 0) {
-			ZoneServer* tmp = (*iterator).get();
-			return tmp;
-		}
-		iterator++;
+	if (!zonename) {
+		return nullptr;
 	}
-	return 0;
+
+	return FirstRoute(m_by_name, std::string(MakeLowerString(zonename)));
 }
 
 ZoneServer* ZSList::FindByID(uint32 ZoneID) {
-	auto iterator = zone_server_list.begin();
-	while (iterator != zone_server_list.end()) {
-		if ((*iterator)->GetID() == ZoneID) {
-			ZoneServer* tmp = (*iterator).get();
-			return tmp;
-		}
-		iterator++;
-	}
-	return 0;
+	auto iter = m_by_id.find(ZoneID);
+	return iter != m_by_id.end() ? iter->second : nullptr;
 }
 
 ZoneServer* ZSList::FindByZoneID(uint32 ZoneID) {
-	auto iterator = zone_server_list.begin();
-	while (iterator != zone_server_list.end()) {
-		ZoneServer* tmp = (*iterator).get();
-		if (tmp->GetZoneID() == ZoneID && tmp->GetInstanceID() == 0) {
-			return tmp;
+	auto bucket = m_by_zone_id.find(ZoneID);
+	if (bucket == m_by_zone_id.end()) {
+		return nullptr;
+	}
+
+	for (auto zs : bucket->second) {
+		if (zs->GetInstanceID() == 0) {
+			return zs;
 		}
-		iterator++;
 	}
-	return 0;
+	return nullptr;
 }
 
 ZoneServer* ZSList::FindByPort(uint16 port) {
-	auto iterator = zone_server_list.begin();
-	while (iterator != zone_server_list.end()) {
-		if ((*iterator)->GetCPort() == port) {
-			ZoneServer* tmp = (*iterator).get();
-			return tmp;
-		}
-		iterator++;
-	}
-	return 0;
+	return FirstRoute(m_by_port, port);
 }
 
 ZoneServer* ZSList::FindByInstanceID(uint32 InstanceID)
 {
-	auto iterator = zone_server_list.begin();
-	while (iterator != zone_server_list.end()) {
-		if ((*iterator)->GetInstanceID() == InstanceID) {
-			ZoneServer* tmp = (*iterator).get();
-			return tmp;
+	return FirstRoute(m_by_instance_id, InstanceID);
+}
+
+void ZSList::UpdateRouting(ZoneServer *zoneserver)
+{
+	auto route = m_routes.find(zoneserver);
+	if (route == m_routes.end()) {
+		return;
+	}
+
+	RouteKeys &keys = route->second;
+	if (
+		keys.port == zoneserver->GetCPort() &&
+		keys.zone_id == zoneserver->GetZoneID() &&
+		keys.instance_id == zoneserver->GetInstanceID() &&
+		keys.name == MakeLowerString(zoneserver->GetZoneName())
+	) {
+		return;
+	}
+
+	RemoveRoutes(zoneserver, keys);
+	AddRoutes(zoneserver, keys);
+}
+
+void ZSList::AddRoutes(ZoneServer *zoneserver, RouteKeys &keys)
+{
+	keys.id          = zoneserver->GetID();
+	keys.port        = zoneserver->GetCPort();
+	keys.zone_id     = zoneserver->GetZoneID();
+	keys.instance_id = zoneserver->GetInstanceID();
+	keys.name        = MakeLowerString(zoneserver->GetZoneName());
+
+	m_routes[zoneserver] = keys;
+	m_by_id[keys.id]     = zoneserver;
+	InsertRoute(m_by_port, keys.port, zoneserver);
+	InsertRoute(m_by_zone_id, keys.zone_id, zoneserver);
+	InsertRoute(m_by_instance_id, keys.instance_id, zoneserver);
+	InsertRoute(m_by_name, keys.name, zoneserver);
+}
+
+void ZSList::RemoveRoutes(ZoneServer *zoneserver, const RouteKeys &keys)
+{
+	auto id = m_by_id.find(keys.id);
+	if (id != m_by_id.end() && id->second == zoneserver) {
+		m_by_id.erase(id);
+	}
+
+	EraseRoute(m_by_port, keys.port, zoneserver);
+	EraseRoute(m_by_zone_id, keys.zone_id, zoneserver);
+	EraseRoute(m_by_instance_id, keys.instance_id, zoneserver);
+	EraseRoute(m_by_name, keys.name, zoneserver);
+}
+
+template<typename Key>
+void ZSList::InsertRoute(std::unordered_map<Key, RouteBucket> &table, const Key &key, ZoneServer *zoneserver)
+{
+	auto &bucket = table[key];
+	auto order   = m_routes[zoneserver].order;
+	auto pos     = std::upper_bound(
+		bucket.begin(), bucket.end(), order, [this](uint64 o, ZoneServer *zs) {
+			return o < m_routes[zs].order;
 		}
-		iterator++;
+	);
+
+	bucket.insert(pos, zoneserver);
+}
+
+template<typename Key>
+void ZSList::EraseRoute(std::unordered_map<Key, RouteBucket> &table, const Key &key, ZoneServer *zoneserver)
+{
+	auto bucket = table.find(key);
+	if (bucket == table.end()) {
+		return;
+	}
+
+	auto &servers = bucket->second;
+	servers.erase(std::remove(servers.begin(), servers.end(), zoneserver), servers.end());
+	if (servers.empty()) {
+		table.erase(bucket);
 	}
-	return 0;
+}
+
+template<typename Key>
+ZoneServer *ZSList::FirstRoute(const std::unordered_map<Key, RouteBucket> &table, const Key &key)
+{
+	auto bucket = table.find(key);
+	return bucket != table.end() && !bucket->second.empty() ? bucket->second.front() : nullptr;
 }
 
 bool ZSList::SetLockedZone(uint16 iZoneID, bool iLock) {
@@ -856,6 +923,41 @@ void ZSList::OnKeepAlive(EQ::Timer *t)
 	}
 }
 
+void ZSList::SendZoneMeshPeers()
+{
+	std::vector<ServerZoneMeshPeer_Struct> peers;
+	bool                                   meshed = false;
+
+	for (auto &zs : zone_server_list) {
+		ServerZoneMeshPeer_Struct peer{};
+		peer.zone_server_id = zs->GetID();
+		peer.port           = zs->GetMeshPort();
+		strn0cpy(peer.address, zs->GetIP().c_str(), sizeof(peer.address));
+		peers.push_back(peer);
+
+		meshed = meshed || peer.port != 0;
+	}
+
+	// nobody listens, nothing to broker
+	if (!meshed) {
+		return;
+	}
+
+	ServerPacket packet(
+		ServerOP_ZoneMeshPeers,
+		sizeof(ServerZoneMeshPeers_Struct) + peers.size() * sizeof(ServerZoneMeshPeer_Struct)
+	);
+
+	auto list = (ServerZoneMeshPeers_Struct *) packet.pBuffer;
+	list->count = (uint32) peers.size();
+	memcpy(list->peers, peers.data(), peers.size() * sizeof(ServerZoneMeshPeer_Struct));
+
+	for (auto &zs : zone_server_list) {
+		list->self_id = zs->GetID();
+		zs->SendPacket(&packet);
+	}
+}
+
 const std::list<std::unique_ptr<ZoneServer>> &ZSList::getZoneServerList() const
 {
 	return zone_server_list;
@@ -8,6 +8,9 @@
 #include <vector>
 #include <memory>
 #include <deque>
+#include <list>
+#include <string>
+#include <unordered_map>
 
 class WorldTCPConnection;
 class ServerPacket;
@@ -61,6 +64,18 @@ public:
 	void WorldShutDown(uint32 time, uint32 interval);
 	void DropClient(uint32 lsid, ZoneServer *ignore_zoneserver);
 
+	/**
+	 * Re-keys a zone server in the routing tables after its zone, instance, name or port changed
+	 *
+	 * @param zoneserver
+	 */
+	void UpdateRouting(ZoneServer *zoneserver);
+
+	/**
+	 * Tells every zone where the other zones accept direct connections, see ZoneMesh
+	 */
+	void SendZoneMeshPeers();
+
 	ZoneServer*	FindByPort(uint16 port);
 	ZoneServer* FindByID(uint32 ZoneID);
 	ZoneServer* FindByInstanceID(uint32 InstanceID);
@@ -80,6 +95,39 @@ private:
 	std::unique_ptr<EQ::Timer> m_keepalive;
 
 	std::list<std::unique_ptr<ZoneServer>> zone_server_list;
+
+	// routing tables over zone_server_list, buckets hold their servers in list order so
+	// lookups return the same server the old scans did
+	struct RouteKeys {
+		uint64      order;
+		uint32      id;
+		uint16      port;
+		uint32      zone_id;
+		uint32      instance_id;
+		std::string name; // lower case
+	};
+
+	typedef std::vector<ZoneServer *> RouteBucket;
+
+	void AddRoutes(ZoneServer *zoneserver, RouteKeys &keys);
+	void RemoveRoutes(ZoneServer *zoneserver, const RouteKeys &keys);
+
+	template<typename Key>
+	void InsertRoute(std::unordered_map<Key, RouteBucket> &table, const Key &key, ZoneServer *zoneserver);
+
+	template<typename Key>
+	static void EraseRoute(std::unordered_map<Key, RouteBucket> &table, const Key &key, ZoneServer *zoneserver);
+
+	template<typename Key>
+	static ZoneServer *FirstRoute(const std::unordered_map<Key, RouteBucket> &table, const Key &key);
+
+	std::unordered_map<ZoneServer *, RouteKeys>   m_routes;
+	std::unordered_map<uint32, ZoneServer *>      m_by_id;
+	std::unordered_map<uint16, RouteBucket>       m_by_port;
+	std::unordered_map<uint32, RouteBucket>       m_by_zone_id;
+	std::unordered_map<uint32, RouteBucket>       m_by_instance_id;
+	std::unordered_map<std::string, RouteBucket>  m_by_name;
+	uint64                                        m_next_route_order;
 };
 
 #endif /*ZONELIST_H_*/
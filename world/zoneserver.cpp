@@ -70,6 +70,7 @@ ZoneServer::ZoneServer(std::shared_ptr<EQ::Net::ServertalkServerConnection> conn
 	instance_id = 0;
 	zone_os_process_id = 0;
 	client_port = 0;
+	mesh_port = 0;
 	is_booting_up = false;
 	is_authenticated = false;
 	is_static_zone = false;
@@ -131,12 +132,19 @@ bool ZoneServer::SetZone(uint32 iZoneID, uint32 iInstanceID, bool iStaticZone) {
 		strcpy(long_name, "");
 	}
 
+	zoneserver_list.UpdateRouting(this);
+
 	client_list.ZoneBootup(this);
 	zone_boot_timer.Start();
 
 	return true;
 }
 
+void ZoneServer::SetInstanceID(uint32 i) {
+	instance_id = i;
+	zoneserver_list.UpdateRouting(this);
+}
+
 void ZoneServer::LSShutDownUpdate(uint32 zoneid) {
 	if (WorldConfig::get()->UpdateStats) {
 		auto pack = new ServerPacket;
@@ -648,6 +656,7 @@ void ZoneServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p) {
 			zone_os_process_id = sci->process_id;
 		}
 
+		zoneserver_list.UpdateRouting(this);
 	}
 	case ServerOP_SetLaunchName: {
 		if (pack->size != sizeof(LaunchName_Struct))
@@ -658,6 +667,17 @@ void ZoneServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p) {
 		LogInfo("Zone started with name [{}] by launcher [{}]", launched_name.c_str(), launcher_name.c_str());
 		break;
 	}
+	case ServerOP_ZoneMeshListen: {
+		if (pack->size != sizeof(ServerZoneMeshListen_Struct))
+			break;
+
+		auto listen = (ServerZoneMeshListen_Struct *) pack->pBuffer;
+		mesh_port = listen->port;
+		LogInfo("Zone accepts direct zone connections on port [{}]", mesh_port);
+
+		zoneserver_list.SendZoneMeshPeers();
+		break;
+	}
 	case ServerOP_ShutdownAll: {
 		if (pack->size == 0) {
 			zoneserver_list.SendPacket(pack);
@@ -1554,6 +1574,7 @@ void ZoneServer::TriggerBootup(uint32 iZoneID, uint32 iInstanceID, const char* a
 	is_booting_up = true;
 	zone_server_zone_id = iZoneID;
 	instance_id = iInstanceID;
+	zoneserver_list.UpdateRouting(this);
 
 	auto pack = new ServerPacket(ServerOP_ZoneBootup, sizeof(ServerZoneStateChange_struct));
 	ServerZoneStateChange_struct* s = (ServerZoneStateChange_struct *)pack->pBuffer;
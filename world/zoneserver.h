@@ -74,7 +74,8 @@ public:
 	std::string         GetUUID() const { return tcpc->GetUUID(); }
 
 	inline uint32		GetInstanceID() { return instance_id; }
-	inline void			SetInstanceID(uint32 i) { instance_id = i; }
+	void				SetInstanceID(uint32 i);
+	inline uint16		GetMeshPort() const { return mesh_port; }
 
 	inline uint32		GetZoneOSProcessID() { return zone_os_process_id; }
 
@@ -86,6 +87,7 @@ private:
 	char	client_address[250];
 	char	client_local_address[250];
 	uint16	client_port;
+	uint16	mesh_port;
 	bool	is_booting_up;
 	bool	is_static_zone;
 	bool	is_authenticated;
@@ -457,7 +457,21 @@ bool Mob::CheckWillAggro(Mob *mob) {
 	if (
 		x_range > aggro_range ||
 		y_range > aggro_range ||
-		z_range > aggro_range ||
+		z_range > aggro_range
+	) {
+		return false;
+	}
+
+	// range is the cheapest reject there is, everything after this costs more
+	float distance_squared = DistanceSquared(mob->GetPosition(), m_Position);
+	float aggro_range_squared = (aggro_range * aggro_range);
+
+	if (distance_squared > aggro_range_squared ) {
+		// Skip it, out of range
+		return false;
+	}
+
+	if (
 		mob->IsInvisible(this) ||
 		(
 			mob->IsClient() &&
@@ -490,14 +504,6 @@ bool Mob::CheckWillAggro(Mob *mob) {
 		return false;
 	}
 
-	float distance_squared = DistanceSquared(mob->GetPosition(), m_Position);
-	float aggro_range_squared = (aggro_range * aggro_range);
-
-	if (distance_squared > aggro_range_squared ) {
-		// Skip it, out of range
-		return false;
-	}
-
 	//Image: Get their current target and faction value now that its required
 	//this function call should seem backwards
 	FACTION_VALUE faction_value = mob->GetReverseFactionCon(this);
@@ -31,9 +31,12 @@
 #include "object.h"
 #include "zone.h"
 #include "doors.h"
+#include "../common/opcode_stats.h"
 #include <iostream>
 
 extern Zone *zone;
+extern OpcodeStats client_opcode_stats;
+extern OpcodeStats server_opcode_stats;
 
 /**
  * @param connection
@@ -161,6 +164,48 @@ Json::Value ApiGetOpcodeList(EQ::Net::WebsocketServerConnection *connection, Jso
 	return response;
 }
 
+Json::Value ApiOpcodeStatistics(OpcodeStats &stats, bool is_server)
+{
+	std::vector<OpcodeStats::Entry> entries;
+	stats.GetWindow(entries);
+
+	Json::Value response = Json::arrayValue;
+	for (auto &e : entries) {
+		Json::Value row;
+
+		row["opcode"]    = e.opcode;
+		row["name"]      = is_server ? fmt::format("0x{:04x}", e.opcode) : OpcodeManager::EmuToName((EmuOpcode) e.opcode);
+		row["calls"]     = (Json::UInt64) e.counters.calls;
+		row["total_us"]  = (Json::UInt64) (e.counters.total_ns / 1000);
+		row["max_us"]    = (Json::UInt64) (e.counters.max_ns / 1000);
+		row["bytes_in"]  = (Json::UInt64) e.counters.bytes_in;
+		row["sent"]      = (Json::UInt64) e.counters.sent;
+		row["bytes_out"] = (Json::UInt64) e.counters.bytes_out;
+
+		response.append(row);
+	}
+
+	return response;
+}
+
+/**
+ * Per opcode handler time and traffic over the rolling window, see OpcodeStats
+ *
+ * @param connection
+ * @param params
+ * @return
+ */
+Json::Value ApiGetOpcodeStatistics(EQ::Net::WebsocketServerConnection *connection, Json::Value params)
+{
+	Json::Value response;
+	response["enabled"]        = client_opcode_stats.IsEnabled();
+	response["window_seconds"] = client_opcode_stats.GetWindowSeconds();
+	response["client"]         = ApiOpcodeStatistics(client_opcode_stats, false);
+	response["server"]         = ApiOpcodeStatistics(server_opcode_stats, true);
+
+	return response;
+}
+
 Json::Value ApiGetNpcListDetail(EQ::Net::WebsocketServerConnection *connection, Json::Value params)
 {
 	if (zone->GetZoneID() == 0) {
@@ -844,6 +889,7 @@ Json::Value ApiGetLogsysCategories(EQ::Net::WebsocketServerConnection *connectio
 		row["log_to_console"]           = LogSys.log_settings[i].log_to_console;
 		row["log_to_file"]              = LogSys.log_settings[i].log_to_file;
 		row["log_to_gmsay"]             = LogSys.log_settings[i].log_to_gmsay;
+		row["log_to_binary"]            = LogSys.log_settings[i].log_to_binary;
 
 		response.append(row);
 	}
@@ -904,6 +950,7 @@ void RegisterApiService(std::unique_ptr<EQ::Net::WebsocketServer> &server)
 	server->SetLoginHandler(CheckLogin);
 	server->SetMethodHandler("get_packet_statistics", &ApiGetPacketStatistics, 50);
 	server->SetMethodHandler("get_opcode_list", &ApiGetOpcodeList, 50);
+	server->SetMethodHandler("get_opcode_statistics", &ApiGetOpcodeStatistics, 50);
 	server->SetMethodHandler("get_npc_list_detail", &ApiGetNpcListDetail, 50);
 	server->SetMethodHandler("get_door_list_detail", &ApiGetDoorListDetail, 50);
 	server->SetMethodHandler("get_corpse_list_detail", &ApiGetCorpseListDetail, 50);
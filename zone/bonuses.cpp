@@ -1843,6 +1843,9 @@ void Mob::CalcSpellBonuses(StatBonuses* newbon)
 {
 	int i;
 
+	// bonuses are recalculated after buffs are loaded or copied in wholesale
+	InvalidateBuffStackCache();
+
 	memset(newbon, 0, sizeof(StatBonuses));
 	newbon->AggroRange = -1;
 	newbon->AssistRange = -1;
@@ -9114,6 +9114,7 @@ void EntityList::AddBot(Bot *newBot, bool SendSpawnPacket, bool dontqueue) {
 		}
 		bot_list.push_back(newBot);
 		mob_list.insert(std::pair<uint16, Mob*>(newBot->GetID(), newBot));
+		mob_positions.Add(newBot);
 	}
 }
 
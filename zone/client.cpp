@@ -65,6 +65,7 @@ extern volatile bool RunLoops;
 
 #include "../common/repositories/character_spells_repository.h"
 #include "../common/repositories/character_disciplines_repository.h"
+#include "../common/opcode_stats.h"
 
 
 extern QueryServ* QServ;
@@ -74,6 +75,7 @@ extern volatile bool is_zone_loaded;
 extern WorldServer worldserver;
 extern uint32 numclients;
 extern PetitionList petition_list;
+extern OpcodeStats client_opcode_stats;
 bool commandlogged;
 char entirecommand[255];
 
@@ -256,6 +258,10 @@ Client::Client(EQStreamInterface* ieqs)
 	horseId = 0;
 	tgb = false;
 	tribute_master_id = 0xFFFFFFFF;
+	faction_con_cache_race = 0;
+	faction_con_cache_class = 0;
+	faction_con_cache_deity = 0;
+	faction_con_cache_bonus_version = 0;
 	tribute_timer.Disable();
 	task_state         = nullptr;
 	TotalSecondsPlayed = 0;
@@ -805,8 +811,10 @@ void Client::QueuePacket(const EQApplicationPacket* app, bool ack_req, CLIENT_CO
 		AddPacket(app, ack_req);
 	}
 	else
-		if(eqs)
+		if(eqs) {
+			client_opcode_stats.RecordSent(app->GetOpcode(), app->size);
 			eqs->QueuePacket(app, ack_req);
+		}
 }
 
 void Client::FastQueuePacket(EQApplicationPacket** app, bool ack_req, CLIENT_CONN_STATUS required_state) {
@@ -817,8 +825,10 @@ void Client::FastQueuePacket(EQApplicationPacket** app, bool ack_req, CLIENT_CON
 		return;
 	}
 	else {
-		if(eqs)
+		if(eqs) {
+			client_opcode_stats.RecordSent((*app)->GetOpcode(), (*app)->size);
 			eqs->FastQueuePacket((EQApplicationPacket **)app, ack_req);
+		}
 		else if (app && (*app))
 			delete *app;
 		*app = nullptr;
@@ -7841,8 +7851,10 @@ FACTION_VALUE Client::GetReverseFactionCon(Mob* iOther) {
 
 bool Client::ReloadCharacterFaction(Client *c, uint32 facid, uint32 charid)
 {
-	if (database.SetCharacterFactionLevel(charid, facid, 0, 0, factionvalues))
+	if (database.SetCharacterFactionLevel(charid, facid, 0, 0, factionvalues)) {
+		InvalidateFactionConCache();
 		return true;
+	}
 	else
 		return false;
 }
@@ -7881,16 +7893,37 @@ FACTION_VALUE Client::GetFactionLevel(uint32 char_id, uint32 npc_id, uint32 p_ra
 	//First get the NPC's Primary faction
 	if(pFaction > 0)
 	{
+		if (
+			faction_con_cache_race != p_race ||
+			faction_con_cache_class != p_class ||
+			faction_con_cache_deity != p_deity ||
+			faction_con_cache_bonus_version != faction_bonus_version
+		) {
+			faction_con_cache.clear();
+			faction_con_cache_race = p_race;
+			faction_con_cache_class = p_class;
+			faction_con_cache_deity = p_deity;
+			faction_con_cache_bonus_version = faction_bonus_version;
+		}
+
+		auto cached = faction_con_cache.find(pFaction);
+		if (cached != faction_con_cache.end()) {
+			fac = cached->second;
+		}
 		//Get the faction data from the database
-		if(content_db.GetFactionData(&fmods, p_class, p_race, p_deity, pFaction))
-		{
-			//Get the players current faction with pFaction
-			tmpFactionValue = GetCharacterFactionLevel(pFaction);
-			//Tack on any bonuses from Alliance type spell effects
-			tmpFactionValue += GetFactionBonus(pFaction);
-			tmpFactionValue += GetItemFactionBonus(pFaction);
-			//Return the faction to the client
-			fac = CalculateFaction(&fmods, tmpFactionValue);
+		else {
+			if(content_db.GetFactionData(&fmods, p_class, p_race, p_deity, pFaction))
+			{
+				//Get the players current faction with pFaction
+				tmpFactionValue = GetCharacterFactionLevel(pFaction);
+				//Tack on any bonuses from Alliance type spell effects
+				tmpFactionValue += GetFactionBonus(pFaction);
+				tmpFactionValue += GetItemFactionBonus(pFaction);
+				//Return the faction to the client
+				fac = CalculateFaction(&fmods, tmpFactionValue);
+			}
+
+			faction_con_cache[pFaction] = fac;
 		}
 	}
 	else
@@ -8075,6 +8108,7 @@ void Client::UpdatePersonalFaction(int32 char_id, int32 npc_value, int32 faction
 			*current_value = this_faction_min;
 
 		database.SetCharacterFactionLevel(char_id, faction_id, *current_value, temp, factionvalues);
+		InvalidateFactionConCache();
 	}
 
 return;
@@ -680,6 +680,7 @@ public:
 	FACTION_VALUE GetReverseFactionCon(Mob* iOther);
 	FACTION_VALUE GetFactionLevel(uint32 char_id, uint32 npc_id, uint32 p_race, uint32 p_class, uint32 p_deity, int32 pFaction, Mob* tnpc);
 	bool ReloadCharacterFaction(Client *c, uint32 facid, uint32 charid);
+	void InvalidateFactionConCache() { faction_con_cache.clear(); }
 	int32 GetCharacterFactionLevel(int32 faction_id);
 	int32 GetModCharacterFactionLevel(int32 faction_id);
 	void MerchantRejectMessage(Mob *merchant, int primaryfaction);
@@ -1634,6 +1635,7 @@ public:
 
 protected:
 	friend class Mob;
+	friend class ZoneBenchmark;
 	void CalcItemBonuses(StatBonuses* newbon);
 	void AddItemBonuses(const EQ::ItemInstance *inst, StatBonuses* newbon, bool isAug = false, bool isTribute = false, int rec_override = 0, bool ammo_slot_item = false);
 	void AdditiveWornBonuses(const EQ::ItemInstance *inst, StatBonuses* newbon, bool isAug = false);
@@ -1882,6 +1884,16 @@ private:
 
 	faction_map factionvalues;
 
+	/**
+	 * Primary faction id -> standing before the per NPC adjustments in GetFactionLevel, for the
+	 * race / class / deity and bonus version below; cleared on any faction hit
+	 */
+	std::unordered_map<int32, FACTION_VALUE> faction_con_cache;
+	uint32 faction_con_cache_race;
+	uint32 faction_con_cache_class;
+	uint32 faction_con_cache_deity;
+	uint32 faction_con_cache_bonus_version;
+
 	uint32 tribute_master_id;
 
 	bool npcflag;
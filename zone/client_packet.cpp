@@ -66,6 +66,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 #include "../common/repositories/character_instance_safereturns_repository.h"
 #include "../common/repositories/criteria/content_filter_criteria.h"
 #include "../common/shared_tasks.h"
+#include "../common/opcode_stats.h"
 #include "gm_commands/door_manipulation.h"
 #include "client.h"
 
@@ -80,6 +81,7 @@ extern volatile bool is_zone_loaded;
 extern WorldServer worldserver;
 extern PetitionList petition_list;
 extern EntityList entity_list;
+extern OpcodeStats client_opcode_stats;
 typedef void (Client::*ClientPacketProc)(const EQApplicationPacket *app);
 
 
@@ -482,7 +484,10 @@ int Client::HandlePacket(const EQApplicationPacket *app)
 		p = ConnectingOpcodes[opcode];
 
 		//call the processing routine
-		(this->*p)(app);
+		{
+			OpcodeStats::Scope stats_scope(client_opcode_stats, opcode, app->size);
+			(this->*p)(app);
+		}
 
 		//special case where connecting code needs to boot client...
 		if (client_state == CLIENT_KICKED) {
@@ -508,6 +513,7 @@ int Client::HandlePacket(const EQApplicationPacket *app)
 		}
 
 		//call the processing routine
+		OpcodeStats::Scope stats_scope(client_opcode_stats, opcode, app->size);
 		(this->*p)(app);
 		break;
 	}
@@ -1193,6 +1199,7 @@ void Client::Handle_Connect_OP_ZoneEntry(const EQApplicationPacket *app)
 	/* Flush and reload factions */
 	database.RemoveTempFactions(this);
 	database.LoadCharacterFactionValues(cid, factionvalues);
+	InvalidateFactionConCache();
 
 	/* Load Character Account Data: Temp until I move */
 	query = StringFormat("SELECT `status`, `name`, `ls_id`, `lsaccount_id`, `gmspeed`, `revoked`, `hideme`, `time_creation` FROM `account` WHERE `id` = %u", this->AccountID());
@@ -4617,6 +4624,7 @@ void Client::Handle_OP_ClientUpdate(const EQApplicationPacket *app) {
 	m_Position.x = cx;
 	m_Position.y = cy;
 	m_Position.z = cz;
+	entity_list.UpdateMobPosition(this);
 
 	/* Visual Debugging */
 	if (RuleB(Character, OPClientUpdateVisualDebug)) {
@@ -53,6 +53,7 @@
 #include "string_ids.h"
 #include "worldserver.h"
 #include "zone.h"
+#include "zone_benchmark.h"
 #include "zonedb.h"
 #include "zone_store.h"
 
@@ -252,8 +253,10 @@ bool Client::Process() {
 			CheckMercSuspendTimer();
 		}
 
-		if (IsAIControlled())
+		if (IsAIControlled()) {
+			ZoneBenchmark::Stage stage(ZoneBenchmark::StageAI);
 			AI_Process();
+		}
 
 		// Don't reset the bindwound timer so we can check it in BindWound as well.
 		if (bindwound_timer.Check(false) && bindwound_target != 0) {
@@ -500,7 +503,10 @@ bool Client::Process() {
 			DoHPRegen();
 			DoManaRegen();
 			DoEnduranceRegen();
-			BuffProcess();
+			{
+				ZoneBenchmark::Stage stage(ZoneBenchmark::StageBuffs);
+				BuffProcess();
+			}
 
 			if (tribute_timer.Check()) {
 				ToggleTribute(true);	//re-activate the tribute.
@@ -588,6 +594,8 @@ bool Client::Process() {
 	//place, now check to see if anybody wants to aggro us.
 	// only if client is not feigned
 	if (zone->CanDoCombat() && ret && !GetFeigned() && client_scan_npc_aggro_timer.Check()) {
+		ZoneBenchmark::Stage stage(ZoneBenchmark::StageAggroScan);
+
 		int npc_scan_count = 0;
 		for (auto & close_mob : close_mobs) {
 			Mob *mob = close_mob.second;
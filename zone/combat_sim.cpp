@@ -0,0 +1,435 @@
+#include "combat_sim.h"
+#include "../common/string_util.h"
+#include "entity.h"
+#include "npc.h"
+#include "zone.h"
+#include "zonedb.h"
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#ifndef _WINDOWS
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+extern EntityList entity_list;
+extern Zone       *zone;
+
+void CombatSim::Results::Merge(const Results &r)
+{
+	swings += r.swings;
+	hits += r.hits;
+	misses += r.misses;
+	blocks += r.blocks;
+	parries += r.parries;
+	ripostes += r.ripostes;
+	dodges += r.dodges;
+	other += r.other;
+	total_damage += r.total_damage;
+	max_damage = std::max(max_damage, r.max_damage);
+
+	for (int i = 0; i < DamageBuckets; ++i) {
+		damage[i] += r.damage[i];
+	}
+
+	for (int i = 0; i < MitigationBuckets; ++i) {
+		mitigation[i] += r.mitigation[i];
+	}
+}
+
+bool CombatSim::ParseArgs(int argc, char **argv, Options &options)
+{
+	if (argc < 5 || strcasecmp(argv[1], "combatsim") != 0) {
+		return false;
+	}
+
+	options.zone_name         = argv[2];
+	options.attacker_npc_type = (uint32) strtoul(argv[3], nullptr, 10);
+	options.defender_npc_type = (uint32) strtoul(argv[4], nullptr, 10);
+
+	for (int i = 5; i < argc; ++i) {
+		std::string arg = argv[i];
+		auto        eq  = arg.find('=');
+		if (eq == std::string::npos) {
+			continue;
+		}
+
+		std::string key   = arg.substr(0, eq);
+		std::string value = arg.substr(eq + 1);
+
+		if (key == "swings") {
+			options.swings = std::max((uint64) 1, (uint64) strtoull(value.c_str(), nullptr, 10));
+		}
+		else if (key == "seed") {
+			options.seed = (uint32) strtoul(value.c_str(), nullptr, 10);
+		}
+		else if (key == "workers") {
+			options.workers = std::max(1, atoi(value.c_str()));
+		}
+		else if (key.compare(0, 9, "attacker.") == 0) {
+			options.attacker_overrides[key.substr(9)] = value;
+		}
+		else if (key.compare(0, 9, "defender.") == 0) {
+			options.defender_overrides[key.substr(9)] = value;
+		}
+	}
+
+	return true;
+}
+
+CombatSim::CombatSim(const Options &options)
+	: m_options(options),
+	m_attacker(nullptr),
+	m_defender(nullptr),
+	m_damage_bucket_size(1)
+{
+}
+
+CombatSim::~CombatSim()
+{
+}
+
+NPC *CombatSim::Spawn(
+	uint32 npc_type_id,
+	const std::map<std::string, std::string> &overrides,
+	float offset,
+	std::unique_ptr<NPCType> &type
+)
+{
+	auto loaded = content_db.LoadNPCTypesData(npc_type_id);
+	if (!loaded) {
+		printf("No npc type [%u]\n", npc_type_id);
+		return nullptr;
+	}
+
+	type = std::make_unique<NPCType>(*loaded);
+
+	for (auto &o : overrides) {
+		int value = atoi(o.second.c_str());
+
+		if (o.first == "level") {
+			type->level = (uint8) value;
+		}
+		else if (o.first == "ac") {
+			type->AC = (uint32) value;
+		}
+		else if (o.first == "atk") {
+			type->ATK = (uint32) value;
+		}
+		else if (o.first == "str") {
+			type->STR = (uint32) value;
+		}
+		else if (o.first == "dex") {
+			type->DEX = (uint32) value;
+		}
+		else if (o.first == "agi") {
+			type->AGI = (uint32) value;
+		}
+		else if (o.first == "accuracy") {
+			type->accuracy_rating = value;
+		}
+		else if (o.first == "avoidance") {
+			type->avoidance_rating = value;
+		}
+		else if (o.first == "min_dmg") {
+			type->min_dmg = (uint32) value;
+		}
+		else if (o.first == "max_dmg") {
+			type->max_dmg = (uint32) value;
+		}
+		else if (o.first == "attack_delay") {
+			type->attack_delay = value;
+		}
+		else {
+			printf("Unknown profile stat [%s], ignored\n", o.first.c_str());
+		}
+	}
+
+	auto position = zone->GetSafePoint();
+	position.x += offset;
+	position.w = offset > 0.0f ? 384.0f : 128.0f;
+
+	auto npc = new NPC(type.get(), nullptr, position, GravityBehavior::Water);
+	entity_list.AddNPC(npc, false);
+
+	return npc;
+}
+
+void CombatSim::Simulate(uint32 seed, uint64 swings, Results &results)
+{
+	memset(&results, 0, sizeof(Results));
+
+	zone->random.Reseed(seed);
+
+	auto skill = static_cast<EQ::skills::SkillType>(m_attacker->GetPrimSkill());
+	int  full  = std::max(1, m_attacker->GetMinDamage() + m_attacker->GetBaseDamage());
+
+	for (uint64 i = 0; i < swings; ++i) {
+		m_attacker->SetHP(m_attacker->GetMaxHP());
+		m_defender->SetHP(m_defender->GetMaxHP());
+
+		DamageHitInfo hit;
+		hit.skill       = skill;
+		hit.hand        = EQ::invslot::slotPrimary;
+		hit.damage_done = 1;
+		hit.base_damage = m_attacker->GetBaseDamage();
+		hit.min_damage  = m_attacker->GetMinDamage();
+		hit.offense     = m_attacker->offense(hit.skill);
+		hit.tohit       = m_attacker->GetTotalToHit(hit.skill, 0);
+
+		m_attacker->DoAttack(m_defender, hit);
+
+		results.swings++;
+
+		switch (hit.damage_done) {
+			case 0:
+				results.misses++;
+				break;
+			case DMG_BLOCKED:
+				results.blocks++;
+				break;
+			case DMG_PARRIED:
+				results.parries++;
+				break;
+			case DMG_RIPOSTED:
+				results.ripostes++;
+				break;
+			case DMG_DODGED:
+				results.dodges++;
+				break;
+			default:
+				if (hit.damage_done > 0) {
+					auto damage = (uint64) hit.damage_done;
+					results.hits++;
+					results.total_damage += damage;
+					results.max_damage = std::max(results.max_damage, damage);
+					results.damage[std::min((int) (damage / m_damage_bucket_size), DamageBuckets - 1)]++;
+
+					// 10% of the unmitigated max hit per bucket
+					int percent = (int) (damage * 100 / full);
+					results.mitigation[std::min(percent / 10, MitigationBuckets - 1)]++;
+				}
+				else {
+					results.other++;
+				}
+				break;
+		}
+	}
+
+	m_attacker->WipeHateList();
+	m_defender->WipeHateList();
+}
+
+bool CombatSim::Run()
+{
+	if (!zone) {
+		return false;
+	}
+
+	m_attacker = Spawn(m_options.attacker_npc_type, m_options.attacker_overrides, -5.0f, m_attacker_type);
+	m_defender = Spawn(m_options.defender_npc_type, m_options.defender_overrides, 5.0f, m_defender_type);
+	if (!m_attacker || !m_defender) {
+		return false;
+	}
+
+	// ripostes are rolled but can't hurt the attacker
+	m_attacker->SetInvul(true);
+	m_attacker->SetTarget(m_defender);
+	m_defender->SetTarget(m_attacker);
+
+	// twice the unmitigated max hit covers crits
+	int full = std::max(1, m_attacker->GetMinDamage() + m_attacker->GetBaseDamage());
+	m_damage_bucket_size = std::max(1, (full * 2 + DamageBuckets - 1) / DamageBuckets);
+
+	int    workers = std::max(1, m_options.workers);
+	uint64 share   = m_options.swings / workers;
+
+	printf(
+		"Simulating %llu swings of [%s] (level %u) against [%s] (level %u) over %d worker%s, seed %u\n",
+		(unsigned long long) m_options.swings,
+		m_attacker->GetCleanName(),
+		m_attacker->GetLevel(),
+		m_defender->GetCleanName(),
+		m_defender->GetLevel(),
+		workers,
+		workers == 1 ? "" : "s",
+		m_options.seed
+	);
+	fflush(stdout);
+
+	Results total;
+	memset(&total, 0, sizeof(Results));
+
+	auto started = std::chrono::steady_clock::now();
+
+#ifndef _WINDOWS
+	if (workers > 1) {
+		// zone state isn't thread safe, so each worker gets its own copy of it
+		std::vector<std::pair<pid_t, int>> children;
+
+		// write out what is queued now so no worker inherits, and never writes, a half drained log
+		LogSys.FlushLogs();
+
+		for (int w = 0; w < workers; ++w) {
+			uint64 swings = share + (w == workers - 1 ? m_options.swings % workers : 0);
+
+			int fds[2];
+			if (pipe(fds) != 0) {
+				break;
+			}
+
+			pid_t pid = fork();
+			if (pid == 0) {
+				close(fds[0]);
+
+				// the async log writer thread doesn't exist in the child, so workers don't log
+				for (auto &setting : LogSys.log_settings) {
+					setting.log_to_file         = 0;
+					setting.log_to_console      = 0;
+					setting.log_to_gmsay        = 0;
+					setting.log_to_binary       = 0;
+					setting.is_category_enabled = 0;
+				}
+
+				Results results;
+				Simulate(m_options.seed + w, swings, results);
+
+				const char *data   = (const char *) &results;
+				size_t     remain  = sizeof(Results);
+				while (remain > 0) {
+					ssize_t written = write(fds[1], data, remain);
+					if (written <= 0) {
+						break;
+					}
+					data += written;
+					remain -= written;
+				}
+
+				close(fds[1]);
+				_exit(0);
+			}
+
+			close(fds[1]);
+			if (pid < 0) {
+				close(fds[0]);
+				break;
+			}
+
+			children.push_back(std::make_pair(pid, fds[0]));
+		}
+
+		for (auto &child : children) {
+			Results results;
+			char    *data  = (char *) &results;
+			size_t  remain = sizeof(Results);
+			while (remain > 0) {
+				ssize_t got = read(child.second, data, remain);
+				if (got <= 0) {
+					break;
+				}
+				data += got;
+				remain -= got;
+			}
+
+			close(child.second);
+			waitpid(child.first, nullptr, 0);
+
+			if (remain == 0) {
+				total.Merge(results);
+			}
+			else {
+				printf("Worker %d did not report\n", (int) child.first);
+			}
+		}
+	}
+	else
+#endif
+	{
+		for (int w = 0; w < workers; ++w) {
+			uint64 swings = share + (w == workers - 1 ? m_options.swings % workers : 0);
+
+			Results results;
+			Simulate(m_options.seed + w, swings, results);
+			total.Merge(results);
+		}
+	}
+
+	auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(
+		std::chrono::steady_clock::now() - started
+	).count();
+
+	printf("%.2fs, %.0f swings/s\n", elapsed, elapsed > 0.0 ? total.swings / elapsed : 0.0);
+
+	Report(total);
+
+	// RemoveMob takes them out of every entity list and deletes them
+	entity_list.RemoveMob(m_attacker->GetID());
+	entity_list.RemoveMob(m_defender->GetID());
+	m_attacker = nullptr;
+	m_defender = nullptr;
+
+	return true;
+}
+
+void CombatSim::Report(const Results &results)
+{
+	if (results.swings == 0) {
+		return;
+	}
+
+	auto percent = [&](uint64 count) {
+		return count * 100.0 / results.swings;
+	};
+
+	printf("\n%-10s %12s %8s\n", "outcome", "count", "%");
+	printf("%-10s %12llu %7.2f%%\n", "hit", (unsigned long long) results.hits, percent(results.hits));
+	printf("%-10s %12llu %7.2f%%\n", "miss", (unsigned long long) results.misses, percent(results.misses));
+	printf("%-10s %12llu %7.2f%%\n", "block", (unsigned long long) results.blocks, percent(results.blocks));
+	printf("%-10s %12llu %7.2f%%\n", "parry", (unsigned long long) results.parries, percent(results.parries));
+	printf("%-10s %12llu %7.2f%%\n", "riposte", (unsigned long long) results.ripostes, percent(results.ripostes));
+	printf("%-10s %12llu %7.2f%%\n", "dodge", (unsigned long long) results.dodges, percent(results.dodges));
+	printf("%-10s %12llu %7.2f%%\n", "other", (unsigned long long) results.other, percent(results.other));
+
+	double per_swing = (double) results.total_damage / results.swings;
+	double delay     = m_attacker->GetAttackDelay() / 1000.0;
+
+	printf(
+		"\ndamage per swing %.2f, per hit %.2f, max hit %llu\n",
+		per_swing,
+		results.hits ? (double) results.total_damage / results.hits : 0.0,
+		(unsigned long long) results.max_damage
+	);
+	printf("dps at one primary swing per %.1fs delay: %.2f\n", delay, delay > 0.0 ? per_swing / delay : 0.0);
+
+	auto bar = [](uint64 count, uint64 most) {
+		return std::string(most ? (size_t) (count * 40 / most) : 0, '#');
+	};
+
+	uint64 most = *std::max_element(results.damage, results.damage + DamageBuckets);
+	printf("\ndamage per hit\n");
+	for (int i = 0; i < DamageBuckets; ++i) {
+		printf(
+			"%6d-%-6s %12llu %s\n",
+			i * m_damage_bucket_size,
+			i == DamageBuckets - 1 ? "" : std::to_string((i + 1) * m_damage_bucket_size - 1).c_str(),
+			(unsigned long long) results.damage[i],
+			bar(results.damage[i], most).c_str()
+		);
+	}
+
+	most = *std::max_element(results.mitigation, results.mitigation + MitigationBuckets);
+	printf("\ndamage per hit as %% of unmitigated max (%d)\n", m_attacker->GetMinDamage() + m_attacker->GetBaseDamage());
+	for (int i = 0; i < MitigationBuckets; ++i) {
+		printf(
+			"%5d%%-%-5s %12llu %s\n",
+			i * 10,
+			i == MitigationBuckets - 1 ? "" : (std::to_string((i + 1) * 10) + "%").c_str(),
+			(unsigned long long) results.mitigation[i],
+			bar(results.mitigation[i], most).c_str()
+		);
+	}
+}
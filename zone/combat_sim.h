@@ -0,0 +1,98 @@
+#ifndef EQEMU_COMBAT_SIM_H
+#define EQEMU_COMBAT_SIM_H
+
+#include "../common/types.h"
+#include <map>
+#include <memory>
+#include <string>
+
+class NPC;
+struct NPCType;
+
+/**
+ * Headless melee simulation against the real combat code
+ *
+ *   zone combatsim <zone_short_name> <attacker_npc_type> <defender_npc_type> [key=value ...]
+ *
+ *   swings=N          total primary hand swings (default 1000000)
+ *   seed=N            base seed, worker n uses seed + n (default 1)
+ *   workers=N         processes to split the swings over (default 1)
+ *   attacker.<stat>=N / defender.<stat>=N
+ *                     override the npc type: level, ac, atk, str, dex, agi, accuracy,
+ *                     avoidance, min_dmg, max_dmg, attack_delay
+ *
+ * Each swing goes through Mob::DoAttack the way NPC::Attack sets it up, so avoidance, hit
+ * chance, mitigation, the damage table and crits are the live code and live rules. Damage is
+ * never applied, both sides are healed and the attacker can't be hurt by ripostes. The same
+ * arguments always give the same numbers
+ */
+class CombatSim {
+public:
+	static const int DamageBuckets     = 20;
+	static const int MitigationBuckets = 20;
+
+	struct Options {
+		std::string                        zone_name;
+		uint32                             attacker_npc_type = 0;
+		uint32                             defender_npc_type = 0;
+		uint64                             swings            = 1000000;
+		uint32                             seed              = 1;
+		int                                workers           = 1;
+		std::map<std::string, std::string> attacker_overrides;
+		std::map<std::string, std::string> defender_overrides;
+	};
+
+	struct Results {
+		uint64 swings;
+		uint64 hits;
+		uint64 misses;
+		uint64 blocks;
+		uint64 parries;
+		uint64 ripostes;
+		uint64 dodges;
+		uint64 other;
+		uint64 total_damage;
+		uint64 max_damage;
+		uint64 damage[DamageBuckets];
+		uint64 mitigation[MitigationBuckets];
+
+		void Merge(const Results &r);
+	};
+
+	/**
+	 * @param argc
+	 * @param argv
+	 * @param options filled when argv asks for a simulation
+	 * @return true when this is a simulation run
+	 */
+	static bool ParseArgs(int argc, char **argv, Options &options);
+
+	CombatSim(const Options &options);
+	~CombatSim();
+
+	/**
+	 * Runs the simulation and prints the report, call once the zone is booted
+	 *
+	 * @return false when a profile couldn't be built
+	 */
+	bool Run();
+
+private:
+	NPC *Spawn(
+		uint32 npc_type_id,
+		const std::map<std::string, std::string> &overrides,
+		float offset,
+		std::unique_ptr<NPCType> &type
+	);
+	void Simulate(uint32 seed, uint64 swings, Results &results);
+	void Report(const Results &results);
+
+	Options                  m_options;
+	std::unique_ptr<NPCType> m_attacker_type;
+	std::unique_ptr<NPCType> m_defender_type;
+	NPC                      *m_attacker;
+	NPC                      *m_defender;
+	int                      m_damage_bucket_size;
+};
+
+#endif //EQEMU_COMBAT_SIM_H
@@ -239,6 +239,7 @@ int command_init(void)
 		command_add("loc", "- Print out your or your target's current location and heading", AccountStatus::Player, command_loc) ||
 		command_add("lock", "- Lock the worldserver", AccountStatus::GMLeadAdmin, command_lock) ||
 		command_add("logs",  "Manage anything to do with logs", AccountStatus::GMImpossible, command_logs) ||
+		command_add("luaprofile", "[on|off|show|reset|interval|budget] - Profile lua quest handlers and limit their instruction count", AccountStatus::GMAdmin, command_luaprofile) ||
 		command_add("makepet", "[level] [class] [race] [texture] - Make a pet", AccountStatus::Guide, command_makepet) ||
 		command_add("mana", "- Fill your or your target's mana", AccountStatus::Guide, command_mana) ||
 		command_add("maxskills", "Maxes skills for you.", AccountStatus::GMMgmt, command_max_all_skills) ||
@@ -273,6 +274,7 @@ int command_init(void)
 		command_add("object", "List|Add|Edit|Move|Rotate|Copy|Save|Undo|Delete - Manipulate static and tradeskill objects within the zone", AccountStatus::GMAdmin, command_object) ||
 		command_add("oocmute", "[1/0] - Mutes OOC chat", AccountStatus::GMMgmt, command_oocmute) ||
 		command_add("opcode", "- opcode management", AccountStatus::GMImpossible, command_opcode) ||
+		command_add("opcodestats", "[client|server] [calls|time|max|bytes] [count] or reset - Shows the busiest opcode handlers over the last minute", AccountStatus::GMMgmt, command_opcodestats) ||
 		command_add("path", "- view and edit pathing", AccountStatus::GMMgmt, command_path) ||
 		command_add("peekinv", "[equip/gen/cursor/poss/limbo/curlim/trib/bank/shbank/allbank/trade/world/all] - Print out contents of your player target's inventory", AccountStatus::GMAdmin, command_peekinv) ||
 		command_add("peqzone", "[Zone ID|Zone Short Name] - Teleports you to the specified zone if you meet the requirements.", AccountStatus::Player, command_peqzone) ||
@@ -148,6 +148,7 @@ void command_load_shared_memory(Client *c, const Seperator *sep);
 void command_loc(Client *c, const Seperator *sep);
 void command_lock(Client *c, const Seperator *sep);
 void command_logs(Client *c, const Seperator *sep);
+void command_luaprofile(Client *c, const Seperator *sep);
 void command_makepet(Client *c, const Seperator *sep);
 void command_mana(Client *c, const Seperator *sep);
 void command_max_all_skills(Client *c, const Seperator *sep);
@@ -182,6 +183,7 @@ void command_nukeitem(Client *c, const Seperator *sep);
 void command_object(Client *c, const Seperator *sep);
 void command_oocmute(Client *c, const Seperator *sep);
 void command_opcode(Client *c, const Seperator *sep);
+void command_opcodestats(Client *c, const Seperator *sep);
 void command_bestz(Client *c, const Seperator *message);
 void command_pf(Client *c, const Seperator *message);
 
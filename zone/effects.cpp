@@ -935,14 +935,11 @@ void EntityList::AESpell(
 					   caster_mob->GetTargetRingLocation() :
 					   static_cast<glm::vec3>(center_mob->GetPosition());
 
-	Mob       *current_mob         = nullptr;
-	bool      is_detrimental_spell = IsDetrimentalSpell(spell_id);
-	bool      is_npc               = caster_mob->IsNPC();
-	float     distance             = caster_mob->GetAOERange(spell_id);
-	float     distance_squared     = distance * distance;
-	float     min_range2           = spells[spell_id].min_range * spells[spell_id].min_range;
-	glm::vec2 min                  = {cast_target_position.x - distance, cast_target_position.y - distance};
-	glm::vec2 max                  = {cast_target_position.x + distance, cast_target_position.y + distance};
+	bool  is_detrimental_spell = IsDetrimentalSpell(spell_id);
+	bool  is_npc               = caster_mob->IsNPC();
+	float distance             = caster_mob->GetAOERange(spell_id);
+	float distance_squared     = distance * distance;
+	float min_range2           = spells[spell_id].min_range * spells[spell_id].min_range;
 
 	/**
 	 * If using Old Rain Targets - there is no max target limitation
@@ -968,19 +965,37 @@ void EntityList::AESpell(
 	int   target_hit_counter = 0;
 	float distance_to_target = 0;
 
-	LogAoeCast(
-		"Close scan distance [{}] cast distance [{}]",
-		RuleI(Range, MobCloseScanDistance),
-		distance
+	/**
+	 * Type filters the position table can apply before we touch any mob
+	 * pcnpc_only_flag 1 = PC, 2 = NPC
+	 */
+	uint8 require_flags = 0;
+	uint8 exclude_flags = 0;
+	if (spells[spell_id].pcnpc_only_flag == 1) {
+		require_flags = MobPositionTable::FlagPlayerSide;
+	}
+	else if (spells[spell_id].pcnpc_only_flag == 2) {
+		exclude_flags = MobPositionTable::FlagPlayerSide;
+	}
+
+	std::vector<Mob *> in_range;
+	mob_positions.QueryRange(
+		cast_target_position.x,
+		cast_target_position.y,
+		cast_target_position.z,
+		distance_squared,
+		require_flags,
+		exclude_flags,
+		-1.0f,
+		in_range
 	);
 
-	for (auto &it : entity_list.GetCloseMobList(caster_mob, distance)) {
-		current_mob = it.second;
+	LogAoeCast("Cast distance [{}] candidates [{}]", distance, in_range.size());
 
-		if (!current_mob) {
-			continue;
-		}
+	// every HP change from this AE goes out once per target when we are done
+	StartHPUpdateBatch();
 
+	for (auto current_mob : in_range) {
 		LogAoeCast("Checking AOE against mob [{}]", current_mob->GetCleanName());
 
 		if (current_mob->IsClient() && !current_mob->CastToClient()->ClientFinishedLoading()) {
@@ -1003,25 +1018,6 @@ void EntityList::AESpell(
 			continue;
 		}
 
-		/**
-		 * Check PC / NPC
-		 * 1 = PC
-		 * 2 = NPC
-		 */
-		if (spells[spell_id].pcnpc_only_flag == 1 && !current_mob->IsClient() && !current_mob->IsMerc() &&
-		    !current_mob->IsBot()) {
-			continue;
-		}
-
-		if (spells[spell_id].pcnpc_only_flag == 2 &&
-		    (current_mob->IsClient() || current_mob->IsMerc() || current_mob->IsBot())) {
-			continue;
-		}
-
-		if (!IsWithinAxisAlignedBox(static_cast<glm::vec2>(current_mob->GetPosition()), min, max)) {
-			continue;
-		}
-
 		distance_to_target = DistanceSquared(current_mob->GetPosition(), cast_target_position);
 
 		if (distance_to_target > distance_squared) {
@@ -1101,6 +1097,8 @@ void EntityList::AESpell(
 		}
 	}
 
+	FlushHPUpdateBatch();
+
 	LogAoeCast("Done iterating [{}]", caster_mob->GetCleanName());
 
 	if (max_targets && max_targets_allowed) {
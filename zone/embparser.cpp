@@ -1113,111 +1113,29 @@ void PerlembParser::ExportQGlobals(
 		//only export for npcs that are global enabled.
 		if (npcmob && npcmob->GetQglobal()) {
 			std::map<std::string, std::string> globhash;
-			QGlobalCache                       *npc_c  = nullptr;
-			QGlobalCache                       *char_c = nullptr;
-			QGlobalCache                       *zone_c = nullptr;
+			Client                             *client = (mob && mob->IsClient()) ? mob->CastToClient() : nullptr;
 
-			//retrieve our globals
-			npc_c  = npcmob->GetQGlobals();
-			if (mob && mob->IsClient()) {
-				char_c = mob->CastToClient()->GetQGlobals();
-			}
-			zone_c = zone->GetQGlobals();
-
-			if (!npc_c) {
-				npc_c = npcmob->CreateQGlobals();
-				npc_c->LoadByNPCID(npcmob->GetNPCTypeID());
-			}
-
-			if (!char_c) {
-				if (mob && mob->IsClient()) {
-					char_c = mob->CastToClient()->CreateQGlobals();
-					char_c->LoadByCharID(mob->CastToClient()->CharacterID());
+			QGlobalView view(npcmob, client, zone);
+			view.ForEach(
+				[&](const QGlobal &global) {
+					globhash[global.name] = global.value;
+					ExportVar(package_name.c_str(), global.name.c_str(), global.value.c_str());
 				}
-			}
-
-			if (!zone_c) {
-				zone_c = zone->CreateQGlobals();
-				zone_c->LoadByZoneID(zone->GetZoneID());
-				zone_c->LoadByGlobalContext();
-			}
-
-			std::list<QGlobal> globalMap;
-			if (npc_c) {
-				QGlobalCache::Combine(
-					globalMap,
-					npc_c->GetBucket(),
-					npcmob->GetNPCTypeID(),
-					char_id,
-					zone->GetZoneID());
-			}
-
-			if (char_c) {
-				QGlobalCache::Combine(
-					globalMap,
-					char_c->GetBucket(),
-					npcmob->GetNPCTypeID(),
-					char_id,
-					zone->GetZoneID());
-			}
-
-			if (zone_c) {
-				QGlobalCache::Combine(
-					globalMap,
-					zone_c->GetBucket(),
-					npcmob->GetNPCTypeID(),
-					char_id,
-					zone->GetZoneID());
-			}
-
-			auto iter = globalMap.begin();
-			while (iter != globalMap.end()) {
-				globhash[(*iter).name] = (*iter).value;
-				ExportVar(package_name.c_str(), (*iter).name.c_str(), (*iter).value.c_str());
-				++iter;
-			}
+			);
 			ExportHash(package_name.c_str(), "qglobals", globhash);
 		}
 	}
 	else {
 		std::map<std::string, std::string> globhash;
-		QGlobalCache                       *char_c = nullptr;
-		QGlobalCache                       *zone_c = nullptr;
-
-		//retrieve our globals
-		if (mob && mob->IsClient()) {
-			char_c = mob->CastToClient()->GetQGlobals();
-		}
-		zone_c                                     = zone->GetQGlobals();
+		Client                             *client = (mob && mob->IsClient()) ? mob->CastToClient() : nullptr;
 
-		if (!char_c) {
-			if (mob && mob->IsClient()) {
-				char_c = mob->CastToClient()->CreateQGlobals();
-				char_c->LoadByCharID(mob->CastToClient()->CharacterID());
+		QGlobalView view(nullptr, client, zone);
+		view.ForEach(
+			[&](const QGlobal &global) {
+				globhash[global.name] = global.value;
+				ExportVar(package_name.c_str(), global.name.c_str(), global.value.c_str());
 			}
-		}
-
-		if (!zone_c) {
-			zone_c = zone->CreateQGlobals();
-			zone_c->LoadByZoneID(zone->GetZoneID());
-			zone_c->LoadByGlobalContext();
-		}
-
-		std::list<QGlobal> globalMap;
-		if (char_c) {
-			QGlobalCache::Combine(globalMap, char_c->GetBucket(), 0, char_id, zone->GetZoneID());
-		}
-
-		if (zone_c) {
-			QGlobalCache::Combine(globalMap, zone_c->GetBucket(), 0, char_id, zone->GetZoneID());
-		}
-
-		auto iter = globalMap.begin();
-		while (iter != globalMap.end()) {
-			globhash[(*iter).name] = (*iter).value;
-			ExportVar(package_name.c_str(), (*iter).name.c_str(), (*iter).value.c_str());
-			++iter;
-		}
+		);
 		ExportHash(package_name.c_str(), "qglobals", globhash);
 	}
 }
@@ -41,6 +41,7 @@
 #include "string_ids.h"
 #include "worldserver.h"
 #include "water_map.h"
+#include "zone_benchmark.h"
 #include "npc_scale_manager.h"
 #include "../common/say_link.h"
 #include "dialogue_window.h"
@@ -308,7 +309,8 @@ EntityList::EntityList()
 	corpse_timer(2000),
 	group_timer(1000),
 	raid_timer(1000),
-	trap_timer(1000)
+	trap_timer(1000),
+	hp_update_batch_depth(0)
 {
 	// set up ids between 1 and 1500
 	// neither client or server performs well if you have
@@ -349,6 +351,7 @@ void EntityList::AddClient(Client *client)
 	client->SetID(GetFreeID());
 	client_list.insert(std::pair<uint16, Client *>(client->GetID(), client));
 	mob_list.insert(std::pair<uint16, Mob *>(client->GetID(), client));
+	mob_positions.Add(client);
 }
 
 
@@ -537,6 +540,10 @@ void EntityList::MobProcess()
 #else
 		mob_dead = !mob->Process();
 #endif
+
+		// catches positions written straight to m_Position
+		mob_positions.Update(mob);
+
 		size_t a_sz = mob_list.size();
 
 		if(a_sz > sz) {
@@ -726,6 +733,7 @@ void EntityList::AddNPC(NPC *npc, bool SendSpawnPacket, bool dontqueue)
 
 	npc_list.insert(std::pair<uint16, NPC *>(npc->GetID(), npc));
 	mob_list.insert(std::pair<uint16, Mob *>(npc->GetID(), npc));
+	mob_positions.Add(npc);
 
 	entity_list.ScanCloseMobs(npc->close_mobs, npc, true);
 
@@ -776,6 +784,7 @@ void EntityList::AddMerc(Merc *merc, bool SendSpawnPacket, bool dontqueue)
 
 		merc_list.insert(std::pair<uint16, Merc *>(merc->GetID(), merc));
 		mob_list.insert(std::pair<uint16, Mob *>(merc->GetID(), merc));
+		mob_positions.Add(merc);
 	}
 }
 
@@ -1687,6 +1696,8 @@ void EntityList::QueueCloseClients(
 		return;
 	}
 
+	ZoneBenchmark::Stage stage(ZoneBenchmark::StageQueueCloseClients);
+
 	if (distance <= 0) {
 		distance = 600;
 	}
@@ -2495,6 +2506,8 @@ void EntityList::RemoveAllMobs()
 		free_ids.push(it->first);
 		it = mob_list.erase(it);
 	}
+
+	mob_positions.Clear();
 }
 
 void EntityList::RemoveAllClients()
@@ -2635,6 +2648,7 @@ bool EntityList::RemoveMob(uint16 delete_id)
 		if (!corpse_list.count(delete_id)) {
 			free_ids.push(it->first);
 		}
+		mob_positions.Remove(delete_id);
 		mob_list.erase(it);
 		return true;
 	}
@@ -2658,6 +2672,7 @@ bool EntityList::RemoveMob(Mob *delete_mob)
 			if (!corpse_list.count(it->first)) {
 				free_ids.push(it->first);
 			}
+			mob_positions.Remove(it->first);
 			mob_list.erase(it);
 			return true;
 		}
@@ -2779,34 +2794,40 @@ void EntityList::ScanCloseMobs(
 
 	close_mobs.clear();
 
-	for (auto &e : mob_list) {
-		auto mob = e.second;
-
-		if (!mob->IsNPC() && !mob->IsClient()) {
-			continue;
-		}
+	std::vector<Mob *> in_range;
+	in_range.reserve(close_mobs.bucket_count());
+
+	mob_positions.QueryRange(
+		scanning_mob->GetX(),
+		scanning_mob->GetY(),
+		scanning_mob->GetZ(),
+		scan_range,
+		MobPositionTable::FlagNPC | MobPositionTable::FlagClient,
+		0,
+		scan_range,
+		in_range
+	);
 
+	for (auto mob : in_range) {
+		// dead mobs keep their row until depop but have already dropped their id
 		if (mob->GetID() <= 0) {
 			continue;
 		}
 
-		float distance = DistanceSquared(scanning_mob->GetPosition(), mob->GetPosition());
-		if (distance <= scan_range || mob->GetAggroRange() >= scan_range) {
-			close_mobs.insert(std::pair<uint16, Mob *>(mob->GetID(), mob));
+		close_mobs.insert(std::pair<uint16, Mob *>(mob->GetID(), mob));
 
-			if (add_self_to_other_lists && scanning_mob->GetID() > 0) {
-				bool has_mob = false;
+		if (add_self_to_other_lists && scanning_mob->GetID() > 0) {
+			bool has_mob = false;
 
-				for (auto &cm: mob->close_mobs) {
-					if (scanning_mob->GetID() == cm.first) {
-						has_mob = true;
-						break;
-					}
+			for (auto &cm: mob->close_mobs) {
+				if (scanning_mob->GetID() == cm.first) {
+					has_mob = true;
+					break;
 				}
+			}
 
-				if (!has_mob) {
-					mob->close_mobs.insert(std::pair<uint16, Mob *>(scanning_mob->GetID(), scanning_mob));
-				}
+			if (!has_mob) {
+				mob->close_mobs.insert(std::pair<uint16, Mob *>(scanning_mob->GetID(), scanning_mob));
 			}
 		}
 	}
@@ -5285,34 +5306,27 @@ Mob *EntityList::GetClosestMobByBodyType(Mob *sender, bodyType BodyType, bool sk
 
 void EntityList::GetTargetsForConeArea(Mob *start, float min_radius, float radius, float height, int pcnpc, std::list<Mob*> &m_list)
 {
-	auto it = mob_list.begin();
-	while (it !=  mob_list.end()) {
-		Mob *ptr = it->second;
-		if (ptr == start) {
-			++it;
-			continue;
-		}
-		// check PC/NPC only flag 1 = PCs, 2 = NPCs
-		if (pcnpc == 1 && !ptr->IsClient() && !ptr->IsMerc() && !ptr->IsBot()) {
-			++it;
-			continue;
-		} else if (pcnpc == 2 && (ptr->IsClient() || ptr->IsMerc() || ptr->IsBot())) {
-			++it;
-			continue;
-		}
-		float x_diff = ptr->GetX() - start->GetX();
-		float y_diff = ptr->GetY() - start->GetY();
-		float z_diff = ptr->GetZ() - start->GetZ();
-
-		x_diff *= x_diff;
-		y_diff *= y_diff;
-		z_diff *= z_diff;
-
-		if ((x_diff + y_diff) <= (radius * radius) && (x_diff + y_diff) >= (min_radius * min_radius))
-			if(z_diff <= (height * height))
-				m_list.push_back(ptr);
+	// check PC/NPC only flag 1 = PCs, 2 = NPCs
+	uint8 require_flags = pcnpc == 1 ? MobPositionTable::FlagPlayerSide : 0;
+	uint8 exclude_flags = pcnpc == 2 ? MobPositionTable::FlagPlayerSide : 0;
+
+	std::vector<Mob *> in_range;
+	mob_positions.QueryCylinder(
+		start->GetX(),
+		start->GetY(),
+		start->GetZ(),
+		min_radius * min_radius,
+		radius * radius,
+		height * height,
+		require_flags,
+		exclude_flags,
+		in_range
+	);
 
-		++it;
+	for (auto mob : in_range) {
+		if (mob != start) {
+			m_list.push_back(mob);
+		}
 	}
 }
 
@@ -5471,6 +5485,50 @@ std::unordered_map<uint16, Mob *> &EntityList::GetCloseMobList(Mob *mob, float d
 	return mob_list;
 }
 
+/**
+ * Holds back Mob::SendHPUpdate until the matching FlushHPUpdateBatch, so a mob hit several times
+ * inside the batch (an AE landing damage, a DoT and a lifetap on it) sends its HP once to each
+ * observer instead of once per hit. Batches nest, only the outermost flush sends
+ */
+void EntityList::StartHPUpdateBatch()
+{
+	hp_update_batch_depth++;
+}
+
+void EntityList::FlushHPUpdateBatch()
+{
+	if (hp_update_batch_depth == 0 || --hp_update_batch_depth > 0) {
+		return;
+	}
+
+	// mobs can die and be replaced while the batch is open, send by id
+	std::map<uint16, bool> updates;
+	updates.swap(deferred_hp_updates);
+
+	for (auto &e : updates) {
+		auto mob = GetMob(e.first);
+		if (mob) {
+			mob->SendHPUpdate(e.second);
+		}
+	}
+}
+
+/**
+ * @param mob
+ * @param force_update_all
+ * @return true when the update was queued for the open batch
+ */
+bool EntityList::DeferHPUpdate(Mob *mob, bool force_update_all)
+{
+	if (hp_update_batch_depth == 0 || mob->GetID() == 0) {
+		return false;
+	}
+
+	deferred_hp_updates[mob->GetID()] |= force_update_all;
+
+	return true;
+}
+
 void EntityList::GateAllClientsToSafeReturn()
 {
 	DynamicZone* dz = zone ? zone->GetDynamicZone() : nullptr;
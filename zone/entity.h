@@ -28,6 +28,7 @@
 #include "../common/eq_constants.h"
 
 #include "position.h"
+#include "mob_position_table.h"
 #include "zonedump.h"
 #include "common.h"
 
@@ -529,6 +530,13 @@ public:
 
 	std::unordered_map<uint16, Mob *> &GetCloseMobList(Mob *mob, float distance = 0);
 
+	inline const MobPositionTable &GetMobPositions() const { return mob_positions; }
+	inline void UpdateMobPosition(Mob *mob) { mob_positions.Update(mob); }
+
+	void StartHPUpdateBatch();
+	void FlushHPUpdateBatch();
+	bool DeferHPUpdate(Mob *mob, bool force_update_all);
+
 	void	DepopAll(int NPCTypeID, bool StartSpawnTimer = true);
 
 	uint16 GetFreeID();
@@ -566,6 +574,9 @@ private:
 
 	std::unordered_map<uint16, Client *> client_list;
 	std::unordered_map<uint16, Mob *> mob_list;
+	MobPositionTable mob_positions; // packed positions of mob_list for range queries
+	int hp_update_batch_depth;
+	std::map<uint16, bool> deferred_hp_updates; // entity id -> force_update_all
 	std::unordered_map<uint16, NPC *> npc_list;
 	std::unordered_map<uint16, Merc *> merc_list;
 	std::unordered_map<uint16, Corpse *> corpse_list;
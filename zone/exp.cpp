@@ -1152,21 +1152,11 @@ uint32 Client::GetCharMaxLevelFromQGlobal() {
 	QGlobalCache *char_c = nullptr;
 	char_c = this->GetQGlobals();
 
-	std::list<QGlobal> globalMap;
-	uint32 ntype = 0;
-
 	if(char_c) {
-		QGlobalCache::Combine(globalMap, char_c->GetBucket(), ntype, this->CharacterID(), zone->GetZoneID());
-	}
-
-	auto iter = globalMap.begin();
-	uint32 gcount = 0;
-	while(iter != globalMap.end()) {
-		if((*iter).name.compare("CharMaxLevel") == 0){
-			return atoi((*iter).value.c_str());
+		auto global = char_c->FindGlobal("CharMaxLevel", 0, this->CharacterID(), zone->GetZoneID());
+		if(global) {
+			return atoi(global->value.c_str());
 		}
-		++iter;
-		++gcount;
 	}
 
 	return 0;
@@ -20,21 +20,22 @@ void command_logs(Client *c, const Seperator *sep)
 		/* #logs list_settings */
 		if (strcasecmp(sep->arg[1], "list_settings") == 0 ||
 			(strcasecmp(sep->arg[1], "set") == 0 && strcasecmp(sep->arg[3], "") == 0)) {
-			c->Message(Chat::White, "[Category ID | console | file | gmsay | Category Description]");
+			c->Message(Chat::White, "[Category ID | console | file | gmsay | binary | Category Description]");
 			int      redisplay_columns = 0;
 			for (int i                 = 0; i < Logs::LogCategory::MaxCategoryID; i++) {
 				if (redisplay_columns == 10) {
-					c->Message(Chat::White, "[Category ID | console | file | gmsay | Category Description]");
+					c->Message(Chat::White, "[Category ID | console | file | gmsay | binary | Category Description]");
 					redisplay_columns = 0;
 				}
 				c->Message(
 					0,
 					StringFormat(
-						"--- %i | %u | %u | %u | %s",
+						"--- %i | %u | %u | %u | %u | %s",
 						i,
 						LogSys.log_settings[i].log_to_console,
 						LogSys.log_settings[i].log_to_file,
 						LogSys.log_settings[i].log_to_gmsay,
+						LogSys.log_settings[i].log_to_binary,
 						Logs::LogCategoryName[i]
 					).c_str());
 				redisplay_columns++;
@@ -54,10 +55,19 @@ void command_logs(Client *c, const Seperator *sep)
 				LogSys.log_settings[atoi(sep->arg[3])].log_to_gmsay = atoi(sep->arg[4]);
 				logs_set = 1;
 			}
+			else if (strcasecmp(sep->arg[2], "binary") == 0) {
+				LogSys.log_settings[atoi(sep->arg[3])].log_to_binary = atoi(sep->arg[4]);
+				logs_set = 1;
+
+				if (atoi(sep->arg[4]) > 0 && !LogSys.GetBinaryLog().IsOpen()) {
+					LogSys.binary_logs_enabled = true;
+					LogSys.StartFileLogs();
+				}
+			}
 			else {
 				c->Message(
 					Chat::White,
-					"--- #logs set [console|file|gmsay] <category_id> <debug_level (1-3)> - Sets log settings during the lifetime of the zone"
+					"--- #logs set [console|file|gmsay|binary] <category_id> <debug_level (1-3)> - Sets log settings during the lifetime of the zone"
 				);
 				c->Message(Chat::White, "--- #logs set gmsay 20 1 - Would output Quest errors to gmsay");
 			}
@@ -94,7 +104,7 @@ void command_logs(Client *c, const Seperator *sep)
 		);
 		c->Message(
 			Chat::White,
-			"--- #logs set [console|file|gmsay] <category_id> <debug_level (1-3)> - Sets log settings during the lifetime of the zone"
+			"--- #logs set [console|file|gmsay|binary] <category_id> <debug_level (1-3)> - Sets log settings during the lifetime of the zone"
 		);
 	}
 }
@@ -0,0 +1,60 @@
+#include "../client.h"
+#ifdef LUA_EQEMU
+#include "../lua_parser.h"
+#endif
+
+void command_luaprofile(Client *c, const Seperator *sep)
+{
+#ifdef LUA_EQEMU
+	auto &profiler = LuaParser::Instance()->GetProfiler();
+
+	if (sep->argnum == 0) {
+		c->Message(Chat::White, "Usage: #luaprofile [on|off] - Toggles the lua quest profiler");
+		c->Message(Chat::White, "Usage: #luaprofile show [count] - Shows the top [count] events and functions (default 10)");
+		c->Message(Chat::White, "Usage: #luaprofile reset - Clears collected profile data");
+		c->Message(Chat::White, "Usage: #luaprofile interval [instructions] - Sets the lua instructions between samples");
+		c->Message(Chat::White, "Usage: #luaprofile budget [instructions] - Aborts quest events that run longer, 0 disables");
+		c->Message(
+			Chat::White,
+			"Profiler is [%s], sample interval [%d], instruction budget [%d]",
+			profiler.IsEnabled() ? "on" : "off",
+			profiler.GetSampleInterval(),
+			profiler.GetInstructionBudget()
+		);
+		return;
+	}
+
+	if (strcasecmp(sep->arg[1], "on") == 0 || strcasecmp(sep->arg[1], "off") == 0) {
+		bool enabled = strcasecmp(sep->arg[1], "on") == 0;
+		profiler.SetEnabled(enabled);
+		c->Message(Chat::White, "Lua profiler is now [%s].", enabled ? "on" : "off");
+	}
+	else if (strcasecmp(sep->arg[1], "reset") == 0) {
+		profiler.Reset();
+		c->Message(Chat::White, "Lua profile data has been reset.");
+	}
+	else if (strcasecmp(sep->arg[1], "interval") == 0 && sep->IsNumber(2)) {
+		profiler.SetSampleInterval(atoi(sep->arg[2]));
+		c->Message(Chat::White, "Lua profiler sample interval set to [%d] instructions.", profiler.GetSampleInterval());
+	}
+	else if (strcasecmp(sep->arg[1], "budget") == 0 && sep->IsNumber(2)) {
+		profiler.SetInstructionBudget(atoi(sep->arg[2]));
+		c->Message(Chat::White, "Lua instruction budget set to [%d] (0 = Unlimited).", profiler.GetInstructionBudget());
+	}
+	else if (strcasecmp(sep->arg[1], "show") == 0) {
+		size_t count = sep->IsNumber(2) ? static_cast<size_t>(atoi(sep->arg[2])) : 10;
+
+		std::list<std::string> report;
+		LuaParser::Instance()->GetProfileReport(report, count);
+		for (auto &line : report) {
+			c->Message(Chat::White, "%s", line.c_str());
+		}
+	}
+	else {
+		c->Message(Chat::White, "Unknown option, use #luaprofile for usage.");
+	}
+#else
+	c->Message(Chat::White, "This zone was built without lua support.");
+#endif
+}
+
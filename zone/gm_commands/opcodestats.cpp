@@ -0,0 +1,87 @@
+#include "../client.h"
+#include "../../common/opcode_stats.h"
+#include "../../common/opcodemgr.h"
+
+#include <algorithm>
+
+extern OpcodeStats client_opcode_stats;
+extern OpcodeStats server_opcode_stats;
+
+void command_opcodestats(Client *c, const Seperator *sep)
+{
+	if (strcasecmp(sep->arg[1], "reset") == 0) {
+		client_opcode_stats.Reset();
+		server_opcode_stats.Reset();
+		c->Message(Chat::White, "Opcode statistics have been reset.");
+		return;
+	}
+
+	bool is_server = strcasecmp(sep->arg[1], "server") == 0;
+	if (sep->arg[1][0] != 0 && !is_server && strcasecmp(sep->arg[1], "client") != 0) {
+		c->Message(Chat::White, "Usage: #opcodestats [client|server] [calls|time|max|bytes] [count]");
+		c->Message(Chat::White, "Usage: #opcodestats reset");
+		return;
+	}
+
+	auto &stats = is_server ? server_opcode_stats : client_opcode_stats;
+	if (!stats.IsEnabled()) {
+		c->Message(Chat::White, "Opcode statistics are disabled (Zone:OpcodeStatistics).");
+		return;
+	}
+
+	std::string sort_by = sep->arg[2][0] != 0 ? sep->arg[2] : "time";
+	int         count   = sep->IsNumber(3) ? std::max(1, atoi(sep->arg[3])) : 10;
+
+	std::vector<OpcodeStats::Entry> entries;
+	stats.GetWindow(entries);
+
+	auto sort_key = [&sort_by](const OpcodeStats::Entry &e) -> uint64 {
+		if (strcasecmp(sort_by.c_str(), "calls") == 0) {
+			return e.counters.calls;
+		}
+		if (strcasecmp(sort_by.c_str(), "max") == 0) {
+			return e.counters.max_ns;
+		}
+		if (strcasecmp(sort_by.c_str(), "bytes") == 0) {
+			return e.counters.bytes_in + e.counters.bytes_out;
+		}
+		return e.counters.total_ns;
+	};
+
+	std::sort(
+		entries.begin(), entries.end(), [&sort_key](const OpcodeStats::Entry &a, const OpcodeStats::Entry &b) {
+			return sort_key(a) > sort_key(b);
+		}
+	);
+
+	c->Message(
+		Chat::White,
+		fmt::format(
+			"{} opcodes over the last {} seconds, by {}",
+			is_server ? "Server" : "Client",
+			stats.GetWindowSeconds(),
+			sort_by
+		).c_str()
+	);
+
+	for (size_t i = 0; i < entries.size() && i < (size_t) count; ++i) {
+		auto &e    = entries[i];
+		auto name  = is_server ? fmt::format("0x{:04x}", e.opcode) : std::string(OpcodeManager::EmuToName((EmuOpcode) e.opcode));
+		auto avg   = e.counters.calls > 0 ? e.counters.total_ns / e.counters.calls : 0;
+
+		c->Message(
+			Chat::White,
+			fmt::format(
+				"{} | Calls: {} Total: {:.2f} ms Avg: {:.1f} us Max: {:.1f} us | In: {} bytes Out: {} bytes ({} sent)",
+				name,
+				e.counters.calls,
+				e.counters.total_ns / 1000000.0,
+				avg / 1000.0,
+				e.counters.max_ns / 1000.0,
+				e.counters.bytes_in,
+				e.counters.bytes_out,
+				e.counters.sent
+			).c_str()
+		);
+	}
+}
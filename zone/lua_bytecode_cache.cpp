@@ -0,0 +1,260 @@
+#ifdef LUA_EQEMU
+
+#include "lua.hpp"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef _WINDOWS
+#include <windows.h>
+#include <process.h>
+#define getpid _getpid
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "../common/string_util.h"
+#include "../common/file_util.h"
+#include "lua_bytecode_cache.h"
+
+namespace {
+#ifdef LUAJIT_VERSION
+	const char lua_runtime_tag[] = LUAJIT_VERSION;
+#else
+	const char lua_runtime_tag[] = LUA_RELEASE;
+#endif
+
+	const uint64 fnv_offset = 14695981039346656037ULL;
+	const uint64 fnv_prime  = 1099511628211ULL;
+
+	uint64 fnv1a(const char *data, size_t size, uint64 hash)
+	{
+		for (size_t i = 0; i < size; ++i) {
+			hash ^= static_cast<uint8>(data[i]);
+			hash *= fnv_prime;
+		}
+
+		return hash;
+	}
+
+	int write_chunk(lua_State *L, const void *p, size_t sz, void *ud)
+	{
+		reinterpret_cast<std::string *>(ud)->append(reinterpret_cast<const char *>(p), sz);
+		return 0;
+	}
+
+	bool is_bytecode(const std::string &source)
+	{
+		return !source.empty() && source[0] == LUA_SIGNATURE[0];
+	}
+}
+
+LuaBytecodeCache::LuaBytecodeCache()
+{
+	enabled_ = false;
+	hits_    = 0;
+	misses_  = 0;
+}
+
+void LuaBytecodeCache::SetDirectory(const std::string &directory)
+{
+	directory_ = directory;
+	if (!directory_.empty() && directory_.back() != '/' && directory_.back() != '\\') {
+		directory_ += "/";
+	}
+
+	stamps_.clear();
+}
+
+int LuaBytecodeCache::LoadFile(lua_State *L, const std::string &filename)
+{
+	if (!enabled_ || directory_.empty()) {
+		return luaL_loadfile(L, filename.c_str());
+	}
+
+	//same chunk name luaL_loadfile would use so error messages and debug info don't change
+	std::string chunk_name = "@" + filename;
+
+	int64 mtime = 0;
+	int64 size  = 0;
+	if (!StatSource(filename, mtime, size)) {
+		return luaL_loadfile(L, filename.c_str());
+	}
+
+	auto stamp = stamps_.find(filename);
+	if (stamp != stamps_.end() && stamp->second.mtime == mtime && stamp->second.size == size) {
+		if (LoadCached(L, CachePath(stamp->second.key), chunk_name) == 0) {
+			hits_++;
+			return 0;
+		}
+	}
+
+	std::string source;
+	if (!ReadSource(filename, source) || is_bytecode(source)) {
+		return luaL_loadfile(L, filename.c_str());
+	}
+
+	uint64 key = ComputeKey(chunk_name, source);
+
+	//mtime only has second resolution, a file touched this second could still change under the same stamp
+	if (mtime < static_cast<int64>(time(nullptr)) - 1) {
+		stamps_[filename] = SourceStamp{mtime, size, key};
+	}
+	else {
+		stamps_.erase(filename);
+	}
+
+	std::string path = CachePath(key);
+	if (LoadCached(L, path, chunk_name) == 0) {
+		hits_++;
+		return 0;
+	}
+
+	misses_++;
+
+	//luaL_loadfile skips a leading #! line, comment it out instead so line numbers hold
+	if (source[0] == '#') {
+		source.insert(0, "--");
+	}
+
+	int status = luaL_loadbuffer(L, source.data(), source.size(), chunk_name.c_str());
+	if (status == 0) {
+		Store(L, path);
+	}
+
+	return status;
+}
+
+bool LuaBytecodeCache::StatSource(const std::string &filename, int64 &mtime, int64 &size) const
+{
+#ifdef _WINDOWS
+	struct _stat64 st;
+	if (_stat64(filename.c_str(), &st) != 0) {
+		return false;
+	}
+#else
+	struct stat st;
+	if (stat(filename.c_str(), &st) != 0) {
+		return false;
+	}
+#endif
+
+	mtime = static_cast<int64>(st.st_mtime);
+	size  = static_cast<int64>(st.st_size);
+	return true;
+}
+
+bool LuaBytecodeCache::ReadSource(const std::string &filename, std::string &source) const
+{
+	FILE *f = fopen(filename.c_str(), "rb");
+	if (!f) {
+		return false;
+	}
+
+	char buffer[16384];
+	size_t read = 0;
+	while ((read = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+		source.append(buffer, read);
+	}
+
+	bool ok = ferror(f) == 0;
+	fclose(f);
+	return ok && !source.empty();
+}
+
+uint64 LuaBytecodeCache::ComputeKey(const std::string &chunk_name, const std::string &source) const
+{
+	uint64 hash = fnv_offset;
+	hash = fnv1a(lua_runtime_tag, sizeof(lua_runtime_tag), hash);
+
+	//dumped chunks bake in size_t/pointer widths
+	uint8 pointer_size = sizeof(void *);
+	hash = fnv1a(reinterpret_cast<const char *>(&pointer_size), 1, hash);
+
+	hash = fnv1a(chunk_name.c_str(), chunk_name.size() + 1, hash);
+	return fnv1a(source.data(), source.size(), hash);
+}
+
+std::string LuaBytecodeCache::CachePath(uint64 key) const
+{
+	return StringFormat("%s%016llx.luac", directory_.c_str(), (unsigned long long) key);
+}
+
+int LuaBytecodeCache::LoadCached(lua_State *L, const std::string &path, const std::string &chunk_name) const
+{
+	int status = LUA_ERRFILE;
+
+#ifdef _WINDOWS
+	HANDLE file = CreateFile(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, 0, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		return status;
+	}
+
+	LARGE_INTEGER file_size;
+	if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0) {
+		HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping) {
+			const char *data = reinterpret_cast<const char *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+			if (data) {
+				status = luaL_loadbuffer(L, data, static_cast<size_t>(file_size.QuadPart), chunk_name.c_str());
+				UnmapViewOfFile(data);
+			}
+			CloseHandle(mapping);
+		}
+	}
+	CloseHandle(file);
+#else
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd == -1) {
+		return status;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) == 0 && st.st_size > 0) {
+		void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+		if (data != MAP_FAILED) {
+			status = luaL_loadbuffer(L, reinterpret_cast<const char *>(data), st.st_size, chunk_name.c_str());
+			munmap(data, st.st_size);
+		}
+	}
+	close(fd);
+#endif
+
+	//a truncated or foreign file is treated as a miss, the caller recompiles over it
+	if (status != 0 && status != LUA_ERRFILE) {
+		lua_pop(L, 1);
+	}
+
+	return status;
+}
+
+void LuaBytecodeCache::Store(lua_State *L, const std::string &path) const
+{
+	std::string bytecode;
+	if (lua_dump(L, write_chunk, &bytecode) != 0 || bytecode.empty()) {
+		return;
+	}
+
+	FileUtil::mkdir(directory_);
+
+	//written beside the final name and renamed so other zones never map a partial file
+	std::string temp_path = StringFormat("%s.%d.tmp", path.c_str(), (int) getpid());
+	FILE *f = fopen(temp_path.c_str(), "wb");
+	if (!f) {
+		return;
+	}
+
+	bool ok = fwrite(bytecode.data(), 1, bytecode.size(), f) == bytecode.size();
+	ok = fclose(f) == 0 && ok;
+
+	if (!ok || rename(temp_path.c_str(), path.c_str()) != 0) {
+		remove(temp_path.c_str());
+	}
+}
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef EQEMU_LUA_BYTECODE_CACHE_H
+#define EQEMU_LUA_BYTECODE_CACHE_H
+#ifdef LUA_EQEMU
+
+#include <string>
+#include <unordered_map>
+
+#include "../common/types.h"
+
+struct lua_State;
+
+/*
+ * On disk cache of compiled quest chunks shared by every zone process.
+ *
+ * A chunk is stored under <cache dir>/<key>.luac where the key hashes the source text,
+ * the chunk name and the lua runtime version, so an edited file, a moved file or a
+ * different interpreter all miss instead of loading stale bytecode. Cache files are
+ * written to a temp name and renamed into place, which lets 200 zones race on the same
+ * file safely; readers map the file read only and hand it to luaL_loadbuffer.
+ *
+ * Within a process the last seen mtime/size/key of each source is remembered so a hot
+ * reload only re-reads and re-hashes files that changed on disk.
+ */
+class LuaBytecodeCache
+{
+public:
+	LuaBytecodeCache();
+
+	void SetDirectory(const std::string &directory);
+	void SetEnabled(bool enabled) { enabled_ = enabled; }
+	bool IsEnabled() const { return enabled_; }
+
+	//drop-in for luaL_loadfile: leaves the chunk or an error message on the stack and returns the lua status
+	int LoadFile(lua_State *L, const std::string &filename);
+
+	uint32 GetHits() const { return hits_; }
+	uint32 GetMisses() const { return misses_; }
+	void ResetCounters() { hits_ = 0; misses_ = 0; }
+
+private:
+	struct SourceStamp
+	{
+		int64 mtime;
+		int64 size;
+		uint64 key;
+	};
+
+	bool ReadSource(const std::string &filename, std::string &source) const;
+	bool StatSource(const std::string &filename, int64 &mtime, int64 &size) const;
+	uint64 ComputeKey(const std::string &chunk_name, const std::string &source) const;
+	std::string CachePath(uint64 key) const;
+	int LoadCached(lua_State *L, const std::string &path, const std::string &chunk_name) const;
+	void Store(lua_State *L, const std::string &path) const;
+
+	bool enabled_;
+	std::string directory_;
+	std::unordered_map<std::string, SourceStamp> stamps_;
+	uint32 hits_;
+	uint32 misses_;
+};
+
+#endif
+#endif
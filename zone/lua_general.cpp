@@ -1052,13 +1052,8 @@ luabind::adl::object lua_get_qglobals(lua_State *L, Lua_NPC npc, Lua_Client clie
 	NPC *n = npc;
 	Client *c = client;
 
-	std::list<QGlobal> global_map;
-	QGlobalCache::GetQGlobals(global_map, n, c, zone);
-	auto iter = global_map.begin();
-	while(iter != global_map.end()) {
-		ret[(*iter).name] = (*iter).value;
-		++iter;
-	}
+	QGlobalView view(n, c, zone);
+	view.ForEach([&ret](const QGlobal &global) { ret[global.name] = global.value; });
 	return ret;
 }
 
@@ -1068,13 +1063,8 @@ luabind::adl::object lua_get_qglobals(lua_State *L, Lua_Client client) {
 	NPC *n = nullptr;
 	Client *c = client;
 
-	std::list<QGlobal> global_map;
-	QGlobalCache::GetQGlobals(global_map, n, c, zone);
-	auto iter = global_map.begin();
-	while (iter != global_map.end()) {
-		ret[(*iter).name] = (*iter).value;
-		++iter;
-	}
+	QGlobalView view(n, c, zone);
+	view.ForEach([&ret](const QGlobal &global) { ret[global.name] = global.value; });
 	return ret;
 }
 
@@ -1084,13 +1074,8 @@ luabind::adl::object lua_get_qglobals(lua_State *L, Lua_NPC npc) {
 	NPC *n = npc;
 	Client *c = nullptr;
 
-	std::list<QGlobal> global_map;
-	QGlobalCache::GetQGlobals(global_map, n, c, zone);
-	auto iter = global_map.begin();
-	while (iter != global_map.end()) {
-		ret[(*iter).name] = (*iter).value;
-		++iter;
-	}
+	QGlobalView view(n, c, zone);
+	view.ForEach([&ret](const QGlobal &global) { ret[global.name] = global.value; });
 	return ret;
 }
 
@@ -1100,13 +1085,8 @@ luabind::adl::object lua_get_qglobals(lua_State *L) {
 	NPC *n = nullptr;
 	Client *c = nullptr;
 
-	std::list<QGlobal> global_map;
-	QGlobalCache::GetQGlobals(global_map, n, c, zone);
-	auto iter = global_map.begin();
-	while (iter != global_map.end()) {
-		ret[(*iter).name] = (*iter).value;
-		++iter;
-	}
+	QGlobalView view(n, c, zone);
+	view.ForEach([&ret](const QGlobal &global) { ret[global.name] = global.value; });
 	return ret;
 }
 
@@ -17,6 +17,8 @@
 #include "zone_config.h"
 
 #include "lua_parser.h"
+#include "lua_profiler.h"
+#include "lua_bytecode_cache.h"
 #include "lua_bit.h"
 #include "lua_entity.h"
 #include "lua_expedition.h"
@@ -44,6 +46,9 @@
 #include "lua_bot.h"
 #endif
 
+//hash slots reserved up front in each event table, covers self plus the common argument sets
+#define LUA_EVENT_TABLE_SLOTS 8
+
 const char *LuaEvents[_LargestEventID] = {
 	"event_say",
 	"event_trade",
@@ -250,6 +255,10 @@ LuaParser::LuaParser() {
 	EncounterArgumentDispatch[EVENT_ENCOUNTER_LOAD] = handle_encounter_load;
 	EncounterArgumentDispatch[EVENT_ENCOUNTER_UNLOAD] = handle_encounter_unload;
 
+	for (int i = 0; i < _LargestEventID; ++i) {
+		event_name_refs_[i] = LUA_NOREF;
+	}
+
 	L = nullptr;
 }
 
@@ -278,8 +287,7 @@ int LuaParser::EventNPC(QuestEventID evt, NPC* npc, Mob *init, std::string data,
 		return 0;
 	}
 
-	std::string package_name = "npc_" + std::to_string(npc->GetNPCTypeID());
-	return _EventNPC(package_name, evt, npc, init, data, extra_data, extra_pointers);
+	return _EventNPC(InternPackageName(npc_package_names_, "npc_", npc->GetNPCTypeID()), evt, npc, init, data, extra_data, extra_pointers);
 }
 
 int LuaParser::EventGlobalNPC(QuestEventID evt, NPC* npc, Mob *init, std::string data, uint32 extra_data,
@@ -300,10 +308,8 @@ int LuaParser::EventGlobalNPC(QuestEventID evt, NPC* npc, Mob *init, std::string
 	return _EventNPC("global_npc", evt, npc, init, data, extra_data, extra_pointers);
 }
 
-int LuaParser::_EventNPC(std::string package_name, QuestEventID evt, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+int LuaParser::_EventNPC(const std::string &package_name, QuestEventID evt, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						 std::vector<EQ::Any> *extra_pointers, luabind::adl::object *l_func) {
-	const char *sub_name = LuaEvents[evt];
-
 	int start = lua_gettop(L);
 
 	try {
@@ -311,16 +317,14 @@ int LuaParser::_EventNPC(std::string package_name, QuestEventID evt, NPC* npc, M
 		if(l_func != nullptr) {
 			l_func->push(L);
 		} else {
-			lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
-			lua_getfield(L, -1, sub_name);
+			PushEventFunction(package_name, evt);
 			npop = 2;
 		}
 
-		lua_createtable(L, 0, 0);
+		lua_createtable(L, 0, LUA_EVENT_TABLE_SLOTS);
 		//always push self
 		Lua_NPC l_npc(npc);
-		luabind::adl::object l_npc_o = luabind::adl::object(L, l_npc);
-		l_npc_o.push(L);
+		luabind::detail::push(L, l_npc);
 		lua_setfield(L, -2, "self");
 
 		auto arg_function = NPCArgumentDispatch[evt];
@@ -328,7 +332,13 @@ int LuaParser::_EventNPC(std::string package_name, QuestEventID evt, NPC* npc, M
 		Client *c = (init && init->IsClient()) ? init->CastToClient() : nullptr;
 
 		quest_manager.StartQuest(npc, c);
-		if(lua_pcall(L, 1, 1, 0)) {
+		bool profiled = profiler_.BeginEvent(package_name, evt, LuaEvents[evt]);
+		int failed = lua_pcall(L, 1, 1, 0);
+		if(profiled) {
+			profiler_.EndEvent();
+		}
+
+		if(failed) {
 			std::string error = lua_tostring(L, -1);
 			AddError(error);
 			quest_manager.EndQuest();
@@ -395,9 +405,8 @@ int LuaParser::EventGlobalPlayer(QuestEventID evt, Client *client, std::string d
 	return _EventPlayer("global_player", evt, client, data, extra_data, extra_pointers);
 }
 
-int LuaParser::_EventPlayer(std::string package_name, QuestEventID evt, Client *client, std::string data, uint32 extra_data,
+int LuaParser::_EventPlayer(const std::string &package_name, QuestEventID evt, Client *client, const std::string &data, uint32 extra_data,
 							std::vector<EQ::Any> *extra_pointers, luabind::adl::object *l_func) {
-	const char *sub_name = LuaEvents[evt];
 	int start = lua_gettop(L);
 
 	try {
@@ -405,23 +414,27 @@ int LuaParser::_EventPlayer(std::string package_name, QuestEventID evt, Client *
 		if(l_func != nullptr) {
 			l_func->push(L);
 		} else {
-			lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
-			lua_getfield(L, -1, sub_name);
+			PushEventFunction(package_name, evt);
 			npop = 2;
 		}
 
-		lua_createtable(L, 0, 0);
+		lua_createtable(L, 0, LUA_EVENT_TABLE_SLOTS);
 		//push self
 		Lua_Client l_client(client);
-		luabind::adl::object l_client_o = luabind::adl::object(L, l_client);
-		l_client_o.push(L);
+		luabind::detail::push(L, l_client);
 		lua_setfield(L, -2, "self");
 
 		auto arg_function = PlayerArgumentDispatch[evt];
 		arg_function(this, L, client, data, extra_data, extra_pointers);
 
 		quest_manager.StartQuest(client, client);
-		if(lua_pcall(L, 1, 1, 0)) {
+		bool profiled = profiler_.BeginEvent(package_name, evt, LuaEvents[evt]);
+		int failed = lua_pcall(L, 1, 1, 0);
+		if(profiled) {
+			profiler_.EndEvent();
+		}
+
+		if(failed) {
 			std::string error = lua_tostring(L, -1);
 			AddError(error);
 			quest_manager.EndQuest();
@@ -467,15 +480,11 @@ int LuaParser::EventItem(QuestEventID evt, Client *client, EQ::ItemInstance *ite
 		return 0;
 	}
 
-	std::string package_name = "item_";
-	package_name += std::to_string(item->GetID());
-	return _EventItem(package_name, evt, client, item, mob, data, extra_data, extra_pointers);
+	return _EventItem(InternPackageName(item_package_names_, "item_", item->GetID()), evt, client, item, mob, data, extra_data, extra_pointers);
 }
 
-int LuaParser::_EventItem(std::string package_name, QuestEventID evt, Client *client, EQ::ItemInstance *item, Mob *mob,
-						  std::string data, uint32 extra_data, std::vector<EQ::Any> *extra_pointers, luabind::adl::object *l_func) {
-	const char *sub_name = LuaEvents[evt];
-
+int LuaParser::_EventItem(const std::string &package_name, QuestEventID evt, Client *client, EQ::ItemInstance *item, Mob *mob,
+						  const std::string &data, uint32 extra_data, std::vector<EQ::Any> *extra_pointers, luabind::adl::object *l_func) {
 	int start = lua_gettop(L);
 
 	try {
@@ -483,20 +492,17 @@ int LuaParser::_EventItem(std::string package_name, QuestEventID evt, Client *cl
 		if(l_func != nullptr) {
 			l_func->push(L);
 		} else {
-			lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
-			lua_getfield(L, -1, sub_name);
+			PushEventFunction(package_name, evt);
 		}
 
-		lua_createtable(L, 0, 0);
+		lua_createtable(L, 0, LUA_EVENT_TABLE_SLOTS);
 		//always push self
 		Lua_ItemInst l_item(item);
-		luabind::adl::object l_item_o = luabind::adl::object(L, l_item);
-		l_item_o.push(L);
+		luabind::detail::push(L, l_item);
 		lua_setfield(L, -2, "self");
 
 		Lua_Client l_client(client);
-		luabind::adl::object l_client_o = luabind::adl::object(L, l_client);
-		l_client_o.push(L);
+		luabind::detail::push(L, l_client);
 		lua_setfield(L, -2, "owner");
 
 		//redo this arg function
@@ -504,7 +510,13 @@ int LuaParser::_EventItem(std::string package_name, QuestEventID evt, Client *cl
 		arg_function(this, L, client, item, mob, data, extra_data, extra_pointers);
 
 		quest_manager.StartQuest(client, client, item);
-		if(lua_pcall(L, 1, 1, 0)) {
+		bool profiled = profiler_.BeginEvent(package_name, evt, LuaEvents[evt]);
+		int failed = lua_pcall(L, 1, 1, 0);
+		if(profiled) {
+			profiler_.EndEvent();
+		}
+
+		if(failed) {
 			std::string error = lua_tostring(L, -1);
 			AddError(error);
 			quest_manager.EndQuest();
@@ -542,19 +554,15 @@ int LuaParser::EventSpell(QuestEventID evt, NPC* npc, Client *client, uint32 spe
 		return 0;
 	}
 
-	std::string package_name = "spell_" + std::to_string(spell_id);
-
 	if(!SpellHasQuestSub(spell_id, evt)) {
 		return 0;
 	}
 
-	return _EventSpell(package_name, evt, npc, client, spell_id, data, extra_data, extra_pointers);
+	return _EventSpell(InternPackageName(spell_package_names_, "spell_", spell_id), evt, npc, client, spell_id, data, extra_data, extra_pointers);
 }
 
-int LuaParser::_EventSpell(std::string package_name, QuestEventID evt, NPC* npc, Client *client, uint32 spell_id, std::string data, uint32 extra_data,
+int LuaParser::_EventSpell(const std::string &package_name, QuestEventID evt, NPC* npc, Client *client, uint32 spell_id, const std::string &data, uint32 extra_data,
 						   std::vector<EQ::Any> *extra_pointers, luabind::adl::object *l_func) {
-	const char *sub_name = LuaEvents[evt];
-
 	int start = lua_gettop(L);
 
 	try {
@@ -562,30 +570,28 @@ int LuaParser::_EventSpell(std::string package_name, QuestEventID evt, NPC* npc,
 		if(l_func != nullptr) {
 			l_func->push(L);
 		} else {
-			lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
-			lua_getfield(L, -1, sub_name);
+			PushEventFunction(package_name, evt);
 			npop = 2;
 		}
 
-		lua_createtable(L, 0, 0);
+		lua_createtable(L, 0, LUA_EVENT_TABLE_SLOTS);
 
 		//always push self even if invalid
-		if(IsValidSpell(spell_id)) {
-			Lua_Spell l_spell(&spells[spell_id]);
-			luabind::adl::object l_spell_o = luabind::adl::object(L, l_spell);
-			l_spell_o.push(L);
-		} else {
-			Lua_Spell l_spell(nullptr);
-			luabind::adl::object l_spell_o = luabind::adl::object(L, l_spell);
-			l_spell_o.push(L);
-		}
+		Lua_Spell l_spell(IsValidSpell(spell_id) ? &spells[spell_id] : nullptr);
+		luabind::detail::push(L, l_spell);
 		lua_setfield(L, -2, "self");
 
 		auto arg_function = SpellArgumentDispatch[evt];
 		arg_function(this, L, npc, client, spell_id, data, extra_data, extra_pointers);
 
 		quest_manager.StartQuest(npc, client, nullptr, const_cast<SPDat_Spell_Struct*>(&spells[spell_id]));
-		if(lua_pcall(L, 1, 1, 0)) {
+		bool profiled = profiler_.BeginEvent(package_name, evt, LuaEvents[evt]);
+		int failed = lua_pcall(L, 1, 1, 0);
+		if(profiled) {
+			profiler_.EndEvent();
+		}
+
+		if(failed) {
 			std::string error = lua_tostring(L, -1);
 			AddError(error);
 			quest_manager.EndQuest();
@@ -631,17 +637,14 @@ int LuaParser::EventEncounter(QuestEventID evt, std::string encounter_name, std:
 	return _EventEncounter(package_name, evt, encounter_name, data, extra_data, extra_pointers);
 }
 
-int LuaParser::_EventEncounter(std::string package_name, QuestEventID evt, std::string encounter_name, std::string data, uint32 extra_data,
+int LuaParser::_EventEncounter(const std::string &package_name, QuestEventID evt, const std::string &encounter_name, const std::string &data, uint32 extra_data,
 							   std::vector<EQ::Any> *extra_pointers) {
-	const char *sub_name = LuaEvents[evt];
-
 	int start = lua_gettop(L);
 
 	try {
-		lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
-		lua_getfield(L, -1, sub_name);
+		PushEventFunction(package_name, evt);
 
-		lua_createtable(L, 0, 0);
+		lua_createtable(L, 0, LUA_EVENT_TABLE_SLOTS);
 		lua_pushstring(L, encounter_name.c_str());
 		lua_setfield(L, -2, "name");
 
@@ -651,7 +654,13 @@ int LuaParser::_EventEncounter(std::string package_name, QuestEventID evt, std::
 		arg_function(this, L, enc, data, extra_data, extra_pointers);
 
 		quest_manager.StartQuest(enc, nullptr, nullptr, nullptr, encounter_name);
-		if(lua_pcall(L, 1, 1, 0)) {
+		bool profiled = profiler_.BeginEvent(package_name, evt, LuaEvents[evt]);
+		int failed = lua_pcall(L, 1, 1, 0);
+		if(profiled) {
+			profiler_.EndEvent();
+		}
+
+		if(failed) {
 			std::string error = lua_tostring(L, -1);
 			AddError(error);
 			quest_manager.EndQuest();
@@ -688,10 +697,7 @@ bool LuaParser::HasQuestSub(uint32 npc_id, QuestEventID evt) {
 		return false;
 	}
 
-	std::string package_name = "npc_" + std::to_string(npc_id);
-
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, package_name);
+	return HasEventFunction(InternPackageName(npc_package_names_, "npc_", npc_id), evt);
 }
 
 bool LuaParser::HasGlobalQuestSub(QuestEventID evt) {
@@ -700,8 +706,8 @@ bool LuaParser::HasGlobalQuestSub(QuestEventID evt) {
 		return false;
 	}
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, "global_npc");
+	static const std::string package_name = "global_npc";
+	return HasEventFunction(package_name, evt);
 }
 
 bool LuaParser::PlayerHasQuestSub(QuestEventID evt) {
@@ -710,8 +716,8 @@ bool LuaParser::PlayerHasQuestSub(QuestEventID evt) {
 		return false;
 	}
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, "player");
+	static const std::string package_name = "player";
+	return HasEventFunction(package_name, evt);
 }
 
 bool LuaParser::GlobalPlayerHasQuestSub(QuestEventID evt) {
@@ -720,8 +726,8 @@ bool LuaParser::GlobalPlayerHasQuestSub(QuestEventID evt) {
 		return false;
 	}
 
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, "global_player");
+	static const std::string package_name = "global_player";
+	return HasEventFunction(package_name, evt);
 }
 
 bool LuaParser::SpellHasQuestSub(uint32 spell_id, QuestEventID evt) {
@@ -730,10 +736,7 @@ bool LuaParser::SpellHasQuestSub(uint32 spell_id, QuestEventID evt) {
 		return false;
 	}
 
-	std::string package_name = "spell_" + std::to_string(spell_id);
-
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, package_name);
+	return HasEventFunction(InternPackageName(spell_package_names_, "spell_", spell_id), evt);
 }
 
 bool LuaParser::ItemHasQuestSub(EQ::ItemInstance *itm, QuestEventID evt) {
@@ -745,11 +748,7 @@ bool LuaParser::ItemHasQuestSub(EQ::ItemInstance *itm, QuestEventID evt) {
 		return false;
 	}
 
-	std::string package_name = "item_";
-	package_name += std::to_string(itm->GetID());
-
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, package_name);
+	return HasEventFunction(InternPackageName(item_package_names_, "item_", itm->GetID()), evt);
 }
 
 bool LuaParser::EncounterHasQuestSub(std::string encounter_name, QuestEventID evt) {
@@ -758,10 +757,7 @@ bool LuaParser::EncounterHasQuestSub(std::string encounter_name, QuestEventID ev
 		return false;
 	}
 
-	std::string package_name = "encounter_" + encounter_name;
-
-	const char *subname = LuaEvents[evt];
-	return HasFunction(subname, package_name);
+	return HasEventFunction("encounter_" + encounter_name, evt);
 }
 
 void LuaParser::LoadNPCScript(std::string filename, int npc_id) {
@@ -817,10 +813,29 @@ std::string LuaParser::GetVar(std::string name) {
 }
 
 void LuaParser::Init() {
+	bytecode_cache_.SetDirectory(Config->SharedMemDir + "lua_bytecode");
+	profiler_.SetSampleInterval(RuleI(Lua, ProfilerSampleInterval));
+	profiler_.SetInstructionBudget(RuleI(Lua, InstructionBudget));
+	profiler_.SetEnabled(RuleB(Lua, ProfilerEnabled));
 	ReloadQuests();
 }
 
+void LuaParser::GetProfileReport(std::list<std::string> &report, size_t count) {
+	profiler_.GetReport(report, count);
+
+	if (bytecode_cache_.IsEnabled()) {
+		report.push_back(
+			StringFormat(
+				"Bytecode cache hits [%u] misses [%u]",
+				bytecode_cache_.GetHits(),
+				bytecode_cache_.GetMisses()
+			)
+		);
+	}
+}
+
 void LuaParser::ReloadQuests() {
+	bytecode_cache_.SetEnabled(RuleB(Lua, UseBytecodeCache));
 	loaded_.clear();
 	errors_.clear();
 	mods_.clear();
@@ -842,6 +857,8 @@ void LuaParser::ReloadQuests() {
 
 	L = luaL_newstate();
 	luaL_openlibs(L);
+	RegisterEventNames();
+	profiler_.Attach(L);
 
 	auto top = lua_gettop(L);
 
@@ -1022,7 +1039,7 @@ void LuaParser::LoadScript(std::string filename, std::string package_name) {
 	}
 
 	auto top = lua_gettop(L);
-	if(luaL_loadfile(L, filename.c_str())) {
+	if(bytecode_cache_.LoadFile(L, filename)) {
 		std::string error = lua_tostring(L, -1);
 		AddError(error);
 		lua_pop(L, 1);
@@ -1043,15 +1060,19 @@ void LuaParser::LoadScript(std::string filename, std::string package_name) {
 	lua_pushvalue(L, -1); //put the table we made into the registry
 	lua_setfield(L, LUA_REGISTRYINDEX, package_name.c_str());
 
+	lua_pushvalue(L, -1); //and keep a ref to it so events don't look it up by name
+	int package_ref = luaL_ref(L, LUA_REGISTRYINDEX);
+
 	lua_setfenv(L, -2); //set the env to the table we made
 
 	if(lua_pcall(L, 0, 0, 0)) {
 		std::string error = lua_tostring(L, -1);
 		AddError(error);
 		lua_pop(L, 1);
+		luaL_unref(L, LUA_REGISTRYINDEX, package_ref);
 	}
 	else {
-		loaded_[package_name] = true;
+		loaded_[package_name] = package_ref;
 	}
 
 	auto end = lua_gettop(L);
@@ -1069,7 +1090,7 @@ bool LuaParser::HasFunction(std::string subname, std::string package_name) {
 		return false;
 	}
 
-	lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
+	lua_rawgeti(L, LUA_REGISTRYINDEX, iter->second);
 	lua_getfield(L, -1, subname.c_str());
 
 	if(lua_isfunction(L, -1)) {
@@ -1081,6 +1102,60 @@ bool LuaParser::HasFunction(std::string subname, std::string package_name) {
 	return false;
 }
 
+/*
+ * Event dispatch fast path: event names are pushed once per lua state and held in the
+ * registry, package env tables are held by ref from LoadScript and numeric package names
+ * are interned, so a fired event does no string building or key interning of its own.
+ */
+void LuaParser::RegisterEventNames() {
+	for (int i = 0; i < _LargestEventID; ++i) {
+		if (LuaEvents[i] == nullptr) {
+			event_name_refs_[i] = LUA_NOREF;
+			continue;
+		}
+
+		lua_pushstring(L, LuaEvents[i]);
+		event_name_refs_[i] = luaL_ref(L, LUA_REGISTRYINDEX);
+	}
+}
+
+//pushes the package env table then its handler for evt (or nil), same as the two lua_getfield calls it replaces
+void LuaParser::PushEventFunction(const std::string &package_name, QuestEventID evt) {
+	auto iter = loaded_.find(package_name);
+	if (iter != loaded_.end()) {
+		lua_rawgeti(L, LUA_REGISTRYINDEX, iter->second);
+	} else {
+		lua_getfield(L, LUA_REGISTRYINDEX, package_name.c_str());
+	}
+
+	lua_rawgeti(L, LUA_REGISTRYINDEX, event_name_refs_[evt]);
+	lua_gettable(L, -2);
+}
+
+bool LuaParser::HasEventFunction(const std::string &package_name, QuestEventID evt) {
+	auto iter = loaded_.find(package_name);
+	if (iter == loaded_.end()) {
+		return false;
+	}
+
+	lua_rawgeti(L, LUA_REGISTRYINDEX, iter->second);
+	lua_rawgeti(L, LUA_REGISTRYINDEX, event_name_refs_[evt]);
+	lua_gettable(L, -2);
+
+	bool has_function = lua_isfunction(L, -1);
+	lua_pop(L, 2);
+	return has_function;
+}
+
+const std::string &LuaParser::InternPackageName(std::unordered_map<uint32, std::string> &names, const char *prefix, uint32 id) {
+	auto iter = names.find(id);
+	if (iter != names.end()) {
+		return iter->second;
+	}
+
+	return names.emplace(id, prefix + std::to_string(id)).first->second;
+}
+
 void LuaParser::MapFunctions(lua_State *L) {
 
 	try {
@@ -1165,10 +1240,9 @@ int LuaParser::DispatchEventNPC(QuestEventID evt, NPC* npc, Mob *init, std::stri
 	if(!npc)
 		return 0;
 
-	std::string package_name = "npc_" + std::to_string(npc->GetNPCTypeID());
 	int ret = 0;
 
-	auto iter = lua_encounter_events_registered.find(package_name);
+	auto iter = lua_encounter_events_registered.find(InternPackageName(npc_package_names_, "npc_", npc->GetNPCTypeID()));
 	if(iter != lua_encounter_events_registered.end()) {
 		auto riter = iter->second.begin();
 		while(riter != iter->second.end()) {
@@ -1240,11 +1314,9 @@ int LuaParser::DispatchEventItem(QuestEventID evt, Client *client, EQ::ItemInsta
 	if(!item)
 		return 0;
 
-	std::string package_name = "item_";
-	package_name += std::to_string(item->GetID());
 	int ret = 0;
 
-	auto iter = lua_encounter_events_registered.find(package_name);
+	auto iter = lua_encounter_events_registered.find(InternPackageName(item_package_names_, "item_", item->GetID()));
 	if(iter != lua_encounter_events_registered.end()) {
 		auto riter = iter->second.begin();
 		while(riter != iter->second.end()) {
@@ -1283,10 +1355,8 @@ int LuaParser::DispatchEventSpell(QuestEventID evt, NPC* npc, Client *client, ui
 		return 0;
 	}
 
-	std::string package_name = "spell_" + std::to_string(spell_id);
-
     int ret = 0;
-	auto iter = lua_encounter_events_registered.find(package_name);
+	auto iter = lua_encounter_events_registered.find(InternPackageName(spell_package_names_, "spell_", spell_id));
 	if(iter != lua_encounter_events_registered.end()) {
 	    auto riter = iter->second.begin();
 		while(riter != iter->second.end()) {
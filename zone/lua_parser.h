@@ -7,10 +7,13 @@
 #include <string>
 #include <list>
 #include <map>
+#include <unordered_map>
 #include <exception>
 
 #include "zone_config.h"
 #include "lua_mod.h"
+#include "lua_profiler.h"
+#include "lua_bytecode_cache.h"
 
 extern const ZoneConfig *Config;
 
@@ -90,6 +93,9 @@ public:
 
 	bool HasFunction(std::string function, std::string package_name);
 
+	LuaProfiler &GetProfiler() { return profiler_; }
+	void GetProfileReport(std::list<std::string> &report, size_t count);
+
 	//Mod Extensions
 	void MeleeMitigation(Mob *self, Mob *attacker, DamageHitInfo &hit, ExtraAttackOptions *opts, bool &ignoreDefault);
 	void ApplyDamageTable(Mob *self, DamageHitInfo &hit, bool &ignoreDefault);
@@ -106,24 +112,36 @@ private:
 	LuaParser(const LuaParser&);
 	LuaParser& operator=(const LuaParser&);
 
-	int _EventNPC(std::string package_name, QuestEventID evt, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+	int _EventNPC(const std::string &package_name, QuestEventID evt, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 		std::vector<EQ::Any> *extra_pointers, luabind::adl::object *l_func = nullptr);
-	int _EventPlayer(std::string package_name, QuestEventID evt, Client *client, std::string data, uint32 extra_data,
+	int _EventPlayer(const std::string &package_name, QuestEventID evt, Client *client, const std::string &data, uint32 extra_data,
 		std::vector<EQ::Any> *extra_pointers, luabind::adl::object *l_func = nullptr);
-	int _EventItem(std::string package_name, QuestEventID evt, Client *client, EQ::ItemInstance *item, Mob *mob, std::string data,
+	int _EventItem(const std::string &package_name, QuestEventID evt, Client *client, EQ::ItemInstance *item, Mob *mob, const std::string &data,
 		uint32 extra_data, std::vector<EQ::Any> *extra_pointers, luabind::adl::object *l_func = nullptr);
-	int _EventSpell(std::string package_name, QuestEventID evt, NPC* npc, Client *client, uint32 spell_id, std::string data, uint32 extra_data,
+	int _EventSpell(const std::string &package_name, QuestEventID evt, NPC* npc, Client *client, uint32 spell_id, const std::string &data, uint32 extra_data,
 		std::vector<EQ::Any> *extra_pointers, luabind::adl::object *l_func = nullptr);
-	int _EventEncounter(std::string package_name, QuestEventID evt, std::string encounter_name, std::string data, uint32 extra_data,
+	int _EventEncounter(const std::string &package_name, QuestEventID evt, const std::string &encounter_name, const std::string &data, uint32 extra_data,
 		std::vector<EQ::Any> *extra_pointers);
 
 	void LoadScript(std::string filename, std::string package_name);
 	void MapFunctions(lua_State *L);
 	QuestEventID ConvertLuaEvent(QuestEventID evt);
 
+	//event fast path, see PushEventFunction
+	void RegisterEventNames();
+	void PushEventFunction(const std::string &package_name, QuestEventID evt);
+	bool HasEventFunction(const std::string &package_name, QuestEventID evt);
+	static const std::string &InternPackageName(std::unordered_map<uint32, std::string> &names, const char *prefix, uint32 id);
+
 	std::map<std::string, std::string> vars_;
-	std::map<std::string, bool> loaded_;
+	std::unordered_map<std::string, int> loaded_; //package name -> registry ref of its env table
+	std::unordered_map<uint32, std::string> npc_package_names_;
+	std::unordered_map<uint32, std::string> item_package_names_;
+	std::unordered_map<uint32, std::string> spell_package_names_;
+	int event_name_refs_[_LargestEventID];
 	std::vector<LuaMod> mods_;
+	LuaProfiler profiler_;
+	LuaBytecodeCache bytecode_cache_;
 	lua_State *L;
 
 	NPCArgumentHandler NPCArgumentDispatch[_LargestEventID];
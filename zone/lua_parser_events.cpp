@@ -27,13 +27,12 @@
 #include "lua_parser_events.h"
 
 //NPC
-void handle_npc_event_say(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+void handle_npc_event_say(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						  std::vector<EQ::Any> *extra_pointers) {
 	npc->DoQuestPause(init);
 
 	Lua_Client l_client(reinterpret_cast<Client*>(init));
-	luabind::adl::object l_client_o = luabind::adl::object(L, l_client);
-	l_client_o.push(L);
+	luabind::detail::push(L, l_client);
 	lua_setfield(L, -2, "other");
 
 	lua_pushstring(L, data.c_str());
@@ -43,11 +42,10 @@ void handle_npc_event_say(QuestInterface *parse, lua_State* L, NPC* npc, Mob *in
 	lua_setfield(L, -2, "language");
 }
 
-void handle_npc_event_trade(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+void handle_npc_event_trade(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						  std::vector<EQ::Any> *extra_pointers) {
 	Lua_Client l_client(reinterpret_cast<Client*>(init));
-	luabind::adl::object l_client_o = luabind::adl::object(L, l_client);
-	l_client_o.push(L);
+	luabind::detail::push(L, l_client);
 	lua_setfield(L, -2, "other");
 	
 	lua_createtable(L, 0, 0);
@@ -61,8 +59,7 @@ void handle_npc_event_trade(QuestInterface *parse, lua_State* L, NPC* npc, Mob *
 			EQ::ItemInstance *inst = EQ::any_cast<EQ::ItemInstance*>(extra_pointers->at(i));
 
 			Lua_ItemInst l_inst = inst;
-			luabind::adl::object l_inst_o = luabind::adl::object(L, l_inst);
-			l_inst_o.push(L);
+			luabind::detail::push(L, l_inst);
 
 			lua_setfield(L, -2, prefix.c_str());
 		}
@@ -82,7 +79,7 @@ void handle_npc_event_trade(QuestInterface *parse, lua_State* L, NPC* npc, Mob *
 	lua_setfield(L, -2, "trade");
 }
 
-void handle_npc_event_hp(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+void handle_npc_event_hp(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						  std::vector<EQ::Any> *extra_pointers) {
 	if(extra_data == 1) {
 		lua_pushinteger(L, -1);
@@ -99,68 +96,61 @@ void handle_npc_event_hp(QuestInterface *parse, lua_State* L, NPC* npc, Mob *ini
 	}
 }
 
-void handle_npc_single_mob(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+void handle_npc_single_mob(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						  std::vector<EQ::Any> *extra_pointers) {
 	Lua_Mob l_mob(init);
-	luabind::adl::object l_mob_o = luabind::adl::object(L, l_mob);
-	l_mob_o.push(L);
+	luabind::detail::push(L, l_mob);
 	lua_setfield(L, -2, "other");
 }
 
-void handle_npc_single_client(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+void handle_npc_single_client(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						  std::vector<EQ::Any> *extra_pointers) {
 	Lua_Client l_client(reinterpret_cast<Client*>(init));
-	luabind::adl::object l_client_o = luabind::adl::object(L, l_client);
-	l_client_o.push(L);
+	luabind::detail::push(L, l_client);
 	lua_setfield(L, -2, "other");
 }
 
-void handle_npc_single_npc(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+void handle_npc_single_npc(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						  std::vector<EQ::Any> *extra_pointers) {
 	Lua_NPC l_npc(reinterpret_cast<NPC*>(init));
-	luabind::adl::object l_npc_o = luabind::adl::object(L, l_npc);
-	l_npc_o.push(L);
+	luabind::detail::push(L, l_npc);
 	lua_setfield(L, -2, "other");
 }
 
-void handle_npc_task_accepted(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+void handle_npc_task_accepted(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						  std::vector<EQ::Any> *extra_pointers) {
 	Lua_Client l_client(reinterpret_cast<Client*>(init));
-	luabind::adl::object l_client_o = luabind::adl::object(L, l_client);
-	l_client_o.push(L);
+	luabind::detail::push(L, l_client);
 	lua_setfield(L, -2, "other");
 
 	lua_pushinteger(L, std::stoi(data));
 	lua_setfield(L, -2, "task_id");
 }
 
-void handle_npc_popup(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+void handle_npc_popup(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						  std::vector<EQ::Any> *extra_pointers) {
 	Lua_Mob l_mob(init);
-	luabind::adl::object l_mob_o = luabind::adl::object(L, l_mob);
-	l_mob_o.push(L);
+	luabind::detail::push(L, l_mob);
 	lua_setfield(L, -2, "other");
 
 	lua_pushinteger(L, std::stoi(data));
 	lua_setfield(L, -2, "popup_id");
 }
 
-void handle_npc_waypoint(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+void handle_npc_waypoint(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						  std::vector<EQ::Any> *extra_pointers) {
 	Lua_Mob l_mob(init);
-	luabind::adl::object l_mob_o = luabind::adl::object(L, l_mob);
-	l_mob_o.push(L);
+	luabind::detail::push(L, l_mob);
 	lua_setfield(L, -2, "other");
 
 	lua_pushinteger(L, std::stoi(data));
 	lua_setfield(L, -2, "wp");
 }
 
-void handle_npc_hate(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+void handle_npc_hate(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						  std::vector<EQ::Any> *extra_pointers) {
 	Lua_Mob l_mob(init);
-	luabind::adl::object l_mob_o = luabind::adl::object(L, l_mob);
-	l_mob_o.push(L);
+	luabind::detail::push(L, l_mob);
 	lua_setfield(L, -2, "other");
 
 	lua_pushboolean(L, std::stoi(data) == 0 ? false : true);
@@ -168,23 +158,22 @@ void handle_npc_hate(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, s
 }
 
 
-void handle_npc_signal(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+void handle_npc_signal(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						  std::vector<EQ::Any> *extra_pointers) {
 	lua_pushinteger(L, std::stoi(data));
 	lua_setfield(L, -2, "signal");
 }
 
-void handle_npc_timer(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+void handle_npc_timer(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						  std::vector<EQ::Any> *extra_pointers) {
 	lua_pushstring(L, data.c_str());
 	lua_setfield(L, -2, "timer");
 }
 
-void handle_npc_death(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+void handle_npc_death(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						  std::vector<EQ::Any> *extra_pointers) {
 	Lua_Mob l_mob(init);
-	luabind::adl::object l_mob_o = luabind::adl::object(L, l_mob);
-	l_mob_o.push(L);
+	luabind::detail::push(L, l_mob);
 	lua_setfield(L, -2, "other");
 
 	Seperator sep(data.c_str());
@@ -194,13 +183,11 @@ void handle_npc_death(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init,
 	int spell_id = std::stoi(sep.arg[1]);
 	if(IsValidSpell(spell_id)) {
 		Lua_Spell l_spell(&spells[spell_id]);
-		luabind::adl::object l_spell_o = luabind::adl::object(L, l_spell);
-		l_spell_o.push(L);
+		luabind::detail::push(L, l_spell);
 		lua_setfield(L, -2, "spell");
 	} else {
 		Lua_Spell l_spell(nullptr);
-		luabind::adl::object l_spell_o = luabind::adl::object(L, l_spell);
-		l_spell_o.push(L);
+		luabind::detail::push(L, l_spell);
 		lua_setfield(L, -2, "spell");
 	}
 
@@ -208,23 +195,21 @@ void handle_npc_death(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init,
 	lua_setfield(L, -2, "skill_id");
 }
 
-void handle_npc_cast(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+void handle_npc_cast(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						  std::vector<EQ::Any> *extra_pointers) {
 	int spell_id = std::stoi(data);
 	if(IsValidSpell(spell_id)) {
 		Lua_Spell l_spell(&spells[spell_id]);
-		luabind::adl::object l_spell_o = luabind::adl::object(L, l_spell);
-		l_spell_o.push(L);
+		luabind::detail::push(L, l_spell);
 		lua_setfield(L, -2, "spell");
 	} else {
 		Lua_Spell l_spell(nullptr);
-		luabind::adl::object l_spell_o = luabind::adl::object(L, l_spell);
-		l_spell_o.push(L);
+		luabind::detail::push(L, l_spell);
 		lua_setfield(L, -2, "spell");
 	}
 }
 
-void handle_npc_area(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+void handle_npc_area(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						  std::vector<EQ::Any> *extra_pointers) {
 	lua_pushinteger(L, *EQ::any_cast<int*>(extra_pointers->at(0)));
 	lua_setfield(L, -2, "area_id");
@@ -233,30 +218,27 @@ void handle_npc_area(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, s
 	lua_setfield(L, -2, "area_type");
 }
 
-void handle_npc_null(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+void handle_npc_null(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						  std::vector<EQ::Any> *extra_pointers) {
 }
 
-void handle_npc_loot_zone(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, std::string data, uint32 extra_data,
+void handle_npc_loot_zone(QuestInterface *parse, lua_State* L, NPC* npc, Mob *init, const std::string &data, uint32 extra_data,
 						std::vector<EQ::Any> *extra_pointers) {
 	Lua_Client l_client(reinterpret_cast<Client*>(init));
-	luabind::adl::object l_client_o = luabind::adl::object(L, l_client);
-	l_client_o.push(L);
+	luabind::detail::push(L, l_client);
 	lua_setfield(L, -2, "other");
 	
 	Lua_ItemInst l_item(EQ::any_cast<EQ::ItemInstance*>(extra_pointers->at(0)));
-	luabind::adl::object l_item_o = luabind::adl::object(L, l_item);
-	l_item_o.push(L);
+	luabind::detail::push(L, l_item);
 	lua_setfield(L, -2, "item");
 	
 	Lua_Corpse l_corpse(EQ::any_cast<Corpse*>(extra_pointers->at(1)));
-	luabind::adl::object l_corpse_o = luabind::adl::object(L, l_corpse);
-	l_corpse_o.push(L);
+	luabind::detail::push(L, l_corpse);
 	lua_setfield(L, -2, "corpse");
 }
 
 //Player
-void handle_player_say(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_say(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 					   std::vector<EQ::Any> *extra_pointers) {
 	lua_pushstring(L, data.c_str());
 	lua_setfield(L, -2, "message");
@@ -265,7 +247,7 @@ void handle_player_say(QuestInterface *parse, lua_State* L, Client* client, std:
 	lua_setfield(L, -2, "language");
 }
 
-void handle_player_environmental_damage(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_environmental_damage(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 	std::vector<EQ::Any> *extra_pointers){
 	Seperator sep(data.c_str());
 	lua_pushinteger(L, std::stoi(sep.arg[0]));
@@ -278,14 +260,13 @@ void handle_player_environmental_damage(QuestInterface *parse, lua_State* L, Cli
 	lua_setfield(L, -2, "env_final_damage");
 }
 
-void handle_player_death(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_death(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 						 std::vector<EQ::Any> *extra_pointers) {
 	Seperator sep(data.c_str());
 
 	Mob *o = entity_list.GetMobID(std::stoi(sep.arg[0]));
 	Lua_Mob l_mob(o);
-	luabind::adl::object l_mob_o = luabind::adl::object(L, l_mob);
-	l_mob_o.push(L);
+	luabind::detail::push(L, l_mob);
 	lua_setfield(L, -2, "other");
 
 	lua_pushinteger(L, std::stoi(sep.arg[1]));
@@ -294,13 +275,11 @@ void handle_player_death(QuestInterface *parse, lua_State* L, Client* client, st
 	int spell_id = std::stoi(sep.arg[2]);
 	if(IsValidSpell(spell_id)) {
 		Lua_Spell l_spell(&spells[spell_id]);
-		luabind::adl::object l_spell_o = luabind::adl::object(L, l_spell);
-		l_spell_o.push(L);
+		luabind::detail::push(L, l_spell);
 		lua_setfield(L, -2, "spell");
 	} else {
 		Lua_Spell l_spell(nullptr);
-		luabind::adl::object l_spell_o = luabind::adl::object(L, l_spell);
-		l_spell_o.push(L);
+		luabind::detail::push(L, l_spell);
 		lua_setfield(L, -2, "spell");
 	}
 
@@ -308,130 +287,118 @@ void handle_player_death(QuestInterface *parse, lua_State* L, Client* client, st
 	lua_setfield(L, -2, "skill");
 }
 
-void handle_player_timer(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_timer(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 						 std::vector<EQ::Any> *extra_pointers) {
 	lua_pushstring(L, data.c_str());
 	lua_setfield(L, -2, "timer");
 }
 
-void handle_player_discover_item(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_discover_item(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 								 std::vector<EQ::Any> *extra_pointers) {
 	const EQ::ItemData *item = database.GetItem(extra_data);
 	if(item) {
 		Lua_Item l_item(item);
-		luabind::adl::object l_item_o = luabind::adl::object(L, l_item);
-		l_item_o.push(L);
+		luabind::detail::push(L, l_item);
 		lua_setfield(L, -2, "item");
 	} else {
 		Lua_Item l_item(nullptr);
-		luabind::adl::object l_item_o = luabind::adl::object(L, l_item);
-		l_item_o.push(L);
+		luabind::detail::push(L, l_item);
 		lua_setfield(L, -2, "item");
 	}
 }
 
-void handle_player_fish_forage_success(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_fish_forage_success(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 									   std::vector<EQ::Any> *extra_pointers) {
 	Lua_ItemInst l_item(EQ::any_cast<EQ::ItemInstance*>(extra_pointers->at(0)));
-	luabind::adl::object l_item_o = luabind::adl::object(L, l_item);
-	l_item_o.push(L);
+	luabind::detail::push(L, l_item);
 	lua_setfield(L, -2, "item");
 }
 
-void handle_player_click_object(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_click_object(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 								std::vector<EQ::Any> *extra_pointers) {
 	Lua_Object l_object(EQ::any_cast<Object*>(extra_pointers->at(0)));
-	luabind::adl::object l_object_o = luabind::adl::object(L, l_object);
-	l_object_o.push(L);
+	luabind::detail::push(L, l_object);
 	lua_setfield(L, -2, "object");
 }
 
-void handle_player_click_door(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_click_door(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 							  std::vector<EQ::Any> *extra_pointers) {
 	Lua_Door l_door(EQ::any_cast<Doors*>(extra_pointers->at(0)));
-	luabind::adl::object l_door_o = luabind::adl::object(L, l_door);
-	l_door_o.push(L);
+	luabind::detail::push(L, l_door);
 	lua_setfield(L, -2, "door");
 }
 
-void handle_player_signal(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_signal(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 						  std::vector<EQ::Any> *extra_pointers) {
 	lua_pushinteger(L, std::stoi(data));
 	lua_setfield(L, -2, "signal");
 }
 
-void handle_player_popup_response(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_popup_response(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 								  std::vector<EQ::Any> *extra_pointers) {
 	lua_pushinteger(L, std::stoi(data));
 	lua_setfield(L, -2, "popup_id");
 }
 
-void handle_player_pick_up(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_pick_up(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 						   std::vector<EQ::Any> *extra_pointers) {
 	Lua_ItemInst l_item(EQ::any_cast<EQ::ItemInstance*>(extra_pointers->at(0)));
-	luabind::adl::object l_item_o = luabind::adl::object(L, l_item);
-	l_item_o.push(L);
+	luabind::detail::push(L, l_item);
 	lua_setfield(L, -2, "item");
 }
 
-void handle_player_cast(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_cast(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 						std::vector<EQ::Any> *extra_pointers) {
 	int spell_id = std::stoi(data);
 	if(IsValidSpell(spell_id)) {
 		Lua_Spell l_spell(&spells[spell_id]);
-		luabind::adl::object l_spell_o = luabind::adl::object(L, l_spell);
-		l_spell_o.push(L);
+		luabind::detail::push(L, l_spell);
 	} else {
 		Lua_Spell l_spell(nullptr);
-		luabind::adl::object l_spell_o = luabind::adl::object(L, l_spell);
-		l_spell_o.push(L);
+		luabind::detail::push(L, l_spell);
 	}
 
 	lua_setfield(L, -2, "spell");
 }
 
-void handle_player_task_fail(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_task_fail(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 							 std::vector<EQ::Any> *extra_pointers) {
 	lua_pushinteger(L, std::stoi(data));
 	lua_setfield(L, -2, "task_id");
 }
 
-void handle_player_zone(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_zone(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 						std::vector<EQ::Any> *extra_pointers) {
 	lua_pushinteger(L, std::stoi(data));
 	lua_setfield(L, -2, "zone_id");
 }
 
-void handle_player_duel_win(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_duel_win(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 							std::vector<EQ::Any> *extra_pointers) {
 	Lua_Client l_client(EQ::any_cast<Client*>(extra_pointers->at(1)));
-	luabind::adl::object l_client_o = luabind::adl::object(L, l_client);
-	l_client_o.push(L);
+	luabind::detail::push(L, l_client);
 	lua_setfield(L, -2, "other");
 }
 
-void handle_player_duel_loss(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_duel_loss(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 							 std::vector<EQ::Any> *extra_pointers) {
 	Lua_Client l_client(EQ::any_cast<Client*>(extra_pointers->at(0)));
-	luabind::adl::object l_client_o = luabind::adl::object(L, l_client);
-	l_client_o.push(L);
+	luabind::detail::push(L, l_client);
 	lua_setfield(L, -2, "other");
 }
 
-void handle_player_loot(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_loot(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 						std::vector<EQ::Any> *extra_pointers) {
 	Lua_ItemInst l_item(EQ::any_cast<EQ::ItemInstance*>(extra_pointers->at(0)));
-	luabind::adl::object l_item_o = luabind::adl::object(L, l_item);
-	l_item_o.push(L);
+	luabind::detail::push(L, l_item);
 	lua_setfield(L, -2, "item");
 
 	Lua_Corpse l_corpse(EQ::any_cast<Corpse*>(extra_pointers->at(1)));
-	luabind::adl::object l_corpse_o = luabind::adl::object(L, l_corpse);
-	l_corpse_o.push(L);
+	luabind::detail::push(L, l_corpse);
 	lua_setfield(L, -2, "corpse");
 }
 
-void handle_player_task_stage_complete(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_task_stage_complete(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 									   std::vector<EQ::Any> *extra_pointers) {
 	Seperator sep(data.c_str());
 	lua_pushinteger(L, std::stoi(sep.arg[0]));
@@ -441,7 +408,7 @@ void handle_player_task_stage_complete(QuestInterface *parse, lua_State* L, Clie
 	lua_setfield(L, -2, "activity_id");
 }
 
-void handle_player_task_update(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_task_update(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 								 std::vector<EQ::Any> *extra_pointers) {
 	Seperator sep(data.c_str());
 	lua_pushinteger(L, std::stoi(sep.arg[0]));
@@ -454,7 +421,7 @@ void handle_player_task_update(QuestInterface *parse, lua_State* L, Client* clie
 	lua_setfield(L, -2, "task_id");
 }
 
-void handle_player_command(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_command(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 						   std::vector<EQ::Any> *extra_pointers) {
 	Seperator sep(data.c_str(), ' ', 10, 100, true);
 	std::string command(sep.arg[0] + 1);
@@ -473,7 +440,7 @@ void handle_player_command(QuestInterface *parse, lua_State* L, Client* client,
 	lua_setfield(L, -2, "args");
 }
 
-void handle_player_combine(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_combine(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 						   std::vector<EQ::Any> *extra_pointers) {
 	lua_pushinteger(L, extra_data);
 	lua_setfield(L, -2, "recipe_id");
@@ -482,15 +449,14 @@ void handle_player_combine(QuestInterface *parse, lua_State* L, Client* client,
 	lua_setfield(L, -2, "recipe_name");	
 }
 
-void handle_player_feign(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_feign(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 						std::vector<EQ::Any> *extra_pointers) {
 	Lua_NPC l_npc(EQ::any_cast<NPC*>(extra_pointers->at(0)));
-	luabind::adl::object l_npc_o = luabind::adl::object(L, l_npc);
-	l_npc_o.push(L);
+	luabind::detail::push(L, l_npc);
 	lua_setfield(L, -2, "other");
 }
 
-void handle_player_area(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_area(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 						std::vector<EQ::Any> *extra_pointers) {
 	lua_pushinteger(L, *EQ::any_cast<int*>(extra_pointers->at(0)));
 	lua_setfield(L, -2, "area_id");
@@ -499,7 +465,7 @@ void handle_player_area(QuestInterface *parse, lua_State* L, Client* client, std
 	lua_setfield(L, -2, "area_type");
 }
 
-void handle_player_respawn(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_respawn(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 						std::vector<EQ::Any> *extra_pointers) {
 	lua_pushinteger(L, std::stoi(data));
 	lua_setfield(L, -2, "option");
@@ -508,22 +474,21 @@ void handle_player_respawn(QuestInterface *parse, lua_State* L, Client* client,
 	lua_setfield(L, -2, "resurrect");
 }
 
-void handle_player_packet(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_packet(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 						std::vector<EQ::Any> *extra_pointers) {
 	Lua_Packet l_packet(EQ::any_cast<EQApplicationPacket*>(extra_pointers->at(0)));
-	luabind::adl::object l_packet_o = luabind::adl::object(L, l_packet);
-	l_packet_o.push(L);
+	luabind::detail::push(L, l_packet);
 	lua_setfield(L, -2, "packet");
 
 	lua_pushboolean(L, extra_data == 1 ? true : false);
 	lua_setfield(L, -2, "connecting");
 }
 
-void handle_player_null(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_null(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 						std::vector<EQ::Any> *extra_pointers) {
 }
 
-void handle_player_use_skill(QuestInterface *parse, lua_State* L, Client* client, std::string data, uint32 extra_data, std::vector<EQ::Any> *extra_pointers) {
+void handle_player_use_skill(QuestInterface *parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data, std::vector<EQ::Any> *extra_pointers) {
 	Seperator sep(data.c_str());
 	lua_pushinteger(L, std::stoi(sep.arg[0]));
 	lua_setfield(L, -2, "skill_id");
@@ -532,10 +497,10 @@ void handle_player_use_skill(QuestInterface *parse, lua_State* L, Client* client
 	lua_setfield(L, -2, "skill_level");
 }
 
-void handle_test_buff(QuestInterface* parse, lua_State* L, Client* client, std::string data, uint32 extra_data, std::vector<EQ::Any>* extra_pointers) {
+void handle_test_buff(QuestInterface* parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data, std::vector<EQ::Any>* extra_pointers) {
 }
 
-void handle_player_combine_validate(QuestInterface* parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_combine_validate(QuestInterface* parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 									std::vector<EQ::Any>* extra_pointers) {
 	Seperator sep(data.c_str());
 	lua_pushinteger(L, extra_data);
@@ -560,7 +525,7 @@ void handle_player_combine_validate(QuestInterface* parse, lua_State* L, Client*
 	lua_setfield(L, -2, "tradeskill_id");
 }
 
-void handle_player_bot_command(QuestInterface* parse, lua_State* L, Client* client, std::string data, uint32 extra_data,
+void handle_player_bot_command(QuestInterface* parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data,
 	std::vector<EQ::Any>* extra_pointers) {
 	Seperator sep(data.c_str(), ' ', 10, 100, true);
 	std::string bot_command(sep.arg[0] + 1);
@@ -579,7 +544,7 @@ void handle_player_bot_command(QuestInterface* parse, lua_State* L, Client* clie
 	lua_setfield(L, -2, "args");
 }
 
-void handle_player_warp(QuestInterface* parse, lua_State* L, Client* client, std::string data, uint32 extra_data, std::vector<EQ::Any>* extra_pointers) {
+void handle_player_warp(QuestInterface* parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data, std::vector<EQ::Any>* extra_pointers) {
 	Seperator sep(data.c_str());
 	lua_pushnumber(L, std::stof(sep.arg[0]));
 	lua_setfield(L, -2, "from_x");
@@ -591,103 +556,95 @@ void handle_player_warp(QuestInterface* parse, lua_State* L, Client* client, std
 	lua_setfield(L, -2, "from_z");
 }
 
-void handle_player_quest_combine(QuestInterface* parse, lua_State* L, Client* client, std::string data, uint32 extra_data, std::vector<EQ::Any>* extra_pointers) {
+void handle_player_quest_combine(QuestInterface* parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data, std::vector<EQ::Any>* extra_pointers) {
 	lua_pushinteger(L, std::stoi(data));
 	lua_setfield(L, -2, "container_slot");
  }
  
-void handle_player_consider(QuestInterface* parse, lua_State* L, Client* client, std::string data, uint32 extra_data, std::vector<EQ::Any>* extra_pointers) {
+void handle_player_consider(QuestInterface* parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data, std::vector<EQ::Any>* extra_pointers) {
 	lua_pushinteger(L, std::stoi(data));
 	lua_setfield(L, -2, "entity_id");
 }
 
-void handle_player_consider_corpse(QuestInterface* parse, lua_State* L, Client* client, std::string data, uint32 extra_data, std::vector<EQ::Any>* extra_pointers) {
+void handle_player_consider_corpse(QuestInterface* parse, lua_State* L, Client* client, const std::string &data, uint32 extra_data, std::vector<EQ::Any>* extra_pointers) {
 	lua_pushinteger(L, std::stoi(data));
 	lua_setfield(L, -2, "corpse_entity_id");
 }
 
 //Item
-void handle_item_click(QuestInterface *parse, lua_State* L, Client* client, EQ::ItemInstance* item, Mob *mob, std::string data, uint32 extra_data,
+void handle_item_click(QuestInterface *parse, lua_State* L, Client* client, EQ::ItemInstance* item, Mob *mob, const std::string &data, uint32 extra_data,
 					   std::vector<EQ::Any> *extra_pointers) {
 	lua_pushinteger(L, extra_data);
 	lua_setfield(L, -2, "slot_id");
 }
 
-void handle_item_timer(QuestInterface *parse, lua_State* L, Client* client, EQ::ItemInstance* item, Mob *mob, std::string data, uint32 extra_data,
+void handle_item_timer(QuestInterface *parse, lua_State* L, Client* client, EQ::ItemInstance* item, Mob *mob, const std::string &data, uint32 extra_data,
 					  std::vector<EQ::Any> *extra_pointers) {
 	lua_pushstring(L, data.c_str());
 	lua_setfield(L, -2, "timer");
 }
 
-void handle_item_proc(QuestInterface *parse, lua_State* L, Client* client, EQ::ItemInstance* item, Mob *mob, std::string data, uint32 extra_data,
+void handle_item_proc(QuestInterface *parse, lua_State* L, Client* client, EQ::ItemInstance* item, Mob *mob, const std::string &data, uint32 extra_data,
 					   std::vector<EQ::Any> *extra_pointers) {
 
 	Lua_Mob l_mob(mob);
-	luabind::adl::object l_mob_o = luabind::adl::object(L, l_mob);
-	l_mob_o.push(L);
+	luabind::detail::push(L, l_mob);
 	lua_setfield(L, -2, "target");
 
 	if(IsValidSpell(extra_data)) {
 		Lua_Spell l_spell(&spells[extra_data]);
-		luabind::adl::object l_spell_o = luabind::adl::object(L, l_spell);
-		l_spell_o.push(L);
+		luabind::detail::push(L, l_spell);
 		lua_setfield(L, -2, "spell");
 	} else {
 		Lua_Spell l_spell(nullptr);
-		luabind::adl::object l_spell_o = luabind::adl::object(L, l_spell);
-		l_spell_o.push(L);
+		luabind::detail::push(L, l_spell);
 		lua_setfield(L, -2, "spell");
 	}
 }
 
-void handle_item_loot(QuestInterface *parse, lua_State* L, Client* client, EQ::ItemInstance* item, Mob *mob, std::string data, uint32 extra_data,
+void handle_item_loot(QuestInterface *parse, lua_State* L, Client* client, EQ::ItemInstance* item, Mob *mob, const std::string &data, uint32 extra_data,
 					  std::vector<EQ::Any> *extra_pointers) {
 	if(mob && mob->IsCorpse()) {
 		Lua_Corpse l_corpse(mob->CastToCorpse());
-		luabind::adl::object l_corpse_o = luabind::adl::object(L, l_corpse);
-		l_corpse_o.push(L);
+		luabind::detail::push(L, l_corpse);
 		lua_setfield(L, -2, "corpse");
 	} else {
 		Lua_Corpse l_corpse(nullptr);
-		luabind::adl::object l_corpse_o = luabind::adl::object(L, l_corpse);
-		l_corpse_o.push(L);
+		luabind::detail::push(L, l_corpse);
 		lua_setfield(L, -2, "corpse");
 	}
 }
 
-void handle_item_equip(QuestInterface *parse, lua_State* L, Client* client, EQ::ItemInstance* item, Mob *mob, std::string data, uint32 extra_data,
+void handle_item_equip(QuestInterface *parse, lua_State* L, Client* client, EQ::ItemInstance* item, Mob *mob, const std::string &data, uint32 extra_data,
 					   std::vector<EQ::Any> *extra_pointers) {
 	lua_pushinteger(L, extra_data);
 	lua_setfield(L, -2, "slot_id");
 }
 
-void handle_item_augment(QuestInterface *parse, lua_State* L, Client* client, EQ::ItemInstance* item, Mob *mob, std::string data, uint32 extra_data,
+void handle_item_augment(QuestInterface *parse, lua_State* L, Client* client, EQ::ItemInstance* item, Mob *mob, const std::string &data, uint32 extra_data,
 					  std::vector<EQ::Any> *extra_pointers) {
 	Lua_ItemInst l_item(EQ::any_cast<EQ::ItemInstance*>(extra_pointers->at(0)));
-	luabind::adl::object l_item_o = luabind::adl::object(L, l_item);
-	l_item_o.push(L);
+	luabind::detail::push(L, l_item);
 	lua_setfield(L, -2, "aug");
 
 	lua_pushinteger(L, extra_data);
 	lua_setfield(L, -2, "slot_id");
 }
 
-void handle_item_augment_insert(QuestInterface *parse, lua_State* L, Client* client, EQ::ItemInstance* item, Mob *mob, std::string data, uint32 extra_data,
+void handle_item_augment_insert(QuestInterface *parse, lua_State* L, Client* client, EQ::ItemInstance* item, Mob *mob, const std::string &data, uint32 extra_data,
 					  std::vector<EQ::Any> *extra_pointers) {
 	Lua_ItemInst l_item(EQ::any_cast<EQ::ItemInstance*>(extra_pointers->at(0)));
-	luabind::adl::object l_item_o = luabind::adl::object(L, l_item);
-	l_item_o.push(L);
+	luabind::detail::push(L, l_item);
 	lua_setfield(L, -2, "item");
 
 	lua_pushinteger(L, extra_data);
 	lua_setfield(L, -2, "slot_id");
 }
 
-void handle_item_augment_remove(QuestInterface *parse, lua_State* L, Client* client, EQ::ItemInstance* item, Mob *mob, std::string data, uint32 extra_data,
+void handle_item_augment_remove(QuestInterface *parse, lua_State* L, Client* client, EQ::ItemInstance* item, Mob *mob, const std::string &data, uint32 extra_data,
 					  std::vector<EQ::Any> *extra_pointers) {
 	Lua_ItemInst l_item(EQ::any_cast<EQ::ItemInstance*>(extra_pointers->at(0)));
-	luabind::adl::object l_item_o = luabind::adl::object(L, l_item);
-	l_item_o.push(L);
+	luabind::detail::push(L, l_item);
 	lua_setfield(L, -2, "item");
 
 	lua_pushinteger(L, extra_data);
@@ -697,24 +654,21 @@ void handle_item_augment_remove(QuestInterface *parse, lua_State* L, Client* cli
 	lua_setfield(L, -2, "destroyed");
 }
 
-void handle_item_null(QuestInterface *parse, lua_State* L, Client* client, EQ::ItemInstance* item, Mob *mob, std::string data, uint32 extra_data,
+void handle_item_null(QuestInterface *parse, lua_State* L, Client* client, EQ::ItemInstance* item, Mob *mob, const std::string &data, uint32 extra_data,
 					  std::vector<EQ::Any> *extra_pointers) {
 }
 
 //Spell
-void handle_spell_event(QuestInterface *parse, lua_State* L, NPC* npc, Client* client, uint32 spell_id, std::string data, uint32 extra_data, std::vector<EQ::Any> *extra_pointers) {
+void handle_spell_event(QuestInterface *parse, lua_State* L, NPC* npc, Client* client, uint32 spell_id, const std::string &data, uint32 extra_data, std::vector<EQ::Any> *extra_pointers) {
 	if(npc) {
 		Lua_Mob l_npc(npc);
-		luabind::adl::object l_npc_o = luabind::adl::object(L, l_npc);
-		l_npc_o.push(L);
+		luabind::detail::push(L, l_npc);
 	} else if(client) {
 		Lua_Mob l_client(client);
-		luabind::adl::object l_client_o = luabind::adl::object(L, l_client);
-		l_client_o.push(L);
+		luabind::detail::push(L, l_client);
 	} else {
 		Lua_Mob l_mob(nullptr);
-		luabind::adl::object l_mob_o = luabind::adl::object(L, l_mob);
-		l_mob_o.push(L);
+		luabind::detail::push(L, l_mob);
 	}
 
 	lua_setfield(L, -2, "target");
@@ -737,43 +691,38 @@ void handle_spell_event(QuestInterface *parse, lua_State* L, NPC* npc, Client* c
 	lua_setfield(L, -2, "buff_slot");
 	
 	Lua_Spell l_spell(spell_id);
-	luabind::adl::object l_spell_o = luabind::adl::object(L, l_spell);
-	l_spell_o.push(L);
+	luabind::detail::push(L, l_spell);
 	lua_setfield(L, -2, "spell");
 }
 
-void handle_translocate_finish(QuestInterface *parse, lua_State* L, NPC* npc, Client* client, uint32 spell_id, std::string data, uint32 extra_data, std::vector<EQ::Any> *extra_pointers) {
+void handle_translocate_finish(QuestInterface *parse, lua_State* L, NPC* npc, Client* client, uint32 spell_id, const std::string &data, uint32 extra_data, std::vector<EQ::Any> *extra_pointers) {
 	if(npc) {
 		Lua_Mob l_npc(npc);
-		luabind::adl::object l_npc_o = luabind::adl::object(L, l_npc);
-		l_npc_o.push(L);
+		luabind::detail::push(L, l_npc);
 	} else if(client) {
 		Lua_Mob l_client(client);
-		luabind::adl::object l_client_o = luabind::adl::object(L, l_client);
-		l_client_o.push(L);
+		luabind::detail::push(L, l_client);
 	} else {
 		Lua_Mob l_mob(nullptr);
-		luabind::adl::object l_mob_o = luabind::adl::object(L, l_mob);
-		l_mob_o.push(L);
+		luabind::detail::push(L, l_mob);
 	}
 
 	lua_setfield(L, -2, "target");
 }
 
-void handle_spell_null(QuestInterface *parse, lua_State* L, NPC* npc, Client* client, uint32 spell_id, std::string data, uint32 extra_data, std::vector<EQ::Any> *extra_pointers) { }
+void handle_spell_null(QuestInterface *parse, lua_State* L, NPC* npc, Client* client, uint32 spell_id, const std::string &data, uint32 extra_data, std::vector<EQ::Any> *extra_pointers) { }
 
-void handle_encounter_timer(QuestInterface *parse, lua_State* L, Encounter* encounter, std::string data, uint32 extra_data,
+void handle_encounter_timer(QuestInterface *parse, lua_State* L, Encounter* encounter, const std::string &data, uint32 extra_data,
 							std::vector<EQ::Any> *extra_pointers) {
 	lua_pushstring(L, data.c_str());
 	lua_setfield(L, -2, "timer");
 }
 
-void handle_encounter_load(QuestInterface *parse, lua_State* L, Encounter* encounter, std::string data, uint32 extra_data,
+void handle_encounter_load(QuestInterface *parse, lua_State* L, Encounter* encounter, const std::string &data, uint32 extra_data,
 									 std::vector<EQ::Any> *extra_pointers) {
 	if (encounter) {
 		Lua_Encounter l_enc(encounter);
-		luabind::adl::object l_enc_o = luabind::adl::object(L, l_enc);
-		l_enc_o.push(L);
+		luabind::detail::push(L, l_enc);
 		lua_setfield(L, -2, "encounter");
 	}
 	if (extra_pointers) {
@@ -783,7 +732,7 @@ void handle_encounter_load(QuestInterface *parse, lua_State* L, Encounter* encou
 	}
 }
 
-void handle_encounter_unload(QuestInterface *parse, lua_State* L, Encounter* encounter, std::string data, uint32 extra_data,
+void handle_encounter_unload(QuestInterface *parse, lua_State* L, Encounter* encounter, const std::string &data, uint32 extra_data,
 	std::vector<EQ::Any> *extra_pointers) {
 	if (extra_pointers) {
 		std::string *str = EQ::any_cast<std::string*>(extra_pointers->at(0));
@@ -792,7 +741,7 @@ void handle_encounter_unload(QuestInterface *parse, lua_State* L, Encounter* enc
 	}
 }
 
-void handle_encounter_null(QuestInterface *parse, lua_State* L, Encounter* encounter, std::string data, uint32 extra_data,
+void handle_encounter_null(QuestInterface *parse, lua_State* L, Encounter* encounter, const std::string &data, uint32 extra_data,
 						   std::vector<EQ::Any> *extra_pointers) {
 
 }
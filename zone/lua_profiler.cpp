@@ -0,0 +1,288 @@
+#ifdef LUA_EQEMU
+
+#include "lua.hpp"
+
+#include <algorithm>
+#include <stdio.h>
+
+#include "../common/string_util.h"
+#include "event_codes.h"
+#include "lua_profiler.h"
+
+namespace {
+	//one lua state per zone process, the hook has no other way back to its profiler
+	LuaProfiler *active_profiler = nullptr;
+}
+
+LuaProfiler::LuaProfiler()
+{
+	L                   = nullptr;
+	enabled_            = false;
+	sample_interval_    = 1000;
+	instruction_budget_ = 0;
+	hook_interval_      = 0;
+	total_samples_      = 0;
+}
+
+void LuaProfiler::Attach(lua_State *state)
+{
+	L = state;
+	active_profiler = this;
+
+	frames_.clear();
+	events_.clear();
+	functions_.clear();
+	total_samples_ = 0;
+	hook_interval_ = 0;
+
+	InstallHook();
+}
+
+void LuaProfiler::SetEnabled(bool enabled)
+{
+	enabled_ = enabled;
+	InstallHook();
+}
+
+void LuaProfiler::SetSampleInterval(int instructions)
+{
+	sample_interval_ = std::max(instructions, 1);
+	InstallHook();
+}
+
+void LuaProfiler::SetInstructionBudget(int instructions)
+{
+	instruction_budget_ = std::max(instructions, 0);
+	InstallHook();
+}
+
+void LuaProfiler::InstallHook()
+{
+	if (!L) {
+		return;
+	}
+
+	int interval = 0;
+	if (enabled_) {
+		interval = sample_interval_;
+	}
+
+	if (instruction_budget_ > 0) {
+		interval = interval > 0 ? std::min(interval, instruction_budget_) : instruction_budget_;
+	}
+
+	if (interval == hook_interval_) {
+		return;
+	}
+
+	hook_interval_ = interval;
+	if (interval > 0) {
+		lua_sethook(L, &LuaProfiler::Hook, LUA_MASKCOUNT, interval);
+	}
+	else {
+		lua_sethook(L, nullptr, 0, 0);
+	}
+}
+
+uint64 LuaProfiler::HeapBytes() const
+{
+	return static_cast<uint64>(lua_gc(L, LUA_GCCOUNT, 0)) * 1024 + static_cast<uint64>(lua_gc(L, LUA_GCCOUNTB, 0));
+}
+
+//returns false when nothing is being measured, the caller skips EndEvent in that case
+bool LuaProfiler::BeginEvent(const std::string &package_name, int event_id, const char *event_name)
+{
+	if (!L || hook_interval_ == 0 || event_id < 0 || event_id >= _LargestEventID) {
+		return false;
+	}
+
+	auto &package = events_[package_name];
+	if (package.empty()) {
+		package.resize(_LargestEventID);
+	}
+
+	auto &entry = package[event_id];
+	if (entry.name.empty()) {
+		entry.name = package_name + ":" + (event_name ? event_name : std::to_string(event_id));
+	}
+
+	Frame frame;
+	frame.entry        = &entry;
+	frame.start        = std::chrono::steady_clock::now();
+	frame.heap_start   = enabled_ ? HeapBytes() : 0;
+	frame.instructions = 0;
+	frame.aborted      = false;
+	frames_.push_back(frame);
+	return true;
+}
+
+void LuaProfiler::EndEvent()
+{
+	if (frames_.empty()) {
+		return;
+	}
+
+	Frame frame = frames_.back();
+	frames_.pop_back();
+
+	auto &entry = *frame.entry;
+	auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - frame.start
+	).count();
+
+	entry.calls++;
+	entry.total_us += static_cast<uint64>(elapsed);
+	entry.max_us = std::max(entry.max_us, static_cast<uint64>(elapsed));
+	if (frame.aborted) {
+		entry.aborted++;
+	}
+
+	if (enabled_) {
+		//the heap can shrink when a gc step lands inside the handler, only growth is attributed
+		uint64 heap_end = HeapBytes();
+		if (heap_end > frame.heap_start) {
+			entry.alloc_bytes += heap_end - frame.heap_start;
+		}
+	}
+
+	//nested events count against the budget of the event that triggered them
+	if (!frames_.empty()) {
+		frames_.back().instructions += frame.instructions;
+	}
+}
+
+void LuaProfiler::Hook(lua_State *L, lua_Debug *ar)
+{
+	if (active_profiler) {
+		active_profiler->OnHook(L, ar);
+	}
+}
+
+void LuaProfiler::OnHook(lua_State *state, lua_Debug *ar)
+{
+	if (ar->event != LUA_HOOKCOUNT) {
+		return;
+	}
+
+	Frame *frame = frames_.empty() ? nullptr : &frames_.back();
+
+	if (enabled_ && lua_getinfo(state, "S", ar)) {
+		FunctionKey key{ar->source, ar->linedefined};
+		auto &entry = functions_[key];
+		if (entry.name.empty()) {
+			entry.name = StringFormat("%s:%d", ar->short_src, ar->linedefined);
+		}
+
+		entry.samples++;
+		total_samples_++;
+		if (frame) {
+			frame->entry->samples++;
+		}
+	}
+
+	if (!frame || instruction_budget_ <= 0) {
+		return;
+	}
+
+	frame->instructions += hook_interval_;
+	if (frame->instructions >= instruction_budget_ && !frame->aborted) {
+		frame->aborted = true;
+		luaL_error(
+			state,
+			"%s aborted after exceeding the instruction budget of %d",
+			frame->entry->name.c_str(),
+			instruction_budget_
+		);
+	}
+}
+
+void LuaProfiler::Reset()
+{
+	//stats are zeroed in place so any open frame keeps a valid entry
+	for (auto &package : events_) {
+		for (auto &entry : package.second) {
+			std::string name = std::move(entry.name);
+			entry      = LuaProfileEntry();
+			entry.name = std::move(name);
+		}
+	}
+
+	for (auto &function : functions_) {
+		function.second.samples = 0;
+	}
+
+	total_samples_ = 0;
+}
+
+void LuaProfiler::GetReport(std::list<std::string> &report, size_t count) const
+{
+	std::vector<const LuaProfileEntry *> events;
+	for (auto &package : events_) {
+		for (auto &entry : package.second) {
+			if (entry.calls > 0) {
+				events.push_back(&entry);
+			}
+		}
+	}
+
+	std::sort(
+		events.begin(), events.end(), [](const LuaProfileEntry *a, const LuaProfileEntry *b) {
+			return a->total_us > b->total_us;
+		}
+	);
+
+	report.push_back(
+		StringFormat(
+			"Lua profiler [%s] sample interval [%d] instruction budget [%d]",
+			enabled_ ? "on" : "off",
+			sample_interval_,
+			instruction_budget_
+		)
+	);
+
+	report.push_back("Events by total time: name calls total_ms avg_us max_us alloc_kb samples aborted");
+	for (size_t i = 0; i < events.size() && i < count; ++i) {
+		auto e = events[i];
+		report.push_back(
+			StringFormat(
+				"%s %llu %.2f %llu %llu %llu %llu %u",
+				e->name.c_str(),
+				(unsigned long long) e->calls,
+				e->total_us / 1000.0,
+				(unsigned long long) (e->total_us / e->calls),
+				(unsigned long long) e->max_us,
+				(unsigned long long) (e->alloc_bytes / 1024),
+				(unsigned long long) e->samples,
+				e->aborted
+			)
+		);
+	}
+
+	std::vector<const LuaProfileEntry *> functions;
+	for (auto &function : functions_) {
+		if (function.second.samples > 0) {
+			functions.push_back(&function.second);
+		}
+	}
+
+	std::sort(
+		functions.begin(), functions.end(), [](const LuaProfileEntry *a, const LuaProfileEntry *b) {
+			return a->samples > b->samples;
+		}
+	);
+
+	report.push_back("Functions by samples: source:line samples percent");
+	for (size_t i = 0; i < functions.size() && i < count; ++i) {
+		auto f = functions[i];
+		report.push_back(
+			StringFormat(
+				"%s %llu %.1f%%",
+				f->name.c_str(),
+				(unsigned long long) f->samples,
+				total_samples_ ? f->samples * 100.0 / total_samples_ : 0.0
+			)
+		);
+	}
+}
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef EQEMU_LUA_PROFILER_H
+#define EQEMU_LUA_PROFILER_H
+#ifdef LUA_EQEMU
+
+#include <chrono>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../common/types.h"
+
+struct lua_State;
+struct lua_Debug;
+
+struct LuaProfileEntry
+{
+	std::string name;
+	uint64 calls = 0;
+	uint64 total_us = 0;
+	uint64 max_us = 0;
+	uint64 samples = 0;
+	uint64 alloc_bytes = 0;
+	uint32 aborted = 0;
+};
+
+/*
+ * Accounting for quest handlers running in the zone's lua state.
+ *
+ * Each handler call is bracketed by BeginEvent/EndEvent which records wall time and
+ * the growth of the lua heap against package + event. A count hook installed with
+ * lua_sethook samples the running function every sample_interval instructions and
+ * enforces the optional per-event instruction budget by raising a lua error, which
+ * the handler's lua_pcall reports like any other script error.
+ *
+ * Under LuaJIT count hooks only fire for interpreted code, so samples and budget are
+ * approximate for traces the JIT has compiled.
+ */
+class LuaProfiler
+{
+public:
+	LuaProfiler();
+
+	void Attach(lua_State *L);
+
+	void SetEnabled(bool enabled);
+	bool IsEnabled() const { return enabled_; }
+	void SetSampleInterval(int instructions);
+	int GetSampleInterval() const { return sample_interval_; }
+	void SetInstructionBudget(int instructions);
+	int GetInstructionBudget() const { return instruction_budget_; }
+
+	bool BeginEvent(const std::string &package_name, int event_id, const char *event_name);
+	void EndEvent();
+
+	void Reset();
+	void GetReport(std::list<std::string> &report, size_t count) const;
+
+private:
+	struct Frame
+	{
+		LuaProfileEntry *entry;
+		std::chrono::steady_clock::time_point start;
+		uint64 heap_start;
+		int64 instructions;
+		bool aborted;
+	};
+
+	struct FunctionKey
+	{
+		const char *source;
+		int line;
+		bool operator==(const FunctionKey &o) const { return source == o.source && line == o.line; }
+	};
+
+	struct FunctionKeyHash
+	{
+		size_t operator()(const FunctionKey &k) const
+		{
+			return std::hash<const void*>()(k.source) ^ (std::hash<int>()(k.line) << 1);
+		}
+	};
+
+	static void Hook(lua_State *L, lua_Debug *ar);
+	void OnHook(lua_State *L, lua_Debug *ar);
+	void InstallHook();
+	uint64 HeapBytes() const;
+
+	lua_State *L;
+	bool enabled_;
+	int sample_interval_;
+	int instruction_budget_;
+	int hook_interval_;
+	uint64 total_samples_;
+
+	std::vector<Frame> frames_;
+	std::unordered_map<std::string, std::vector<LuaProfileEntry>> events_;
+	//keys point at source strings owned by the lua state, cleared whenever that state is replaced
+	std::unordered_map<FunctionKey, LuaProfileEntry, FunctionKeyHash> functions_;
+};
+
+#endif
+#endif
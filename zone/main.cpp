@@ -39,6 +39,8 @@
 
 #include "api_service.h"
 #include "zone_config.h"
+#include "zone_benchmark.h"
+#include "combat_sim.h"
 #include "masterentity.h"
 #include "worldserver.h"
 #include "zone.h"
@@ -60,6 +62,7 @@
 
 #include "../common/net/eqstream.h"
 #include "../common/content/world_content_service.h"
+#include "../common/opcode_stats.h"
 
 #include <stdlib.h>
 #include <signal.h>
@@ -103,8 +106,11 @@ NpcScaleManager *npc_scale_manager;
 QuestParserCollection *parse = 0;
 EQEmuLogSys          LogSys;
 ZoneEventScheduler event_scheduler;
+OpcodeStats client_opcode_stats;
+OpcodeStats server_opcode_stats;
 WorldContentService  content_service;
 const SPDat_Spell_Struct* spells;
+const SpellTraits* spell_traits = nullptr;
 int32 SPDAT_RECORDS = -1;
 const ZoneConfig *Config;
 double frame_time = 0.0;
@@ -153,7 +159,21 @@ int main(int argc, char** argv) {
 	const char *zone_name;
 	uint32 instance_id = 0;
 	std::string z_name;
-	if (argc == 4) {
+
+	ZoneBenchmark::Options benchmark_options;
+	bool benchmark = ZoneBenchmark::ParseArgs(argc, argv, benchmark_options);
+
+	CombatSim::Options combat_sim_options;
+	bool combat_sim = CombatSim::ParseArgs(argc, argv, combat_sim_options);
+
+	if (benchmark || combat_sim) {
+		// no port: no client listener, no websocket server
+		Config->SetZonePort(0);
+		worldserver.SetLauncherName("NONE");
+		zone_name = benchmark ? benchmark_options.zone_name.c_str() : combat_sim_options.zone_name.c_str();
+		worldserver.SetLaunchedName(zone_name);
+	}
+	else if (argc == 4) {
 		instance_id = atoi(argv[3]);
 		worldserver.SetLauncherName(argv[2]);
 		auto zone_port = SplitString(argv[1], ':');
@@ -327,7 +347,7 @@ int main(int argc, char** argv) {
 	}
 
 	LogInfo("Loading spells");
-	if (!database.LoadSpells(hotfix_name, &SPDAT_RECORDS, &spells)) {
+	if (!database.LoadSpells(hotfix_name, &SPDAT_RECORDS, &spells, &spell_traits)) {
 		LogError("Loading spells failed!");
 		return 1;
 	}
@@ -384,6 +404,9 @@ int main(int argc, char** argv) {
 
 		EQ::InitializeDynamicLookups();
 		LogInfo("Initialized dynamic dictionary entries");
+
+		client_opcode_stats.SetEnabled(RuleB(Zone, OpcodeStatistics));
+		server_opcode_stats.SetEnabled(RuleB(Zone, OpcodeStatistics));
 	}
 
 	content_service.SetDatabase(&database)
@@ -436,7 +459,9 @@ int main(int argc, char** argv) {
 	LogInfo("Loading quests");
 	parse->ReloadQuests();
 
-	worldserver.Connect();
+	if (!benchmark && !combat_sim) {
+		worldserver.Connect();
+	}
 	worldserver.SetScheduler(&event_scheduler);
 
 	Timer InterserverTimer(INTERSERVER_TIMER); // does MySQL pings and auto-reconnect
@@ -454,6 +479,21 @@ int main(int argc, char** argv) {
 		zone = nullptr;
 	}
 
+	std::unique_ptr<ZoneBenchmark> zone_benchmark;
+	if (benchmark) {
+		zone_benchmark = std::make_unique<ZoneBenchmark>(benchmark_options);
+		if (!zone_benchmark->Populate()) {
+			LogError("Benchmark could not populate zone [{}]", zone_name);
+			return 1;
+		}
+	}
+
+	if (combat_sim) {
+		int result = CombatSim(combat_sim_options).Run() ? 0 : 1;
+		LogSys.CloseFileLogs();
+		return result;
+	}
+
 	//register all the patches we have avaliable with the stream identifier.
 	EQStreamIdentifier stream_identifier;
 	RegisterAllPatches(stream_identifier);
@@ -541,8 +581,14 @@ int main(int argc, char** argv) {
 			}
 		}
 
+		if (zone_benchmark) {
+			zone_benchmark->StartTick();
+		}
+
 		if (is_zone_loaded) {
 			{
+				ZoneBenchmark::Stage tick_stage(ZoneBenchmark::StageTick);
+
 				entity_list.GroupProcess();
 				entity_list.DoorProcess();
 				entity_list.ObjectProcess();
@@ -550,12 +596,16 @@ int main(int argc, char** argv) {
 				entity_list.TrapProcess();
 				entity_list.RaidProcess();
 				entity_list.Process();
-				entity_list.MobProcess();
+				{
+					ZoneBenchmark::Stage stage(ZoneBenchmark::StageMobProcess);
+					entity_list.MobProcess();
+				}
 				entity_list.BeaconProcess();
 				entity_list.EncounterProcess();
 				event_scheduler.Process(zone, &content_service);
 
 				if (zone) {
+					ZoneBenchmark::Stage stage(ZoneBenchmark::StageZoneProcess);
 					if (!zone->Process()) {
 						Zone::Shutdown();
 					}
@@ -574,6 +624,11 @@ int main(int argc, char** argv) {
 			content_db.ping();
 			entity_list.UpdateWho();
 		}
+
+		if (zone_benchmark && zone_benchmark->EndTick()) {
+			zone_benchmark->Report();
+			EQ::EventLoop::Get().Shutdown();
+		}
 	};
 
 	EQ::Timer process_timer(loop_fn);
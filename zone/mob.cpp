@@ -418,6 +418,7 @@ Mob::Mob(
 	follow_run         = true;    // We can run if distance great enough
 	no_target_hotkey   = false;
 	flee_mode          = false;
+	faction_bonus_version = 0;
 	currently_fleeing  = false;
 	flee_timer.Start();
 
@@ -1383,6 +1384,9 @@ void Mob::CreateHPPacket(EQApplicationPacket* app)
 
 void Mob::SendHPUpdate(bool force_update_all)
 {
+	if (entity_list.DeferHPUpdate(this, force_update_all)) {
+		return;
+	}
 
 	// If our HP is different from last HP update call - let's update selves
 	if (IsClient()) {
@@ -2368,10 +2372,19 @@ void Mob::ShowBuffList(Client* client) {
 	}
 }
 
+void Mob::SetPosition(const float x, const float y, const float z)
+{
+	m_Position.x = x;
+	m_Position.y = y;
+	m_Position.z = z;
+	entity_list.UpdateMobPosition(this);
+}
+
 void Mob::GMMove(float x, float y, float z, float heading, bool SendUpdate) {
 	m_Position.x = x;
 	m_Position.y = y;
 	m_Position.z = z;
+	entity_list.UpdateMobPosition(this);
 	SetHeading(heading);
 	mMovementManager->SendCommandToClients(this, 0.0, 0.0, 0.0, 0.0, 0, ClientRangeAny);
 
@@ -4765,7 +4778,6 @@ std::string Mob::GetGlobal(const char *varname) {
 		qgCharid = this->CastToClient()->CharacterID();
 
 	QGlobalCache *qglobals = nullptr;
-	std::list<QGlobal> globalMap;
 
 	if (this->IsClient())
 		qglobals = this->CastToClient()->GetQGlobals();
@@ -4773,15 +4785,10 @@ std::string Mob::GetGlobal(const char *varname) {
 	if (this->IsNPC())
 		qglobals = this->CastToNPC()->GetQGlobals();
 
-	if(qglobals)
-		QGlobalCache::Combine(globalMap, qglobals->GetBucket(), qgNpcid, qgCharid, zone->GetZoneID());
-
-	auto iter = globalMap.begin();
-	while(iter != globalMap.end()) {
-		if ((*iter).name.compare(varname) == 0)
-			return (*iter).value;
-
-		++iter;
+	if(qglobals) {
+		auto global = qglobals->FindGlobal(varname, qgNpcid, qgCharid, zone->GetZoneID());
+		if (global)
+			return global->value;
 	}
 
 	return "Undefined";
@@ -5748,6 +5755,8 @@ void Mob::AddFactionBonus(uint32 pFactionID,int32 bonus) {
 	std::map <uint32, int32> :: const_iterator faction_bonus;
 	typedef std::pair <uint32, int32> NewFactionBonus;
 
+	faction_bonus_version++;
+
 	faction_bonus = faction_bonuses.find(pFactionID);
 	if(faction_bonus == faction_bonuses.end())
 	{
@@ -5768,6 +5777,8 @@ void Mob::AddItemFactionBonus(uint32 pFactionID,int32 bonus) {
 	std::map <uint32, int32> :: const_iterator faction_bonus;
 	typedef std::pair <uint32, int32> NewFactionBonus;
 
+	faction_bonus_version++;
+
 	faction_bonus = item_faction_bonuses.find(pFactionID);
 	if(faction_bonus == item_faction_bonuses.end())
 	{
@@ -5804,6 +5815,10 @@ int32 Mob::GetItemFactionBonus(uint32 pFactionID) {
 }
 
 void Mob::ClearItemFactionBonuses() {
+	if (!item_faction_bonuses.empty()) {
+		faction_bonus_version++;
+	}
+
 	item_faction_bonuses.clear();
 }
 
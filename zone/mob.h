@@ -376,6 +376,7 @@ public:
 	void BuffModifyDurationBySpellID(uint16 spell_id, int32 newDuration);
 	int AddBuff(Mob *caster, const uint16 spell_id, int duration = 0, int32 level_override = -1);
 	int CanBuffStack(uint16 spellid, uint8 caster_level, bool iFailIfOverwrite = false);
+	inline void InvalidateBuffStackCache() { buff_stack_cache.clear(); }
 	int CalcBuffDuration(Mob *caster, Mob *target, uint16 spell_id, int32 caster_level_override = -1);
 	void SendPetBuffsToClient();
 	virtual int GetCurrentBuffSlots() const { return 0; }
@@ -577,7 +578,7 @@ public:
 	uint32 GetNPCTypeID() const { return npctype_id; }
 	void SetNPCTypeID(uint32 npctypeid) { npctype_id = npctypeid; }
 	inline const glm::vec4& GetPosition() const { return m_Position; }
-	inline void SetPosition(const float x, const float y, const float z) { m_Position.x = x; m_Position.y = y; m_Position.z = z; }
+	void SetPosition(const float x, const float y, const float z);
 	inline const float GetX() const { return m_Position.x; }
 	inline const float GetY() const { return m_Position.y; }
 	inline const float GetZ() const { return m_Position.z; }
@@ -1397,6 +1398,13 @@ protected:
 	uint32 scalerate;
 	Buffs_Struct *buffs;
 	uint32 current_buff_count;
+	std::unordered_map<uint32, int> buff_stack_cache; // (spell, caster level, fail on overwrite) -> CanBuffStack, cleared when buffs change
+	int CalcBuffStack(uint16 spellid, uint8 caster_level, bool iFailIfOverwrite);
+	void IndexBuffSlot(int slot);
+	void UnindexBuffSlot(int slot);
+	void GetBuffStackCandidates(uint16 spell_id, int buff_count, std::vector<bool> &candidates);
+	std::vector<uint16> buff_index_spell; // buff slot -> spell id as last indexed
+	std::unordered_map<uint32, std::vector<int>> buff_effect_index; // (effect id, effect index) -> buff slots
 	StatBonuses itembonuses;
 	StatBonuses spellbonuses;
 	StatBonuses aabonuses;
@@ -1653,6 +1661,8 @@ protected:
 	void AddItemFactionBonus(uint32 pFactionID,int32 bonus);
 	int32 GetItemFactionBonus(uint32 pFactionID);
 	void ClearItemFactionBonuses();
+	// bumped whenever either bonus map changes, so cached faction standings know to recalculate
+	uint32 faction_bonus_version;
 	Timer hate_list_cleanup_timer;
 
 	bool flee_mode;
@@ -29,6 +29,7 @@
 #include "quest_parser_collection.h"
 #include "string_ids.h"
 #include "water_map.h"
+#include "zone_benchmark.h"
 #include "fastmath.h"
 #include "../common/data_verification.h"
 
@@ -83,293 +84,308 @@ bool NPC::AICastSpell(Mob* tar, uint8 iChance, uint32 iSpellTypes, bool bInnates
 	bool checked_los = false;	//we do not check LOS until we are absolutely sure we need to, and we only do it once.
 
 	float manaR = GetManaRatio();
-	for (int i = static_cast<int>(AIspells.size()) - 1; i >= 0; i--) {
-		if (AIspells[i].spellid <= 0 || AIspells[i].spellid >= SPDAT_RECORDS) {
-			// this is both to quit early to save cpu and to avoid casting bad spells
-			// Bad info from database can trigger this incorrectly, but that should be fixed in DB, not here
-			//return false;
-			continue;
-		}
-
-		if ((AIspells[i].priority == 0 && !bInnates) || (AIspells[i].priority != 0 && bInnates)) {
-			// so "innate" spells are special and spammed a bit
-			// we define an innate spell as a spell with priority 0
-			continue;
-		}
-
+	int self_hp_ratio = GetIntHPRatio();
+	for (auto i : GetAISpellCandidates(iSpellTypes, bInnates)) {
 		// we reuse these fields for heal overrides
-		if (AIspells[i].type != SpellType_Heal && AIspells[i].min_hp != 0 && GetIntHPRatio() < AIspells[i].min_hp)
+		if (AIspells[i].type != SpellType_Heal && AIspells[i].min_hp != 0 && self_hp_ratio < AIspells[i].min_hp)
 			continue;
 
-		if (AIspells[i].type != SpellType_Heal && AIspells[i].max_hp != 0 && GetIntHPRatio() > AIspells[i].max_hp)
+		if (AIspells[i].type != SpellType_Heal && AIspells[i].max_hp != 0 && self_hp_ratio > AIspells[i].max_hp)
 			continue;
 
-		if (iSpellTypes & AIspells[i].type) {
-			// manacost has special values, -1 is no mana cost, -2 is instant cast (no mana)
-			int32 mana_cost = AIspells[i].manacost;
-			if (mana_cost == -1)
-				mana_cost = spells[AIspells[i].spellid].mana;
-			else if (mana_cost == -2)
-				mana_cost = 0;
-			// this is ugly -- ignore distance for hatelist spells, looks like the client is only checking distance for some targettypes in CastSpell,
-			// should probably match that eventually. This should be good enough for now I guess ....
-			if (
-				(
-				 (spells[AIspells[i].spellid].target_type == ST_HateList || spells[AIspells[i].spellid].target_type == ST_AETargetHateList) ||
-				 (
-				  // note: I think this check is actually wrong and we should be checking range instead in all cases, BUT if range is 0, range check is skipped? Works for now
-				  (spells[AIspells[i].spellid].target_type==ST_AECaster || spells[AIspells[i].spellid].target_type==ST_AEBard || spells[AIspells[i].spellid].target_type==ST_AEClientV1)
-				  && dist2 <= spells[AIspells[i].spellid].aoe_range*spells[AIspells[i].spellid].aoe_range
-				 ) ||
-				 dist2 <= spells[AIspells[i].spellid].range*spells[AIspells[i].spellid].range
-				 )
-				&& (mana_cost <= GetMana() || GetMana() == GetMaxMana())
-				&& (AIspells[i].time_cancast + (zone->random.Int(0, 4) * 500)) <= Timer::GetCurrentTime() //break up the spelling casting over a period of time.
-				) {
+		int32 mana_cost = AIspells[i].resolved_mana_cost;
+		if (
+			dist2 <= AIspells[i].range_squared
+			&& (mana_cost <= GetMana() || GetMana() == GetMaxMana())
+			&& (AIspells[i].time_cancast + (zone->random.Int(0, 4) * 500)) <= Timer::GetCurrentTime() //break up the spelling casting over a period of time.
+			) {
 
 #if MobAI_DEBUG_Spells >= 21
-				LogAI("Mob::AICastSpell: Casting: spellid=[{}], tar=[{}], dist2[[{}]]<=[{}], mana_cost[[{}]]<=[{}], cancast[[{}]]<=[{}], type=[{}]",
-					AIspells[i].spellid, tar->GetName(), dist2, (spells[AIspells[i].spellid].range * spells[AIspells[i].spellid].range), mana_cost, GetMana(), AIspells[i].time_cancast, Timer::GetCurrentTime(), AIspells[i].type);
+			LogAI("Mob::AICastSpell: Casting: spellid=[{}], tar=[{}], dist2[[{}]]<=[{}], mana_cost[[{}]]<=[{}], cancast[[{}]]<=[{}], type=[{}]",
+				AIspells[i].spellid, tar->GetName(), dist2, (spells[AIspells[i].spellid].range * spells[AIspells[i].spellid].range), mana_cost, GetMana(), AIspells[i].time_cancast, Timer::GetCurrentTime(), AIspells[i].type);
 #endif
 
-				switch (AIspells[i].type) {
-					case SpellType_Heal: {
-						if (
-							(spells[AIspells[i].spellid].target_type == ST_Target || tar == this)
-							&& tar->DontHealMeBefore() < Timer::GetCurrentTime()
-							&& !(tar->IsPet() && tar->GetOwner()->IsClient())	//no buffing PC's pets
-							) {
+			switch (AIspells[i].type) {
+				case SpellType_Heal: {
+					if (
+						(spells[AIspells[i].spellid].target_type == ST_Target || tar == this)
+						&& tar->DontHealMeBefore() < Timer::GetCurrentTime()
+						&& !(tar->IsPet() && tar->GetOwner()->IsClient())	//no buffing PC's pets
+						) {
 
-							auto hp_ratio = tar->GetIntHPRatio();
+						auto hp_ratio = tar->GetIntHPRatio();
 
-							int min_hp = AIspells[i].min_hp; // well 0 is default, so no special case here
-							int max_hp = AIspells[i].max_hp ? AIspells[i].max_hp : RuleI(Spells, AI_HealHPPct);
+						int min_hp = AIspells[i].min_hp; // well 0 is default, so no special case here
+						int max_hp = AIspells[i].max_hp ? AIspells[i].max_hp : RuleI(Spells, AI_HealHPPct);
 
-							if (EQ::ValueWithin(hp_ratio, min_hp, max_hp) || (tar->IsClient() && hp_ratio <= 99)) { // not sure about client bit, leaving it
-								uint32 tempTime = 0;
-								AIDoSpellCast(i, tar, mana_cost, &tempTime);
-								tar->SetDontHealMeBefore(tempTime);
-								return true;
-							}
-						}
-						break;
-					}
-					case SpellType_Root: {
-						Mob *rootee = GetHateRandom();
-						if (rootee && !rootee->IsRooted() && !rootee->IsFeared() && (bInnates || zone->random.Roll(50))
-							&& rootee->DontRootMeBefore() < Timer::GetCurrentTime()
-							&& rootee->CanBuffStack(AIspells[i].spellid, GetLevel(), true) >= 0
-							) {
-							if(!checked_los) {
-								if(!CheckLosFN(rootee))
-									return(false);	//cannot see target... we assume that no spell is going to work since we will only be casting detrimental spells in this call
-								checked_los = true;
-							}
+						if (EQ::ValueWithin(hp_ratio, min_hp, max_hp) || (tar->IsClient() && hp_ratio <= 99)) { // not sure about client bit, leaving it
 							uint32 tempTime = 0;
-							AIDoSpellCast(i, rootee, mana_cost, &tempTime);
-							rootee->SetDontRootMeBefore(tempTime);
+							AIDoSpellCast(i, tar, mana_cost, &tempTime);
+							tar->SetDontHealMeBefore(tempTime);
 							return true;
 						}
-						break;
 					}
-					case SpellType_Buff: {
-						if (
-							(spells[AIspells[i].spellid].target_type == ST_Target || tar == this)
-							&& tar->DontBuffMeBefore() < Timer::GetCurrentTime()
-							&& !tar->IsImmuneToSpell(AIspells[i].spellid, this)
-							&& tar->CanBuffStack(AIspells[i].spellid, GetLevel(), true) >= 0
-							&& !(tar->IsPet() && tar->GetOwner()->IsClient() && this != tar)	//no buffing PC's pets, but they can buff themself
-							)
-						{
-							if(!checked_los) {
-								if(!CheckLosFN(tar))
-									return(false);
-								checked_los = true;
-							}
-							uint32 tempTime = 0;
-							AIDoSpellCast(i, tar, mana_cost, &tempTime);
-							tar->SetDontBuffMeBefore(tempTime);
-							return true;
+					break;
+				}
+				case SpellType_Root: {
+					Mob *rootee = GetHateRandom();
+					if (rootee && !rootee->IsRooted() && !rootee->IsFeared() && (bInnates || zone->random.Roll(50))
+						&& rootee->DontRootMeBefore() < Timer::GetCurrentTime()
+						&& rootee->CanBuffStack(AIspells[i].spellid, GetLevel(), true) >= 0
+						) {
+						if(!checked_los) {
+							if(!CheckLosFN(rootee))
+								return(false);	//cannot see target... we assume that no spell is going to work since we will only be casting detrimental spells in this call
+							checked_los = true;
 						}
-						break;
+						uint32 tempTime = 0;
+						AIDoSpellCast(i, rootee, mana_cost, &tempTime);
+						rootee->SetDontRootMeBefore(tempTime);
+						return true;
+					}
+					break;
+				}
+				case SpellType_Buff: {
+					if (
+						(spells[AIspells[i].spellid].target_type == ST_Target || tar == this)
+						&& tar->DontBuffMeBefore() < Timer::GetCurrentTime()
+						&& !tar->IsImmuneToSpell(AIspells[i].spellid, this)
+						&& tar->CanBuffStack(AIspells[i].spellid, GetLevel(), true) >= 0
+						&& !(tar->IsPet() && tar->GetOwner()->IsClient() && this != tar)	//no buffing PC's pets, but they can buff themself
+						)
+					{
+						if(!checked_los) {
+							if(!CheckLosFN(tar))
+								return(false);
+							checked_los = true;
+						}
+						uint32 tempTime = 0;
+						AIDoSpellCast(i, tar, mana_cost, &tempTime);
+						tar->SetDontBuffMeBefore(tempTime);
+						return true;
 					}
+					break;
+				}
 
-					case SpellType_InCombatBuff: {
-						if(bInnates || zone->random.Roll(50))
-						{
+				case SpellType_InCombatBuff: {
+					if(bInnates || zone->random.Roll(50))
+					{
+						AIDoSpellCast(i, tar, mana_cost);
+						return true;
+					}
+					break;
+				}
+
+				case SpellType_Escape: {
+					// If min_hp !=0 then the spell list has specified
+					// custom range and we're inside that range if we
+					// made it here.
+					if (AIspells[i].min_hp != 0 || GetHPRatio() <= (RuleI(NPC, NPCGatePercent))) {
+						auto npcSpawnPoint = CastToNPC()->GetSpawnPoint();
+						if (!RuleB(NPC, NPCGateNearBind) && DistanceNoZ(m_Position, npcSpawnPoint) < RuleI(NPC, NPCGateDistanceBind)) {
+							break;
+						} else {
 							AIDoSpellCast(i, tar, mana_cost);
 							return true;
 						}
-						break;
 					}
-
-					case SpellType_Escape: {
-						// If min_hp !=0 then the spell list has specified
-						// custom range and we're inside that range if we
-						// made it here.
-						if (AIspells[i].min_hp != 0 || GetHPRatio() <= (RuleI(NPC, NPCGatePercent))) {
-							auto npcSpawnPoint = CastToNPC()->GetSpawnPoint();
-							if (!RuleB(NPC, NPCGateNearBind) && DistanceNoZ(m_Position, npcSpawnPoint) < RuleI(NPC, NPCGateDistanceBind)) {
-								break;
-							} else {
-								AIDoSpellCast(i, tar, mana_cost);
-								return true;
-							}
+					break;
+				}
+				case SpellType_Slow:
+				case SpellType_Debuff: {
+					Mob * debuffee = GetHateRandom();
+					if (debuffee && manaR >= 10 && (bInnates || zone->random.Roll(70)) &&
+							debuffee->CanBuffStack(AIspells[i].spellid, GetLevel(), true) >= 0) {
+						if (!checked_los) {
+							if (!CheckLosFN(debuffee))
+								return false;
+							checked_los = true;
 						}
-						break;
+						AIDoSpellCast(i, debuffee, mana_cost);
+						return true;
 					}
-					case SpellType_Slow:
-					case SpellType_Debuff: {
-						Mob * debuffee = GetHateRandom();
-						if (debuffee && manaR >= 10 && (bInnates || zone->random.Roll(70)) &&
-								debuffee->CanBuffStack(AIspells[i].spellid, GetLevel(), true) >= 0) {
-							if (!checked_los) {
-								if (!CheckLosFN(debuffee))
-									return false;
-								checked_los = true;
-							}
-							AIDoSpellCast(i, debuffee, mana_cost);
-							return true;
+					break;
+				}
+				case SpellType_Nuke: {
+					if (
+						manaR >= 10 && (bInnates || (zone->random.Roll(70)
+						&& tar->CanBuffStack(AIspells[i].spellid, GetLevel(), false) >= 0)) // saying it's a nuke here, AI shouldn't care too much if overwriting
+						) {
+						if(!checked_los) {
+							if(!CheckLosFN(tar))
+								return(false);	//cannot see target... we assume that no spell is going to work since we will only be casting detrimental spells in this call
+							checked_los = true;
 						}
-						break;
+						AIDoSpellCast(i, tar, mana_cost);
+						return true;
 					}
-					case SpellType_Nuke: {
-						if (
-							manaR >= 10 && (bInnates || (zone->random.Roll(70)
-							&& tar->CanBuffStack(AIspells[i].spellid, GetLevel(), false) >= 0)) // saying it's a nuke here, AI shouldn't care too much if overwriting
-							) {
-							if(!checked_los) {
-								if(!CheckLosFN(tar))
-									return(false);	//cannot see target... we assume that no spell is going to work since we will only be casting detrimental spells in this call
-								checked_los = true;
-							}
-							AIDoSpellCast(i, tar, mana_cost);
-							return true;
+					break;
+				}
+				case SpellType_Dispel: {
+					if(bInnates || zone->random.Roll(15))
+					{
+						if(!checked_los) {
+							if(!CheckLosFN(tar))
+								return(false);	//cannot see target... we assume that no spell is going to work since we will only be casting detrimental spells in this call
+							checked_los = true;
 						}
-						break;
-					}
-					case SpellType_Dispel: {
-						if(bInnates || zone->random.Roll(15))
+						if(tar->CountDispellableBuffs() > 0)
 						{
-							if(!checked_los) {
-								if(!CheckLosFN(tar))
-									return(false);	//cannot see target... we assume that no spell is going to work since we will only be casting detrimental spells in this call
-								checked_los = true;
-							}
-							if(tar->CountDispellableBuffs() > 0)
-							{
-								AIDoSpellCast(i, tar, mana_cost);
-								return true;
-							}
+							AIDoSpellCast(i, tar, mana_cost);
+							return true;
 						}
-						break;
 					}
-					case SpellType_Mez: {
-						if(bInnates || zone->random.Roll(20))
-						{
-							Mob * mezTar = nullptr;
-							mezTar = entity_list.GetTargetForMez(this);
+					break;
+				}
+				case SpellType_Mez: {
+					if(bInnates || zone->random.Roll(20))
+					{
+						Mob * mezTar = nullptr;
+						mezTar = entity_list.GetTargetForMez(this);
 
-							if(mezTar && mezTar->CanBuffStack(AIspells[i].spellid, GetLevel(), true) >= 0)
-							{
-								AIDoSpellCast(i, mezTar, mana_cost);
-								return true;
-							}
+						if(mezTar && mezTar->CanBuffStack(AIspells[i].spellid, GetLevel(), true) >= 0)
+						{
+							AIDoSpellCast(i, mezTar, mana_cost);
+							return true;
 						}
-						break;
 					}
+					break;
+				}
 
-					case SpellType_Charm:
+				case SpellType_Charm:
+				{
+					if(!IsPet() && (bInnates || zone->random.Roll(20)))
 					{
-						if(!IsPet() && (bInnates || zone->random.Roll(20)))
+						Mob * chrmTar = GetHateRandom();
+						if(chrmTar && chrmTar->CanBuffStack(AIspells[i].spellid, GetLevel(), true) >= 0)
 						{
-							Mob * chrmTar = GetHateRandom();
-							if(chrmTar && chrmTar->CanBuffStack(AIspells[i].spellid, GetLevel(), true) >= 0)
-							{
-								AIDoSpellCast(i, chrmTar, mana_cost);
-								return true;
-							}
+							AIDoSpellCast(i, chrmTar, mana_cost);
+							return true;
 						}
-						break;
 					}
+					break;
+				}
 
-					case SpellType_Pet: {
-						//keep mobs from recasting pets when they have them.
-						if (!IsPet() && !GetPetID() && (bInnates || zone->random.Roll(25))) {
-							AIDoSpellCast(i, tar, mana_cost);
-							return true;
-						}
-						break;
+				case SpellType_Pet: {
+					//keep mobs from recasting pets when they have them.
+					if (!IsPet() && !GetPetID() && (bInnates || zone->random.Roll(25))) {
+						AIDoSpellCast(i, tar, mana_cost);
+						return true;
 					}
-					case SpellType_Lifetap: {
-						if (GetHPRatio() <= 95
-							&& (bInnates || zone->random.Roll(50))
-							&& tar->CanBuffStack(AIspells[i].spellid, GetLevel(), true) >= 0
-							) {
-							if(!checked_los) {
-								if(!CheckLosFN(tar))
-									return(false);	//cannot see target... we assume that no spell is going to work since we will only be casting detrimental spells in this call
-								checked_los = true;
-							}
-							AIDoSpellCast(i, tar, mana_cost);
-							return true;
+					break;
+				}
+				case SpellType_Lifetap: {
+					if (GetHPRatio() <= 95
+						&& (bInnates || zone->random.Roll(50))
+						&& tar->CanBuffStack(AIspells[i].spellid, GetLevel(), true) >= 0
+						) {
+						if(!checked_los) {
+							if(!CheckLosFN(tar))
+								return(false);	//cannot see target... we assume that no spell is going to work since we will only be casting detrimental spells in this call
+							checked_los = true;
 						}
-						break;
+						AIDoSpellCast(i, tar, mana_cost);
+						return true;
 					}
-					case SpellType_Snare: {
-						if (
-							!tar->IsRooted()
-							&& (bInnates || zone->random.Roll(50))
-							&& tar->DontSnareMeBefore() < Timer::GetCurrentTime()
-							&& tar->CanBuffStack(AIspells[i].spellid, GetLevel(), true) >= 0
-							) {
-							if(!checked_los) {
-								if(!CheckLosFN(tar))
-									return(false);	//cannot see target... we assume that no spell is going to work since we will only be casting detrimental spells in this call
-								checked_los = true;
-							}
-							uint32 tempTime = 0;
-							AIDoSpellCast(i, tar, mana_cost, &tempTime);
-							tar->SetDontSnareMeBefore(tempTime);
-							return true;
+					break;
+				}
+				case SpellType_Snare: {
+					if (
+						!tar->IsRooted()
+						&& (bInnates || zone->random.Roll(50))
+						&& tar->DontSnareMeBefore() < Timer::GetCurrentTime()
+						&& tar->CanBuffStack(AIspells[i].spellid, GetLevel(), true) >= 0
+						) {
+						if(!checked_los) {
+							if(!CheckLosFN(tar))
+								return(false);	//cannot see target... we assume that no spell is going to work since we will only be casting detrimental spells in this call
+							checked_los = true;
 						}
-						break;
+						uint32 tempTime = 0;
+						AIDoSpellCast(i, tar, mana_cost, &tempTime);
+						tar->SetDontSnareMeBefore(tempTime);
+						return true;
 					}
-					case SpellType_DOT: {
-						if (
-							(bInnates || zone->random.Roll(60))
-							&& tar->DontDotMeBefore() < Timer::GetCurrentTime()
-							&& tar->CanBuffStack(AIspells[i].spellid, GetLevel(), true) >= 0
-							) {
-							if(!checked_los) {
-								if(!CheckLosFN(tar))
-									return(false);	//cannot see target... we assume that no spell is going to work since we will only be casting detrimental spells in this call
-								checked_los = true;
-							}
-							uint32 tempTime = 0;
-							AIDoSpellCast(i, tar, mana_cost, &tempTime);
-							tar->SetDontDotMeBefore(tempTime);
-							return true;
+					break;
+				}
+				case SpellType_DOT: {
+					if (
+						(bInnates || zone->random.Roll(60))
+						&& tar->DontDotMeBefore() < Timer::GetCurrentTime()
+						&& tar->CanBuffStack(AIspells[i].spellid, GetLevel(), true) >= 0
+						) {
+						if(!checked_los) {
+							if(!CheckLosFN(tar))
+								return(false);	//cannot see target... we assume that no spell is going to work since we will only be casting detrimental spells in this call
+							checked_los = true;
 						}
-						break;
-					}
-					default: {
-						std::cout << "Error: Unknown spell type in AICastSpell. caster:" << this->GetName() << " type:" << AIspells[i].type << " slot:" << i << std::endl;
-						break;
+						uint32 tempTime = 0;
+						AIDoSpellCast(i, tar, mana_cost, &tempTime);
+						tar->SetDontDotMeBefore(tempTime);
+						return true;
 					}
+					break;
+				}
+				default: {
+					std::cout << "Error: Unknown spell type in AICastSpell. caster:" << this->GetName() << " type:" << AIspells[i].type << " slot:" << i << std::endl;
+					break;
 				}
 			}
+		}
 #if MobAI_DEBUG_Spells >= 21
-			else {
-				LogAI("Mob::AICastSpell: NotCasting: spellid=[{}], tar=[{}], dist2[[{}]]<=[{}], mana_cost[[{}]]<=[{}], cancast[[{}]]<=[{}], type=[{}]",
-					AIspells[i].spellid, tar->GetName(), dist2, (spells[AIspells[i].spellid].range * spells[AIspells[i].spellid].range), mana_cost, GetMana(), AIspells[i].time_cancast, Timer::GetCurrentTime(), AIspells[i].type);
-			}
-#endif
+		else {
+			LogAI("Mob::AICastSpell: NotCasting: spellid=[{}], tar=[{}], dist2[[{}]]<=[{}], mana_cost[[{}]]<=[{}], cancast[[{}]]<=[{}], type=[{}]",
+				AIspells[i].spellid, tar->GetName(), dist2, (spells[AIspells[i].spellid].range * spells[AIspells[i].spellid].range), mana_cost, GetMana(), AIspells[i].time_cancast, Timer::GetCurrentTime(), AIspells[i].type);
 		}
+#endif
+
 	}
 	return false;
 }
 
+/**
+ * Everything in AICastSpell's filter that only depends on the spell list: valid spell, innate
+ * (priority 0) or not, and type against the requested mask. The caller walks the result instead
+ * of the whole list; HP, range, mana and target checks stay per call
+ *
+ * @param spell_types
+ * @param innates
+ * @return AIspells indexes, highest first like the list walk they replace
+ */
+const std::vector<uint8> &NPC::GetAISpellCandidates(uint32 spell_types, bool innates)
+{
+	for (auto &c : ai_spell_candidates) {
+		if (c.spell_types == spell_types && c.innates == innates) {
+			return c.indexes;
+		}
+	}
+
+	AISpellCandidates candidates;
+	candidates.spell_types = spell_types;
+	candidates.innates     = innates;
+
+	for (int i = static_cast<int>(AIspells.size()) - 1; i >= 0; i--) {
+		if (AIspells[i].spellid <= 0 || AIspells[i].spellid >= SPDAT_RECORDS) {
+			// Bad info from database can trigger this incorrectly, but that should be fixed in DB, not here
+			continue;
+		}
+
+		// so "innate" spells are special and spammed a bit
+		// we define an innate spell as a spell with priority 0
+		if ((AIspells[i].priority == 0) != innates) {
+			continue;
+		}
+
+		if (spell_types & AIspells[i].type) {
+			candidates.indexes.push_back(static_cast<uint8>(i));
+		}
+	}
+
+	ai_spell_candidates.push_back(std::move(candidates));
+
+	return ai_spell_candidates.back().indexes;
+}
+
 bool NPC::AIDoSpellCast(uint8 i, Mob* tar, int32 mana_cost, uint32* oDontDoAgainBefore) {
 #if MobAI_DEBUG_Spells >= 1
 	LogAI("Mob::AIDoSpellCast: spellid = [{}], tar = [{}], mana = [{}], Name: [{}]", AIspells[i].spellid, tar->GetName(), mana_cost, spells[AIspells[i].spellid].name);
@@ -1399,6 +1415,7 @@ void Mob::AI_Process() {
 			}
 		}
 		else if (zone->CanDoCombat() && CastToNPC()->WillAggroNPCs() && AI_scan_area_timer->Check()) {
+			ZoneBenchmark::Stage stage(ZoneBenchmark::StageAggroScan);
 
 			/**
 			 * NPC to NPC aggro (npc_aggro flag set)
@@ -2483,8 +2500,7 @@ void NPC::CheckSignal() {
 	if (!signal_q.empty()) {
 		int signal_id = signal_q.front();
 		signal_q.pop_front();
-		std::string buf = fmt::format("{}", signal_id);
-		parse->EventNPC(EVENT_SIGNAL, this, nullptr, buf.c_str(), 0);
+		parse->EventNPC(EVENT_SIGNAL, this, nullptr, std::to_string(signal_id), 0);
 	}
 }
 
@@ -2521,6 +2537,7 @@ bool NPC::AI_AddNPCSpells(uint32 iDBSpellsID) {
 	// ok, this function should load the list, and the parent list then shove them into the struct and sort
 	npc_spells_id = iDBSpellsID;
 	AIspells.clear();
+	InvalidateAISpellCandidates();
 	if (iDBSpellsID == 0) {
 		AIautocastspell_timer->Disable();
 		return false;
@@ -2653,6 +2670,7 @@ bool NPC::AI_AddNPCSpells(uint32 iDBSpellsID) {
 	std::sort(AIspells.begin(), AIspells.end(), [](const AISpells_Struct& a, const AISpells_Struct& b) {
 		return a.priority > b.priority;
 	});
+	InvalidateAISpellCandidates();
 
 	if (IsValidSpell(attack_proc_spell)) {
 		AddProcToWeapon(attack_proc_spell, true, proc_chance);
@@ -2813,7 +2831,29 @@ void NPC::AddSpellToNPCList(int16 iPriority, uint16 iSpellID, uint32 iType,
 	t.min_hp = min_hp;
 	t.max_hp = max_hp;
 
+	// manacost has special values, -1 is no mana cost, -2 is instant cast (no mana)
+	t.resolved_mana_cost = iManaCost;
+	if (iManaCost == -1)
+		t.resolved_mana_cost = spells[iSpellID].mana;
+	else if (iManaCost == -2)
+		t.resolved_mana_cost = 0;
+
+	// this is ugly -- ignore distance for hatelist spells, looks like the client is only checking distance for some targettypes in CastSpell,
+	// should probably match that eventually. This should be good enough for now I guess ....
+	const auto &spell = spells[iSpellID];
+	if (spell.target_type == ST_HateList || spell.target_type == ST_AETargetHateList) {
+		t.range_squared = std::numeric_limits<float>::max();
+	}
+	else if (spell.target_type == ST_AECaster || spell.target_type == ST_AEBard || spell.target_type == ST_AEClientV1) {
+		// note: I think this check is actually wrong and we should be checking range instead in all cases, BUT if range is 0, range check is skipped? Works for now
+		t.range_squared = std::max(spell.aoe_range * spell.aoe_range, spell.range * spell.range);
+	}
+	else {
+		t.range_squared = spell.range * spell.range;
+	}
+
 	AIspells.push_back(t);
+	InvalidateAISpellCandidates();
 
 	// If we're going from an empty list, we need to start the timer
 	if (AIspells.size() == 1)
@@ -2832,6 +2872,8 @@ void NPC::RemoveSpellFromNPCList(uint16 spell_id)
 		}
 		++iter;
 	}
+
+	InvalidateAISpellCandidates();
 }
 
 void NPC::AISpellsList(Client *c)
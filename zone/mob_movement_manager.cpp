@@ -11,6 +11,9 @@
 #include <vector>
 #include <deque>
 #include <map>
+#include <unordered_map>
+#include <algorithm>
+#include <string.h>
 #include <stdlib.h>
 
 extern double frame_time;
@@ -624,6 +627,23 @@ struct MovementStats {
 		TotalSentMovement = 0ULL;
 		TotalSentPosition = 0ULL;
 		TotalSentHeading  = 0ULL;
+		TotalCoalesced    = 0ULL;
+		TotalDeferred     = 0ULL;
+	}
+
+	void CountSent(int anim, float delta_heading)
+	{
+		TotalSent++;
+
+		if (anim != 0) {
+			TotalSentMovement++;
+		}
+		else if (delta_heading != 0) {
+			TotalSentHeading++;
+		}
+		else {
+			TotalSentPosition++;
+		}
 	}
 
 	double   LastResetTime;
@@ -631,8 +651,58 @@ struct MovementStats {
 	uint64_t TotalSentMovement;
 	uint64_t TotalSentPosition;
 	uint64_t TotalSentHeading;
+	uint64_t TotalCoalesced;
+	uint64_t TotalDeferred;
+};
+
+enum MovementBand : int {
+	MovementBandClose  = 0,
+	MovementBandMedium = 1,
+	MovementBandLong   = 2
+};
+
+/**
+ * Latest movement update queued for one client about one mob, a newer update replaces
+ * it until it goes out
+ */
+struct MovementInterestEntry {
+	PlayerPositionUpdateServer_Struct Update;
+	uint32                            LastSent;
+	float                             Distance;
+	int                               Band;
+	int                               Anim;
+	float                             DeltaHeading;
+	bool                              Priority;
+	bool                              Queued;
+};
+
+struct MovementInterest {
+	std::unordered_map<Mob *, MovementInterestEntry> Entries;
+	std::vector<Mob *>                               Queue;
 };
 
+/**
+ * Takes a queued update back out of the client's queue, an entry is in Queue exactly while Queued is set
+ *
+ * @param interest
+ * @param mob
+ */
+static void UnqueueMovementInterest(MovementInterest &interest, Mob *mob)
+{
+	auto entry = interest.Entries.find(mob);
+	if (entry == interest.Entries.end() || !entry->second.Queued) {
+		return;
+	}
+
+	entry->second.Queued = false;
+
+	auto queued = std::find(interest.Queue.begin(), interest.Queue.end(), mob);
+	if (queued != interest.Queue.end()) {
+		*queued = interest.Queue.back();
+		interest.Queue.pop_back();
+	}
+}
+
 struct NavigateTo {
 	NavigateTo()
 	{
@@ -674,9 +744,11 @@ void AdjustRoute(std::list<IPathfinder::IPathNode> &nodes, Mob *who)
 }
 
 struct MobMovementManager::Implementation {
-	std::map<Mob *, MobMovementEntry> Entries;
-	std::vector<Client *>             Clients;
-	MovementStats                     Stats;
+	std::map<Mob *, MobMovementEntry>                      Entries;
+	std::vector<Client *>                                  Clients;
+	std::unordered_map<Client *, MovementInterest>         Interest;
+	std::vector<std::pair<Mob *, MovementInterestEntry *>> Flush;
+	MovementStats                                          Stats;
 };
 
 MobMovementManager::MobMovementManager()
@@ -705,6 +777,8 @@ void MobMovementManager::Process()
 			commands.pop_front();
 		}
 	}
+
+	FlushMovementInterest();
 }
 
 /**
@@ -721,6 +795,11 @@ void MobMovementManager::AddMob(Mob *mob)
 void MobMovementManager::RemoveMob(Mob *mob)
 {
 	_impl->Entries.erase(mob);
+
+	for (auto &interest : _impl->Interest) {
+		UnqueueMovementInterest(interest.second, mob);
+		interest.second.Entries.erase(mob);
+	}
 }
 
 /**
@@ -729,6 +808,7 @@ void MobMovementManager::RemoveMob(Mob *mob)
 void MobMovementManager::AddClient(Client *client)
 {
 	_impl->Clients.push_back(client);
+	_impl->Interest[client];
 }
 
 /**
@@ -736,6 +816,8 @@ void MobMovementManager::AddClient(Client *client)
  */
 void MobMovementManager::RemoveClient(Client *client)
 {
+	_impl->Interest.erase(client);
+
 	auto iter = _impl->Clients.begin();
 	while (iter != _impl->Clients.end()) {
 		if (client == *iter) {
@@ -893,22 +975,12 @@ void MobMovementManager::SendCommandToClients(
 				continue;
 			}
 
-			_impl->Stats.TotalSent++;
-
-			if (anim != 0) {
-				_impl->Stats.TotalSentMovement++;
-			}
-			else if (delta_heading != 0) {
-				_impl->Stats.TotalSentHeading++;
-			}
-			else {
-				_impl->Stats.TotalSentPosition++;
-			}
-
+			DropQueuedUpdate(c, mob);
+			_impl->Stats.CountSent(anim, delta_heading);
 			c->QueuePacket(&outapp, false);
 		}
 	}
-	else {
+	else if (single_client || !RuleB(Pathing, MovementUpdateInterest)) {
 		float short_range = RuleR(Pathing, ShortMovementUpdateRange);
 		float long_range  = zone->GetNpcPositionUpdateDistance();
 
@@ -943,19 +1015,185 @@ void MobMovementManager::SendCommandToClients(
 			}
 
 			if (match) {
-				_impl->Stats.TotalSent++;
+				DropQueuedUpdate(c, mob);
+				_impl->Stats.CountSent(anim, delta_heading);
+				c->QueuePacket(&outapp, false);
+			}
+		}
+	}
+	else {
+		float short_range = RuleR(Pathing, ShortMovementUpdateRange);
+		float long_range  = static_cast<float>(zone->GetNpcPositionUpdateDistance());
+		float short_range_squared = short_range * short_range;
+		float long_range_squared  = long_range * long_range;
 
-				if (anim != 0) {
-					_impl->Stats.TotalSentMovement++;
-				}
-				else if (delta_heading != 0) {
-					_impl->Stats.TotalSentHeading++;
+		auto queue_update = [&](Client *c) {
+			if (ignore_client && c == ignore_client) {
+				return;
+			}
+
+			auto interest = _impl->Interest.find(c);
+			if (interest == _impl->Interest.end()) {
+				return;
+			}
+
+			float distance = DistanceSquared(c->GetPosition(), mob->GetPosition());
+
+			int band = MovementBandLong;
+			if (distance < short_range_squared) {
+				band = MovementBandClose;
+			}
+			else if (distance < long_range_squared) {
+				band = MovementBandMedium;
+			}
+
+			// ClientRangeClose, ClientRangeMedium and ClientRangeLong in band order
+			if (!(range & (1 << band))) {
+				return;
+			}
+
+			auto &entry = interest->second.Entries[mob];
+
+			// a mob coming to a stop is never held back, the client would keep it walking in place
+			if (anim == 0) {
+				UnqueueMovementInterest(interest->second, mob);
+				entry.LastSent = Timer::GetCurrentTime();
+				_impl->Stats.CountSent(anim, delta_heading);
+				c->QueuePacket(&outapp, false);
+				return;
+			}
+
+			if (entry.Queued) {
+				_impl->Stats.TotalCoalesced++;
+			}
+			else {
+				entry.Queued = true;
+				interest->second.Queue.push_back(mob);
+			}
+
+			entry.Update       = *spu;
+			entry.Distance     = distance;
+			entry.Band         = band;
+			entry.Anim         = anim;
+			entry.DeltaHeading = delta_heading;
+			entry.Priority     = mob->GetTarget() == c || mob->CheckAggro(c);
+		};
+
+		/**
+		 * The mob's close list already holds every client within the close scan distance, when
+		 * the medium band fits inside it there's no need to look at the rest of the zone
+		 */
+		if (!(range & ClientRangeLong) && long_range <= RuleI(Range, MobCloseScanDistance)) {
+			for (auto &e : mob->close_mobs) {
+				if (e.second->IsClient()) {
+					queue_update(e.second->CastToClient());
 				}
-				else {
-					_impl->Stats.TotalSentPosition++;
+			}
+		}
+		else {
+			for (auto &c : _impl->Clients) {
+				queue_update(c);
+			}
+		}
+	}
+}
+
+/**
+ * @param client
+ * @param mob
+ */
+void MobMovementManager::DropQueuedUpdate(Client *client, Mob *mob)
+{
+	auto interest = _impl->Interest.find(client);
+	if (interest == _impl->Interest.end()) {
+		return;
+	}
+
+	UnqueueMovementInterest(interest->second, mob);
+
+	auto entry = interest->second.Entries.find(mob);
+	if (entry != interest->second.Entries.end()) {
+		entry->second.LastSent = Timer::GetCurrentTime();
+	}
+}
+
+/**
+ * Sends each client its queued updates, updates from mobs targeting or hating the client first
+ * and then nearest first, holding back an update until its band's interval has passed since the
+ * last one for that mob and anything past the client's budget for this tick
+ */
+void MobMovementManager::FlushMovementInterest()
+{
+	uint32 now             = Timer::GetCurrentTime();
+	uint32 medium_interval = static_cast<uint32>(RuleI(Pathing, MediumMovementUpdateInterval));
+	uint32 long_interval   = static_cast<uint32>(RuleI(Pathing, LongMovementUpdateInterval));
+	int    budget          = RuleI(Pathing, MovementUpdateBudget);
+
+	EQApplicationPacket outapp(OP_ClientUpdate, sizeof(PlayerPositionUpdateServer_Struct));
+
+	auto &flush = _impl->Flush;
+	for (auto &iter : _impl->Interest) {
+		auto client    = iter.first;
+		auto &interest = iter.second;
+
+		if (interest.Queue.empty()) {
+			continue;
+		}
+
+		flush.clear();
+		for (auto mob : interest.Queue) {
+			auto entry = interest.Entries.find(mob);
+			if (entry != interest.Entries.end() && entry->second.Queued) {
+				flush.push_back(std::make_pair(mob, &entry->second));
+			}
+		}
+
+		interest.Queue.clear();
+
+		std::sort(
+			flush.begin(),
+			flush.end(),
+			[](const std::pair<Mob *, MovementInterestEntry *> &a, const std::pair<Mob *, MovementInterestEntry *> &b) {
+				if (a.second->Priority != b.second->Priority) {
+					return a.second->Priority;
 				}
 
-				c->QueuePacket(&outapp, false);
+				return a.second->Distance < b.second->Distance;
+			}
+		);
+
+		int sent = 0;
+		for (auto &f : flush) {
+			auto &entry = *f.second;
+
+			uint32 interval = 0;
+			if (entry.Band == MovementBandMedium) {
+				interval = medium_interval;
+			}
+			else if (entry.Band == MovementBandLong) {
+				interval = long_interval;
+			}
+
+			bool hold = false;
+			if (!entry.Priority) {
+				hold = (now - entry.LastSent < interval) || sent >= budget;
+			}
+
+			if (hold) {
+				_impl->Stats.TotalDeferred++;
+				interest.Queue.push_back(f.first);
+				continue;
+			}
+
+			memcpy(outapp.pBuffer, &entry.Update, sizeof(PlayerPositionUpdateServer_Struct));
+			_impl->Stats.CountSent(entry.Anim, entry.DeltaHeading);
+			client->QueuePacket(&outapp, false);
+
+			entry.Queued   = false;
+			entry.LastSent = now;
+
+			if (!entry.Priority) {
+				sent++;
 			}
 		}
 	}
@@ -1012,6 +1250,18 @@ void MobMovementManager::DumpStats(Client *client)
 		_impl->Stats.TotalSentPosition,
 		static_cast<double>(_impl->Stats.TotalSentPosition) / total_time
 	);
+	client->Message(
+		Chat::System,
+		"Total Coalesced: %llu (%.2f / sec)",
+		static_cast<unsigned long long>(_impl->Stats.TotalCoalesced),
+		static_cast<double>(_impl->Stats.TotalCoalesced) / total_time
+	);
+	client->Message(
+		Chat::System,
+		"Total Deferred: %llu (%.2f / sec)",
+		static_cast<unsigned long long>(_impl->Stats.TotalDeferred),
+		static_cast<double>(_impl->Stats.TotalDeferred) / total_time
+	);
 }
 
 void MobMovementManager::ClearStats()
@@ -1021,6 +1271,8 @@ void MobMovementManager::ClearStats()
 	_impl->Stats.TotalSentHeading  = 0;
 	_impl->Stats.TotalSentMovement = 0;
 	_impl->Stats.TotalSentPosition = 0;
+	_impl->Stats.TotalCoalesced    = 0;
+	_impl->Stats.TotalDeferred     = 0;
 }
 
 /**
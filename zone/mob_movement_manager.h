@@ -77,6 +77,8 @@ private:
 	MobMovementManager(const MobMovementManager&);
 	MobMovementManager& operator=(const MobMovementManager&);
 
+	void DropQueuedUpdate(Client *client, Mob *mob);
+	void FlushMovementInterest();
 	void FillCommandStruct(PlayerPositionUpdateServer_Struct *position_update, Mob *mob, float delta_x, float delta_y, float delta_z, float delta_heading, int anim);
 	void UpdatePath(Mob *who, float x, float y, float z, MobMovementMode mob_movement_mode);
 	void UpdatePathGround(Mob *who, float x, float y, float z, MobMovementMode mode);
@@ -0,0 +1,249 @@
+#include "mob_position_table.h"
+#include "mob.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MOB_POSITION_TABLE_SSE2
+#include <emmintrin.h>
+#endif
+
+static uint8 GetMobPositionFlags(Mob *mob)
+{
+	uint8 flags = 0;
+
+	if (mob->IsClient()) {
+		flags |= MobPositionTable::FlagClient;
+	}
+
+	if (mob->IsNPC()) {
+		flags |= MobPositionTable::FlagNPC;
+	}
+
+	if (mob->IsMerc()) {
+		flags |= MobPositionTable::FlagMerc;
+	}
+
+	if (mob->IsBot()) {
+		flags |= MobPositionTable::FlagBot;
+	}
+
+	if (mob->IsCorpse()) {
+		flags |= MobPositionTable::FlagCorpse;
+	}
+
+	return flags;
+}
+
+void MobPositionTable::Add(Mob *mob)
+{
+	uint16 id = mob->GetID();
+	if (id == 0) {
+		return;
+	}
+
+	if (id >= m_slots.size()) {
+		m_slots.resize(id + 1, -1);
+	}
+
+	if (m_slots[id] >= 0) {
+		Remove(id);
+	}
+
+	m_slots[id] = static_cast<int32>(m_mobs.size());
+
+	m_x.push_back(0.0f);
+	m_y.push_back(0.0f);
+	m_z.push_back(0.0f);
+	m_size.push_back(0.0f);
+	m_aggro_range.push_back(0.0f);
+	m_flags.push_back(GetMobPositionFlags(mob));
+	m_mobs.push_back(mob);
+	m_ids.push_back(id);
+
+	Update(mob);
+}
+
+void MobPositionTable::Remove(uint16 entity_id)
+{
+	if (entity_id >= m_slots.size() || m_slots[entity_id] < 0) {
+		return;
+	}
+
+	size_t slot = static_cast<size_t>(m_slots[entity_id]);
+	size_t last = m_mobs.size() - 1;
+
+	if (slot != last) {
+		m_x[slot]           = m_x[last];
+		m_y[slot]           = m_y[last];
+		m_z[slot]           = m_z[last];
+		m_size[slot]        = m_size[last];
+		m_aggro_range[slot] = m_aggro_range[last];
+		m_flags[slot]       = m_flags[last];
+		m_mobs[slot]        = m_mobs[last];
+		m_ids[slot]         = m_ids[last];
+
+		m_slots[m_ids[slot]] = static_cast<int32>(slot);
+	}
+
+	m_x.pop_back();
+	m_y.pop_back();
+	m_z.pop_back();
+	m_size.pop_back();
+	m_aggro_range.pop_back();
+	m_flags.pop_back();
+	m_mobs.pop_back();
+	m_ids.pop_back();
+
+	m_slots[entity_id] = -1;
+}
+
+void MobPositionTable::Clear()
+{
+	m_x.clear();
+	m_y.clear();
+	m_z.clear();
+	m_size.clear();
+	m_aggro_range.clear();
+	m_flags.clear();
+	m_mobs.clear();
+	m_ids.clear();
+	m_slots.clear();
+}
+
+void MobPositionTable::Update(Mob *mob)
+{
+	uint16 id = mob->GetID();
+	if (id >= m_slots.size() || m_slots[id] < 0) {
+		return;
+	}
+
+	size_t slot = static_cast<size_t>(m_slots[id]);
+	if (m_mobs[slot] != mob) {
+		return;
+	}
+
+	m_x[slot]           = mob->GetX();
+	m_y[slot]           = mob->GetY();
+	m_z[slot]           = mob->GetZ();
+	m_size[slot]        = mob->GetSize();
+	m_aggro_range[slot] = mob->GetAggroRange();
+}
+
+void MobPositionTable::QueryRange(
+	float center_x,
+	float center_y,
+	float center_z,
+	float range_squared,
+	uint8 require_flags,
+	uint8 exclude_flags,
+	float aggro_range_at,
+	std::vector<Mob *> &out
+) const
+{
+	size_t count = m_mobs.size();
+	size_t i     = 0;
+
+	// mobs with no aggro range never pass, keeps the aggro test branch free
+	bool  check_aggro = aggro_range_at >= 0.0f;
+	float aggro_at    = check_aggro ? aggro_range_at : 0.0f;
+
+#ifdef MOB_POSITION_TABLE_SSE2
+	const __m128 cx    = _mm_set1_ps(center_x);
+	const __m128 cy    = _mm_set1_ps(center_y);
+	const __m128 cz    = _mm_set1_ps(center_z);
+	const __m128 range = _mm_set1_ps(range_squared);
+	const __m128 aggro = _mm_set1_ps(aggro_at);
+
+	for (; i + 4 <= count; i += 4) {
+		__m128 dx = _mm_sub_ps(_mm_loadu_ps(&m_x[i]), cx);
+		__m128 dy = _mm_sub_ps(_mm_loadu_ps(&m_y[i]), cy);
+		__m128 dz = _mm_sub_ps(_mm_loadu_ps(&m_z[i]), cz);
+
+		__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+		__m128 hit      = _mm_cmple_ps(distance, range);
+
+		if (check_aggro) {
+			hit = _mm_or_ps(hit, _mm_cmpge_ps(_mm_loadu_ps(&m_aggro_range[i]), aggro));
+		}
+
+		int mask = _mm_movemask_ps(hit);
+		while (mask) {
+			int lane = 0;
+			while (!(mask & (1 << lane))) {
+				++lane;
+			}
+
+			Emit(i + lane, require_flags, exclude_flags, out);
+			mask &= mask - 1;
+		}
+	}
+#endif
+
+	for (; i < count; ++i) {
+		float dx = m_x[i] - center_x;
+		float dy = m_y[i] - center_y;
+		float dz = m_z[i] - center_z;
+
+		if (dx * dx + dy * dy + dz * dz <= range_squared || (check_aggro && m_aggro_range[i] >= aggro_at)) {
+			Emit(i, require_flags, exclude_flags, out);
+		}
+	}
+}
+
+void MobPositionTable::QueryCylinder(
+	float center_x,
+	float center_y,
+	float center_z,
+	float min_range_squared,
+	float max_range_squared,
+	float height_squared,
+	uint8 require_flags,
+	uint8 exclude_flags,
+	std::vector<Mob *> &out
+) const
+{
+	size_t count = m_mobs.size();
+	size_t i     = 0;
+
+#ifdef MOB_POSITION_TABLE_SSE2
+	const __m128 cx        = _mm_set1_ps(center_x);
+	const __m128 cy        = _mm_set1_ps(center_y);
+	const __m128 cz        = _mm_set1_ps(center_z);
+	const __m128 min_range = _mm_set1_ps(min_range_squared);
+	const __m128 max_range = _mm_set1_ps(max_range_squared);
+	const __m128 height    = _mm_set1_ps(height_squared);
+
+	for (; i + 4 <= count; i += 4) {
+		__m128 dx = _mm_sub_ps(_mm_loadu_ps(&m_x[i]), cx);
+		__m128 dy = _mm_sub_ps(_mm_loadu_ps(&m_y[i]), cy);
+		__m128 dz = _mm_sub_ps(_mm_loadu_ps(&m_z[i]), cz);
+
+		__m128 planar = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+		__m128 hit    = _mm_and_ps(
+			_mm_and_ps(_mm_cmple_ps(planar, max_range), _mm_cmpge_ps(planar, min_range)),
+			_mm_cmple_ps(_mm_mul_ps(dz, dz), height)
+		);
+
+		int mask = _mm_movemask_ps(hit);
+		while (mask) {
+			int lane = 0;
+			while (!(mask & (1 << lane))) {
+				++lane;
+			}
+
+			Emit(i + lane, require_flags, exclude_flags, out);
+			mask &= mask - 1;
+		}
+	}
+#endif
+
+	for (; i < count; ++i) {
+		float dx     = m_x[i] - center_x;
+		float dy     = m_y[i] - center_y;
+		float dz     = m_z[i] - center_z;
+		float planar = dx * dx + dy * dy;
+
+		if (planar <= max_range_squared && planar >= min_range_squared && dz * dz <= height_squared) {
+			Emit(i, require_flags, exclude_flags, out);
+		}
+	}
+}
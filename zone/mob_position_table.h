@@ -0,0 +1,117 @@
+#ifndef EQEMU_MOB_POSITION_TABLE_H
+#define EQEMU_MOB_POSITION_TABLE_H
+
+#include "../common/types.h"
+#include <cstddef>
+#include <vector>
+
+class Mob;
+
+/**
+ * Packed copy of every mob's position, size, aggro range and type flags
+ *
+ * Mob objects are several kilobytes each, so a zone wide distance loop over mob_list misses cache on
+ * every element. This keeps the few fields those loops read in parallel arrays (structure of arrays)
+ * owned by the entity list, so a range query streams through a handful of contiguous float columns,
+ * four entities at a time where SSE2 is available
+ *
+ * Slots are packed, removal swaps the last slot into the hole. Entity ids map to slots through a flat
+ * table since ids are 16 bit. Positions are pushed by Mob's movement setters and refreshed for every
+ * mob once per MobProcess, so a position written directly to m_Position is at most a tick stale here
+ */
+class MobPositionTable {
+public:
+	enum Flags : uint8 {
+		FlagClient = 1 << 0,
+		FlagNPC    = 1 << 1,
+		FlagMerc   = 1 << 2,
+		FlagBot    = 1 << 3,
+		FlagCorpse = 1 << 4,
+
+		// what spell pcnpc_only flags and cone targeting treat as players
+		FlagPlayerSide = FlagClient | FlagMerc | FlagBot
+	};
+
+	void Add(Mob *mob);
+	void Remove(uint16 entity_id);
+	void Clear();
+
+	/**
+	 * Refreshes a mob's row, does nothing for mobs not in the table
+	 *
+	 * @param mob
+	 */
+	void Update(Mob *mob);
+
+	size_t Count() const { return m_mobs.size(); }
+
+	/**
+	 * Mobs within range of center (3D, squared)
+	 *
+	 * @param center_x
+	 * @param center_y
+	 * @param center_z
+	 * @param range_squared
+	 * @param require_flags a mob must have one of these, 0 for any
+	 * @param exclude_flags a mob must have none of these
+	 * @param aggro_range_at when >= 0 also returns mobs with an aggro range at least this large
+	 * @param out appended to
+	 */
+	void QueryRange(
+		float center_x,
+		float center_y,
+		float center_z,
+		float range_squared,
+		uint8 require_flags,
+		uint8 exclude_flags,
+		float aggro_range_at,
+		std::vector<Mob *> &out
+	) const;
+
+	/**
+	 * Mobs in a vertical ring around center: min to max range on the x/y plane (squared) and within
+	 * height on z (squared)
+	 *
+	 * @param center_x
+	 * @param center_y
+	 * @param center_z
+	 * @param min_range_squared
+	 * @param max_range_squared
+	 * @param height_squared
+	 * @param require_flags a mob must have one of these, 0 for any
+	 * @param exclude_flags a mob must have none of these
+	 * @param out appended to
+	 */
+	void QueryCylinder(
+		float center_x,
+		float center_y,
+		float center_z,
+		float min_range_squared,
+		float max_range_squared,
+		float height_squared,
+		uint8 require_flags,
+		uint8 exclude_flags,
+		std::vector<Mob *> &out
+	) const;
+
+private:
+	void Emit(size_t slot, uint8 require_flags, uint8 exclude_flags, std::vector<Mob *> &out) const
+	{
+		uint8 flags = m_flags[slot];
+		if ((require_flags == 0 || (flags & require_flags)) && !(flags & exclude_flags)) {
+			out.push_back(m_mobs[slot]);
+		}
+	}
+
+	std::vector<float>  m_x;
+	std::vector<float>  m_y;
+	std::vector<float>  m_z;
+	std::vector<float>  m_size;
+	std::vector<float>  m_aggro_range;
+	std::vector<uint8>  m_flags;
+	std::vector<Mob *>  m_mobs;
+	std::vector<uint16> m_ids;
+	std::vector<int32>  m_slots; // entity id -> slot, -1 when absent
+};
+
+#endif //EQEMU_MOB_POSITION_TABLE_H
@@ -35,6 +35,7 @@
 #include "client.h"
 #include "entity.h"
 #include "npc.h"
+#include "zone_benchmark.h"
 #include "string_ids.h"
 #include "spawn2.h"
 #include "zone.h"
@@ -872,7 +873,10 @@ bool NPC::Process()
 
 	if (tic_timer.Check()) {
 		parse->EventNPC(EVENT_TICK, this, nullptr, "", 0);
-		BuffProcess();
+		{
+			ZoneBenchmark::Stage stage(ZoneBenchmark::StageBuffs);
+			BuffProcess();
+		}
 
 		if (currently_fleeing) {
 			ProcessFlee();
@@ -1036,7 +1040,10 @@ bool NPC::Process()
 		}
 	}
 
-	AI_Process();
+	{
+		ZoneBenchmark::Stage stage(ZoneBenchmark::StageAI);
+		AI_Process();
+	}
 
 	return true;
 }
@@ -66,6 +66,8 @@ struct AISpells_Struct {
 	int16	resist_adjust;
 	int8	min_hp; // >0 won't cast if HP is below
 	int8	max_hp; // >0 won't cast if HP is above
+	int32	resolved_mana_cost; // manacost with -1 / -2 applied
+	float	range_squared; // how close the target must be, unlimited for hate list spells
 };
 
 struct AISpellsEffects_Struct {
@@ -569,6 +571,17 @@ protected:
 	uint32*	pDontCastBefore_casting_spell;
 	std::vector<AISpells_Struct> AIspells;
 	bool HasAISpell;
+
+	// AIspells indexes (highest first) that can ever match an AICastSpell type mask, built on first use
+	struct AISpellCandidates {
+		uint32             spell_types;
+		bool               innates;
+		std::vector<uint8> indexes;
+	};
+	std::vector<AISpellCandidates> ai_spell_candidates;
+	const std::vector<uint8> &GetAISpellCandidates(uint32 spell_types, bool innates);
+	inline void InvalidateAISpellCandidates() { ai_spell_candidates.clear(); }
+
 	virtual bool AICastSpell(Mob* tar, uint8 iChance, uint32 iSpellTypes, bool bInnates = false);
 	virtual bool AIDoSpellCast(uint8 i, Mob* tar, int32 mana_cost, uint32* oDontDoAgainBefore = 0);
 	AISpellsVar_Struct AISpellVar;
@@ -7,132 +7,92 @@
 void QGlobalCache::AddGlobal(uint32 id, QGlobal global)
 {
 	global.id = id;
-	qGlobalBucket.push_back(global);
-}
 
-void QGlobalCache::RemoveGlobal(std::string name, uint32 npcID, uint32 charID, uint32 zoneID)
-{
-	auto iter = qGlobalBucket.begin();
-	while(iter != qGlobalBucket.end())
-	{
-		if(name.compare((*iter).name) == 0)
-		{
-			if((npcID == (*iter).npc_id || (*iter).npc_id == 0) &&
-				(charID == (*iter).char_id || (*iter).char_id == 0) &&
-				(zoneID == (*iter).zone_id || (*iter).zone_id == 0))
-			{
-				qGlobalBucket.erase(iter);
-				return;
-			}
+	//a global is unique per name and scope, so a re-add replaces the old value in place
+	auto &slot = qGlobalIndex[global.name];
+	for (auto &cur : slot) {
+		if (cur.npc_id == global.npc_id && cur.char_id == global.char_id && cur.zone_id == global.zone_id) {
+			cur = std::move(global);
+			return;
 		}
-		++iter;
 	}
-}
 
-void QGlobalCache::Combine(std::list<QGlobal> &cacheA, std::list<QGlobal> cacheB, uint32 npcID, uint32 charID, uint32 zoneID)
-{
-	auto iter = cacheB.begin();
-	while(iter != cacheB.end())
-	{
-		QGlobal cur = (*iter);
-
-		if((cur.npc_id == npcID || cur.npc_id == 0) && (cur.char_id == charID || cur.char_id == 0) &&
-			(cur.zone_id == zoneID || cur.zone_id == 0))
-		{
-			if(Timer::GetTimeSeconds() < cur.expdate)
-			{
-				cacheA.push_back(cur);
-			}
-		}
-		++iter;
-	}
+	slot.push_back(std::move(global));
+	++qGlobalCount;
 }
 
-void QGlobalCache::GetQGlobals(std::list<QGlobal> &globals, NPC *n, Client *c, Zone *z) {
-	globals.clear();
-
-	QGlobalCache *npc_c = nullptr;
-	QGlobalCache *char_c = nullptr;
-	QGlobalCache *zone_c = nullptr;
-	uint32 npc_id = 0;
-	uint32 char_id = 0;
-	uint32 zone_id = 0;
-
-	if(n) {
-		npc_id = n->GetNPCTypeID();
-		npc_c = n->GetQGlobals();
-	}
-
-	if(c) {
-		char_id = c->CharacterID();
-		char_c = c->GetQGlobals();
-	}
-
-	if(z) {
-		zone_id = z->GetZoneID();
-		zone_c = z->GetQGlobals();
-	}
-
-	if(!npc_c && n) {
-		npc_c = n->CreateQGlobals();
-		npc_c->LoadByNPCID(npc_id);
-	}
-
-	if(!char_c && c) {
-		char_c = c->CreateQGlobals();
-		char_c->LoadByCharID(char_id);
-	}
-
-	if(!zone_c && z) {
-		zone_c = z->CreateQGlobals();
-		zone_c->LoadByZoneID(zone_id);
-		zone_c->LoadByGlobalContext();
-	}
-
-	if(npc_c) {
-		QGlobalCache::Combine(globals, npc_c->GetBucket(), npc_id, char_id, zone_id);
-	}
+void QGlobalCache::RemoveGlobal(const std::string &name, uint32 npcID, uint32 charID, uint32 zoneID)
+{
+	auto slot = qGlobalIndex.find(name);
+	if (slot == qGlobalIndex.end())
+		return;
 
-	if(char_c) {
-		QGlobalCache::Combine(globals, char_c->GetBucket(), npc_id, char_id, zone_id);
+	auto &entries = slot->second;
+	for (auto iter = entries.begin(); iter != entries.end(); ++iter) {
+		if (iter->AppliesTo(npcID, charID, zoneID)) {
+			entries.erase(iter);
+			--qGlobalCount;
+			break;
+		}
 	}
 
-	if(zone_c) {
-		QGlobalCache::Combine(globals, zone_c->GetBucket(), npc_id, char_id, zone_id);
-	}
+	if (entries.empty())
+		qGlobalIndex.erase(slot);
 }
 
-bool QGlobalCache::GetQGlobal(QGlobal &g, std::string name, NPC *n, Client *c, Zone *z) {
-	std::list<QGlobal> globals;
-	QGlobalCache::GetQGlobals(globals, n, c, z);
-
-	auto iter = globals.begin();
-	while(iter != globals.end()) {
-		if(iter->name.compare(name) == 0) {
-			g = (*iter);
-			return true;
+const QGlobal *QGlobalCache::FindGlobal(const std::string &name, uint32 npcID, uint32 charID, uint32 zoneID)
+{
+	auto slot = qGlobalIndex.find(name);
+	if (slot == qGlobalIndex.end())
+		return nullptr;
+
+	uint32 now = Timer::GetTimeSeconds();
+	auto &entries = slot->second;
+	auto iter = entries.begin();
+	while (iter != entries.end()) {
+		if (iter->IsExpired(now)) {
+			iter = entries.erase(iter);
+			--qGlobalCount;
+			continue;
 		}
+
+		if (iter->AppliesTo(npcID, charID, zoneID))
+			return &(*iter);
+
 		++iter;
 	}
 
-	return false;
+	if (entries.empty())
+		qGlobalIndex.erase(slot);
+
+	return nullptr;
 }
 
 void QGlobalCache::PurgeExpiredGlobals()
 {
-	if(!qGlobalBucket.size())
+	if(!qGlobalCount)
 		return;
 
-	auto iter = qGlobalBucket.begin();
-	while(iter != qGlobalBucket.end())
+	uint32 now = Timer::GetTimeSeconds();
+	auto slot = qGlobalIndex.begin();
+	while(slot != qGlobalIndex.end())
 	{
-		QGlobal cur = (*iter);
-		if(Timer::GetTimeSeconds() > cur.expdate)
-		{
-			iter = qGlobalBucket.erase(iter);
+		auto &entries = slot->second;
+		auto iter = entries.begin();
+		while (iter != entries.end()) {
+			if (now > iter->expdate) {
+				iter = entries.erase(iter);
+				--qGlobalCount;
+				continue;
+			}
+			++iter;
+		}
+
+		if (entries.empty()) {
+			slot = qGlobalIndex.erase(slot);
 			continue;
 		}
-		++iter;
+		++slot;
 	}
 }
 
@@ -173,3 +133,49 @@ void QGlobalCache::LoadBy(const std::string &query)
 	for (auto row = results.begin(); row != results.end(); ++row)
 		AddGlobal(0, QGlobal(row[0], atoi(row[1]), atoi(row[2]), atoi(row[3]), row[4], row[5] ? atoi(row[5]) : 0xFFFFFFFF));
 }
+
+QGlobalView::QGlobalView(NPC *n, Client *c, Zone *z)
+	: caches{ nullptr, nullptr, nullptr }, npc_id(0), char_id(0), zone_id(0)
+{
+	if(n) {
+		npc_id = n->GetNPCTypeID();
+		caches[0] = n->GetQGlobals();
+		if(!caches[0]) {
+			caches[0] = n->CreateQGlobals();
+			caches[0]->LoadByNPCID(npc_id);
+		}
+	}
+
+	if(c) {
+		char_id = c->CharacterID();
+		caches[1] = c->GetQGlobals();
+		if(!caches[1]) {
+			caches[1] = c->CreateQGlobals();
+			caches[1]->LoadByCharID(char_id);
+		}
+	}
+
+	if(z) {
+		zone_id = z->GetZoneID();
+		caches[2] = z->GetQGlobals();
+		if(!caches[2]) {
+			caches[2] = z->CreateQGlobals();
+			caches[2]->LoadByZoneID(zone_id);
+			caches[2]->LoadByGlobalContext();
+		}
+	}
+}
+
+const QGlobal *QGlobalView::Find(const std::string &name) const
+{
+	for (auto cache : caches) {
+		if (!cache)
+			continue;
+
+		auto global = cache->FindGlobal(name, npc_id, char_id, zone_id);
+		if (global)
+			return global;
+	}
+
+	return nullptr;
+}
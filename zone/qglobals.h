@@ -2,6 +2,11 @@
 #define __QGLOBALS__H
 
 #include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../common/timer.h"
 
 class NPC;
 class Client;
@@ -19,19 +24,45 @@ struct QGlobal
 	std::string value;
 	uint32 expdate;
 	uint32 id;
+
+	//a stored id of 0 is a wildcard for that scope
+	bool AppliesTo(uint32 npcID, uint32 charID, uint32 zoneID) const
+	{
+		return (npc_id == npcID || npc_id == 0) && (char_id == charID || char_id == 0) &&
+			(zone_id == zoneID || zone_id == 0);
+	}
+	bool IsExpired(uint32 now) const { return now >= expdate; }
 };
 
+/*
+	Globals are indexed by name; each name holds the handful of (npc, char, zone) scoped
+	entries that share it. Expired entries are skipped on read and dropped when a lookup
+	runs into them, PurgeExpiredGlobals still sweeps the rest on the zone purge timer.
+*/
 class QGlobalCache
 {
 public:
 	void AddGlobal(uint32 id, QGlobal global);
-	void RemoveGlobal(std::string name, uint32 npcID, uint32 charID, uint32 zoneID);
-	std::list<QGlobal> GetBucket() { return qGlobalBucket; }
+	void RemoveGlobal(const std::string &name, uint32 npcID, uint32 charID, uint32 zoneID);
+
+	//returns the first live global with this name that applies to the scope, or nullptr
+	const QGlobal *FindGlobal(const std::string &name, uint32 npcID, uint32 charID, uint32 zoneID);
+
+	//visits every live global that applies to the scope in place
+	template<typename Visitor>
+	void ForEachGlobal(uint32 npcID, uint32 charID, uint32 zoneID, Visitor visit) const
+	{
+		uint32 now = Timer::GetTimeSeconds();
+		for (auto &slot : qGlobalIndex) {
+			for (auto &global : slot.second) {
+				if (global.AppliesTo(npcID, charID, zoneID) && !global.IsExpired(now)) {
+					visit(global);
+				}
+			}
+		}
+	}
 
-	//assumes cacheA is already a valid or empty list and doesn't check for valid items.
-	static void Combine(std::list<QGlobal> &cacheA, std::list<QGlobal> cacheB, uint32 npcID, uint32 charID, uint32 zoneID);
-	static void GetQGlobals(std::list<QGlobal> &globals, NPC *n, Client *c, Zone *z);
-	static bool GetQGlobal(QGlobal &g, std::string name, NPC *n, Client *c, Zone *z);
+	size_t Count() const { return qGlobalCount; }
 
 	void PurgeExpiredGlobals();
 	void LoadByNPCID(uint32 npcID); //npc
@@ -40,7 +71,40 @@ public:
 	void LoadByGlobalContext(); //zone
 protected:
 	void LoadBy(const std::string &query);
-	std::list<QGlobal> qGlobalBucket;
+	std::unordered_map<std::string, std::vector<QGlobal>> qGlobalIndex;
+	size_t qGlobalCount = 0;
+};
+
+/*
+	The npc, char and zone caches that apply to one quest event. Missing caches are
+	loaded on construction; reads go straight to the caches without building a list.
+*/
+class QGlobalView
+{
+public:
+	QGlobalView(NPC *n, Client *c, Zone *z);
+
+	template<typename Visitor>
+	void ForEach(Visitor visit) const
+	{
+		for (auto cache : caches) {
+			if (cache) {
+				cache->ForEachGlobal(npc_id, char_id, zone_id, visit);
+			}
+		}
+	}
+
+	const QGlobal *Find(const std::string &name) const;
+
+	uint32 GetNPCID() const { return npc_id; }
+	uint32 GetCharID() const { return char_id; }
+	uint32 GetZoneID() const { return zone_id; }
+
+private:
+	QGlobalCache *caches[3];
+	uint32 npc_id;
+	uint32 char_id;
+	uint32 zone_id;
 };
 
 #endif
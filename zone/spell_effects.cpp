@@ -3660,6 +3660,12 @@ void Mob::BuffProcess()
 				{
 					--buffs[buffs_i].ticsremaining;
 
+					// stacker effects only block while the old buff doesn't have exactly one tick left,
+					// so the answer changes as the count enters 1 and again as it leaves it for 0
+					if (buffs[buffs_i].ticsremaining == 1 || buffs[buffs_i].ticsremaining == 0) {
+						InvalidateBuffStackCache();
+					}
+
 					if (buffs[buffs_i].ticsremaining < 0) {
 						LogSpells("Buff [{}] in slot [{}] has expired. Fading", buffs[buffs_i].spellid, buffs_i);
 						BuffFadeBySlot(buffs_i);
@@ -4457,7 +4463,9 @@ void Mob::BuffFadeBySlot(int slot, bool iRecalcBonuses)
 	if (spells[buffs[slot].spellid].nimbus_effect > 0)
 		RemoveNimbusEffect(spells[buffs[slot].spellid].nimbus_effect);
 
+	UnindexBuffSlot(slot);
 	buffs[slot].spellid = SPELL_UNKNOWN;
+	InvalidateBuffStackCache();
 	if(IsPet() && GetOwner() && GetOwner()->IsClient()) {
 		SendPetBuffsToClient();
 	}
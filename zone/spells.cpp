@@ -2827,6 +2827,7 @@ void Mob::BardPulse(uint16 spell_id, Mob *caster) {
 		//extend the spell if it will expire before the next pulse
 		if(buffs[buffs_i].ticsremaining <= 3) {
 			buffs[buffs_i].ticsremaining += 3;
+			InvalidateBuffStackCache();
 			LogSpells("Bard Song Pulse [{}]: extending duration in slot [{}] to [{}] tics", spell_id, buffs_i, buffs[buffs_i].ticsremaining);
 		}
 
@@ -3021,6 +3022,148 @@ int CalcBuffDuration_formula(int level, int formula, int duration)
 	return temp;
 }
 
+// buff effect index key, an effect id plus its position in the spell
+static inline uint32 BuffEffectIndexKey(int effect, int effect_index)
+{
+	return (static_cast<uint32>(effect) << 4) | static_cast<uint32>(effect_index);
+}
+
+// worn buffs with a stacking block command can stop any new spell, they are always checked
+static const uint32 buff_block_key = BuffEffectIndexKey(SE_StackingCommand_Block, 0xF);
+
+/**
+ * Adds the buff in slot to the effect index, call after a buff lands
+ *
+ * @param slot
+ */
+void Mob::IndexBuffSlot(int slot)
+{
+	UnindexBuffSlot(slot);
+
+	if (slot >= static_cast<int>(buff_index_spell.size())) {
+		buff_index_spell.resize(slot + 1, SPELL_UNKNOWN);
+	}
+
+	uint16 spell_id = buffs[slot].spellid;
+	if (!IsValidSpell(spell_id)) {
+		return;
+	}
+
+	buff_index_spell[slot] = spell_id;
+
+	for (int i = 0; i < EFFECT_COUNT; i++) {
+		if (!IsBlankSpellEffect(spell_id, i)) {
+			buff_effect_index[BuffEffectIndexKey(spells[spell_id].effect_id[i], i)].push_back(slot);
+		}
+	}
+
+	if (IsEffectInSpell(spell_id, SE_StackingCommand_Block)) {
+		buff_effect_index[buff_block_key].push_back(slot);
+	}
+}
+
+/**
+ * Removes whatever was indexed for slot, call before a buff fades
+ *
+ * @param slot
+ */
+void Mob::UnindexBuffSlot(int slot)
+{
+	if (slot < 0 || slot >= static_cast<int>(buff_index_spell.size()) || buff_index_spell[slot] == SPELL_UNKNOWN) {
+		return;
+	}
+
+	uint16 spell_id = buff_index_spell[slot];
+
+	auto unlink = [&](uint32 key) {
+		auto it = buff_effect_index.find(key);
+		if (it == buff_effect_index.end()) {
+			return;
+		}
+
+		auto &slots = it->second;
+		slots.erase(std::remove(slots.begin(), slots.end(), slot), slots.end());
+		if (slots.empty()) {
+			buff_effect_index.erase(it);
+		}
+	};
+
+	for (int i = 0; i < EFFECT_COUNT; i++) {
+		if (!IsBlankSpellEffect(spell_id, i)) {
+			unlink(BuffEffectIndexKey(spells[spell_id].effect_id[i], i));
+		}
+	}
+
+	if (IsEffectInSpell(spell_id, SE_StackingCommand_Block)) {
+		unlink(buff_block_key);
+	}
+
+	buff_index_spell[slot] = SPELL_UNKNOWN;
+}
+
+/**
+ * Marks the worn buffs CheckStackConflict can return anything but 0 for when spell_id is the new
+ * spell: the same spell, a buff with a block command, or a buff with the same effect in the same
+ * effect slot. Every other pair falls through all of its checks, so they are skipped
+ *
+ * New spells with screech, stacker or overwrite commands, a complete heal under the blocker, and
+ * slots written without going through AddBuff are always checked in full
+ *
+ * @param spell_id
+ * @param buff_count
+ * @param candidates per buff slot, true when the full stacking check has to run
+ */
+void Mob::GetBuffStackCandidates(uint16 spell_id, int buff_count, std::vector<bool> &candidates)
+{
+	bool check_all = (
+		!RuleB(Spells, UseBuffStackIndex) ||
+		IsEffectInSpell(spell_id, SE_StackingCommand_Overwrite) ||
+		IsEffectInSpell(spell_id, SE_Screech) ||
+		IsEffectInSpell(spell_id, SE_AStacker) ||
+		IsEffectInSpell(spell_id, SE_BStacker) ||
+		IsEffectInSpell(spell_id, SE_CStacker) ||
+		IsEffectInSpell(spell_id, SE_DStacker) ||
+		(spellbonuses.CompleteHealBuffBlocker && IsEffectInSpell(spell_id, SE_CompleteHeal))
+	);
+
+	candidates.assign(buff_count, check_all);
+	if (check_all) {
+		return;
+	}
+
+	for (int slot = 0; slot < buff_count; slot++) {
+		uint16 worn = buffs[slot].spellid;
+		if (worn == SPELL_UNKNOWN) {
+			continue;
+		}
+
+		if (worn == spell_id || slot >= static_cast<int>(buff_index_spell.size()) || buff_index_spell[slot] != worn) {
+			candidates[slot] = true;
+		}
+	}
+
+	auto mark = [&](uint32 key) {
+		auto it = buff_effect_index.find(key);
+		if (it == buff_effect_index.end()) {
+			return;
+		}
+
+		for (auto slot : it->second) {
+			if (slot < buff_count) {
+				candidates[slot] = true;
+			}
+		}
+	};
+
+	for (int i = 0; i < EFFECT_COUNT; i++) {
+		if (!IsBlankSpellEffect(spell_id, i)) {
+			mark(BuffEffectIndexKey(spells[spell_id].effect_id[i], i));
+		}
+	}
+
+	mark(buff_block_key);
+}
+
 // helper function for AddBuff to determine stacking
 // spellid1 is the spell already worn, spellid2 is the one trying to be cast
 // returns:
@@ -3422,10 +3565,18 @@ int Mob::AddBuff(Mob *caster, uint16 spell_id, int duration, int32 level_overrid
 	uint32 start_slot = GetFirstBuffSlot(IsDisciplineBuff(spell_id), spells[spell_id].short_buff_box);
 	uint32 end_slot = GetLastBuffSlot(IsDisciplineBuff(spell_id), spells[spell_id].short_buff_box);
 
+	std::vector<bool> stack_candidates;
+	GetBuffStackCandidates(spell_id, buff_count, stack_candidates);
+
 	for (buffslot = 0; buffslot < buff_count; buffslot++) {
 		const Buffs_Struct &curbuf = buffs[buffslot];
 
 		if (curbuf.spellid != SPELL_UNKNOWN) {
+			// nothing in common with the new spell, it stacks
+			if (!stack_candidates[buffslot]) {
+				continue;
+			}
+
 			// there's a buff in this slot
 			ret = CheckStackConflict(curbuf.spellid, curbuf.casterlevel, spell_id,
 					caster_level, entity_list.GetMobID(curbuf.casterid), caster, buffslot);
@@ -3499,6 +3650,8 @@ int Mob::AddBuff(Mob *caster, uint16 spell_id, int duration, int32 level_overrid
 	// now add buff at emptyslot
 	assert(buffs[emptyslot].spellid == SPELL_UNKNOWN);	// sanity check
 
+	InvalidateBuffStackCache();
+
 	buffs[emptyslot].spellid = spell_id;
 	buffs[emptyslot].casterlevel = caster_level;
 	if (caster && !caster->IsAura()) // maybe some other things we don't want to ...
@@ -3527,6 +3680,8 @@ int Mob::AddBuff(Mob *caster, uint16 spell_id, int duration, int32 level_overrid
 			buffs[emptyslot].UpdateClient = true;
 	}
 
+	IndexBuffSlot(emptyslot);
+
 	LogSpells("Buff [{}] added to slot [{}] with caster level [{}]", spell_id, emptyslot, caster_level);
 	if (IsPet() && GetOwner() && GetOwner()->IsClient())
 		SendPetBuffsToClient();
@@ -3566,12 +3721,33 @@ int Mob::AddBuff(Mob *caster, uint16 spell_id, int duration, int32 level_overrid
 // buff into
 // returns -1 on stack failure, -2 if all slots full, the slot number if the buff should overwrite another buff, or a free buff slot
 int Mob::CanBuffStack(uint16 spellid, uint8 caster_level, bool iFailIfOverwrite)
+{
+	// AI spell checks, bots and mercs ask this every few seconds for every spell they know, while the
+	// answer only changes when our buffs do
+	uint32 key = (static_cast<uint32>(spellid) << 9) | (static_cast<uint32>(caster_level) << 1) | (iFailIfOverwrite ? 1 : 0);
+
+	auto cached = buff_stack_cache.find(key);
+	if (cached != buff_stack_cache.end()) {
+		return cached->second;
+	}
+
+	int result = CalcBuffStack(spellid, caster_level, iFailIfOverwrite);
+	buff_stack_cache[key] = result;
+
+	return result;
+}
+
+int Mob::CalcBuffStack(uint16 spellid, uint8 caster_level, bool iFailIfOverwrite)
 {
 	int i, ret, firstfree = -2;
 
 	LogAI("Checking if buff [{}] cast at level [{}] can stack on me.[{}]", spellid, caster_level, iFailIfOverwrite?" failing if we would overwrite something":"");
 
 	int buff_count = GetMaxTotalSlots();
+
+	std::vector<bool> stack_candidates;
+	GetBuffStackCandidates(spellid, buff_count, stack_candidates);
+
 	for (i=0; i < buff_count; i++)
 	{
 		const Buffs_Struct &curbuf = buffs[i];
@@ -3588,6 +3764,9 @@ int Mob::CanBuffStack(uint16 spellid, uint8 caster_level, bool iFailIfOverwrite)
 		if(curbuf.spellid == spellid)
 			return(-1);	//do not recast a buff we already have on, we recast fast enough that we dont need to refresh our buffs
 
+		if (!stack_candidates[i])
+			continue;
+
 		// there's a buff in this slot
 		ret = CheckStackConflict(curbuf.spellid, curbuf.casterlevel, spellid, caster_level, nullptr, nullptr, i);
 		if(ret == 1) {
@@ -6183,6 +6362,7 @@ void Mob::BuffModifyDurationBySpellID(uint16 spell_id, int32 newDuration)
 		if (buffs[i].spellid == spell_id)
 		{
 			buffs[i].ticsremaining = newDuration;
+			InvalidateBuffStackCache();
 			if(IsClient())
 			{
 				CastToClient()->SendBuffDurationPacket(buffs[i], i);
@@ -586,78 +586,87 @@ bool ClientTaskState::UpdateTasksOnSpeakWith(Client *client, int npc_type_id)
 	return UpdateTasksByNPC(client, TaskActivityType::SpeakWith, npc_type_id);
 }
 
-bool ClientTaskState::UpdateTasksByNPC(Client *client, TaskActivityType activity_type, int npc_type_id)
+void ClientTaskState::FindGoalActivities(
+	TaskActivityType activity_type,
+	int goal_id,
+	std::vector<GoalActivityMatch> &into
+)
 {
+	auto goals = task_manager->GetGoalActivities(activity_type, goal_id);
+	if (goals == nullptr) {
+		return;
+	}
 
-	int is_updating = false;
+	for (auto &goal : *goals) {
+		for (int task_index = 0; task_index < MAXACTIVEQUESTS + 2; task_index++) {
+			if (m_active_tasks[task_index].task_id == goal.task_id) {
+				into.push_back({task_index, goal.task_id, goal.activity_id});
+			}
+		}
+	}
 
-	if (!HasActiveTasks()) {
+	std::sort(
+		into.begin(), into.end(), [](const GoalActivityMatch &a, const GoalActivityMatch &b) {
+			return a.task_index != b.task_index ? a.task_index < b.task_index : a.activity_id < b.activity_id;
+		}
+	);
+}
+
+bool ClientTaskState::IsGoalActivityActive(Client *client, const GoalActivityMatch &match)
+{
+	auto current_task = &m_active_tasks[match.task_index];
+	if (current_task->task_id != match.task_id) {
 		return false;
 	}
 
-	// loop over the union of tasks and quests
-	for (auto &active_task : m_active_tasks) {
-		auto current_task = &active_task;
-		if (current_task->task_id == TASKSLOTEMPTY) {
-			continue;
-		}
+	auto p_task_data = task_manager->m_task_data[match.task_id];
+	if (p_task_data == nullptr || match.activity_id >= p_task_data->activity_count) {
+		return false;
+	}
 
-		// Check if there are any active kill activities for this p_task_data
-		auto p_task_data = task_manager->m_task_data[current_task->task_id];
-		if (p_task_data == nullptr) {
-			return false;
-		}
+	// We are not interested in completed or hidden activities
+	if (current_task->activity[match.activity_id].activity_state != ActivityActive) {
+		return false;
+	}
 
-		for (int activity_id = 0; activity_id < p_task_data->activity_count; activity_id++) {
-			ClientActivityInformation *client_activity = &current_task->activity[activity_id];
-			ActivityInformation       *activity_info   = &p_task_data->activity_information[activity_id];
+	// Is there a zone restriction on the activity_information ?
+	auto activity_info = &p_task_data->activity_information[match.activity_id];
+	if (!activity_info->CheckZone(zone->GetZoneID())) {
+		LogTasks(
+			"[UPDATE] character [{}] task_id [{}] activity_id [{}] activity_type [{}] failed zone check",
+			client->GetName(),
+			match.task_id,
+			match.activity_id,
+			static_cast<int32_t>(activity_info->activity_type)
+		);
+		return false;
+	}
 
-			// We are not interested in completed or hidden activities
-			if (client_activity->activity_state != ActivityActive) {
-				continue;
-			}
-			// We are only interested in Kill activities
-			if (activity_info->activity_type != activity_type) {
-				continue;
-			}
-			// Is there a zone restriction on the activity_information ?
-			if (!activity_info->CheckZone(zone->GetZoneID())) {
-				LogTasks(
-					"[UPDATE] character [{}] task_id [{}] activity_id [{}] activity_type [{}] for NPC [{}] failed zone check",
-					client->GetName(),
-					current_task->task_id,
-					activity_id,
-					static_cast<int32_t>(activity_type),
-					npc_type_id
-				);
-				continue;
-			}
-			// Is the activity_information to kill this type of NPC ?
-			switch (activity_info->goal_method) {
-				case METHODSINGLEID:
-					if (activity_info->goal_id != npc_type_id) {
-						continue;
-					}
-					break;
+	return true;
+}
 
-				case METHODLIST:
-					if (!task_manager->m_goal_list_manager.IsInList(
-						activity_info->goal_id,
-						npc_type_id
-					)) {
-						continue;
-					}
-					break;
+bool ClientTaskState::UpdateTasksByNPC(Client *client, TaskActivityType activity_type, int npc_type_id)
+{
 
-				default:
-					// If METHODQUEST, don't updated the activity_information here
-					continue;
-			}
-			// We found an active p_task_data to kill this type of NPC, so increment the done count
-			LogTasksDetail("Calling increment done count ByNPC");
-			IncrementDoneCount(client, p_task_data, current_task->slot, activity_id);
-			is_updating = true;
+	int is_updating = false;
+
+	if (!HasActiveTasks()) {
+		return false;
+	}
+
+	std::vector<GoalActivityMatch> matches;
+	FindGoalActivities(activity_type, npc_type_id, matches);
+
+	for (auto &match : matches) {
+		if (!IsGoalActivityActive(client, match)) {
+			continue;
 		}
+
+		// We found an active p_task_data to kill this type of NPC, so increment the done count
+		LogTasksDetail("Calling increment done count ByNPC");
+		auto current_task = &m_active_tasks[match.task_index];
+		IncrementDoneCount(client, task_manager->m_task_data[match.task_id], current_task->slot, match.activity_id);
+		is_updating = true;
 	}
 
 	return is_updating;
@@ -779,65 +788,18 @@ void ClientTaskState::UpdateTasksForItem(Client *client, TaskActivityType activi
 		return;
 	}
 
-	// loop over the union of tasks and quests
-	for (auto &active_task : m_active_tasks) {
-		auto current_task = &active_task;
-		if (current_task->task_id == TASKSLOTEMPTY) {
-			continue;
-		}
+	std::vector<GoalActivityMatch> matches;
+	FindGoalActivities(activity_type, item_id, matches);
 
-		// Check if there are any active loot activities for this task
-
-		TaskInformation *p_task_data = task_manager->m_task_data[current_task->task_id];
-		if (p_task_data == nullptr) {
-			return;
+	for (auto &match : matches) {
+		if (!IsGoalActivityActive(client, match)) {
+			continue;
 		}
 
-		for (int activity_id = 0; activity_id < p_task_data->activity_count; activity_id++) {
-			ClientActivityInformation *client_activity = &current_task->activity[activity_id];
-			ActivityInformation       *activity_info   = &p_task_data->activity_information[activity_id];
-
-			// We are not interested in completed or hidden activities
-			if (client_activity->activity_state != ActivityActive) {
-				continue;
-			}
-			// We are only interested in the ActivityType we were called with
-			if (activity_info->activity_type != activity_type) {
-				continue;
-			}
-			// Is there a zone restriction on the activity_information ?
-			if (!activity_info->CheckZone(zone->GetZoneID())) {
-				LogTasks(
-					"[UpdateTasksForItem] Error: Character [{}] activity_information type [{}] for Item [{}] failed zone check",
-					client->GetName(),
-					static_cast<int32_t>(activity_type),
-					item_id
-				);
-				continue;
-			}
-			// Is the activity_information related to this item ?
-			//
-			switch (activity_info->goal_method) {
-
-				case METHODSINGLEID:
-					if (activity_info->goal_id != item_id) { continue; }
-					break;
-
-				case METHODLIST:
-					if (!task_manager->m_goal_list_manager.IsInList(
-						activity_info->goal_id,
-						item_id
-					)) { continue; }
-					break;
-
-				default:
-					// If METHODQUEST, don't updated the activity_information here
-					continue;
-			}
-			// We found an active task related to this item, so increment the done count
-			LogTasksDetail("[UpdateTasksForItem] Calling increment done count ForItem");
-			IncrementDoneCount(client, p_task_data, current_task->slot, activity_id, count);
-		}
+		// We found an active task related to this item, so increment the done count
+		LogTasksDetail("[UpdateTasksForItem] Calling increment done count ForItem");
+		auto current_task = &m_active_tasks[match.task_index];
+		IncrementDoneCount(client, task_manager->m_task_data[match.task_id], current_task->slot, match.activity_id, count);
 	}
 }
 
@@ -849,79 +811,33 @@ void ClientTaskState::UpdateTasksOnExplore(Client *client, int explore_id)
 		return;
 	}
 
-	// loop over the union of tasks and quests
-	for (auto &active_task : m_active_tasks) {
-		auto current_task = &active_task;
-		if (current_task->task_id == TASKSLOTEMPTY) {
-			continue;
-		}
-
-		// Check if there are any active explore activities for this task
+	std::vector<GoalActivityMatch> matches;
+	FindGoalActivities(TaskActivityType::Explore, explore_id, matches);
 
-		TaskInformation *task_data = task_manager->m_task_data[current_task->task_id];
-		if (task_data == nullptr) {
-			return;
+	for (auto &match : matches) {
+		if (!IsGoalActivityActive(client, match)) {
+			continue;
 		}
 
-		for (int activity_id = 0; activity_id < task_data->activity_count; activity_id++) {
-			ClientActivityInformation *client_activity = &current_task->activity[activity_id];
-			ActivityInformation       *activity_info   = &task_data->activity_information[activity_id];
-
-			// We are not interested in completed or hidden activities
-			if (client_activity->activity_state != ActivityActive) {
-				continue;
-			}
-			// We are only interested in explore activities
-			if (activity_info->activity_type != TaskActivityType::Explore) {
-				continue;
-			}
-			if (!activity_info->CheckZone(zone->GetZoneID())) {
-				LogTasks(
-					"[UpdateTasksOnExplore] character [{}] explore_id [{}] failed zone check",
-					client->GetName(),
-					explore_id
-				);
-				continue;
-			}
-			// Is the activity_information to explore this area id ?
-			switch (activity_info->goal_method) {
-
-				case METHODSINGLEID:
-					if (activity_info->goal_id != explore_id) {
-						continue;
-					}
-					break;
+		auto current_task  = &m_active_tasks[match.task_index];
+		auto task_data     = task_manager->m_task_data[match.task_id];
+		auto activity_info = &task_data->activity_information[match.activity_id];
 
-				case METHODLIST:
-					if (!task_manager->m_goal_list_manager.IsInList(
-						activity_info->goal_id,
-						explore_id
-					)) {
-						continue;
-					}
-					break;
-
-				default:
-					// If METHODQUEST, don't updated the activity_information here
-					continue;
-			}
-
-			// We found an active task to explore this area, so set done count to goal count
-			// (Only a goal count of 1 makes sense for explore activities?)
-			LogTasks(
-				"[UpdateTasksOnExplore] character [{}] explore_id [{}] increment on explore",
-				client->GetName(),
-				explore_id
-			);
+		// We found an active task to explore this area, so set done count to goal count
+		// (Only a goal count of 1 makes sense for explore activities?)
+		LogTasks(
+			"[UpdateTasksOnExplore] character [{}] explore_id [{}] increment on explore",
+			client->GetName(),
+			explore_id
+		);
 
-			IncrementDoneCount(
-				client,
-				task_data,
-				current_task->slot,
-				activity_id,
-				activity_info->goal_count - current_task->activity[activity_id].done_count
-			);
-		}
+		IncrementDoneCount(
+			client,
+			task_data,
+			current_task->slot,
+			match.activity_id,
+			activity_info->goal_count - current_task->activity[match.activity_id].done_count
+		);
 	}
 }
 
@@ -87,6 +87,32 @@ private:
 
 	bool UnlockActivities(int character_id, ClientTaskInformation &task_info);
 
+	struct GoalActivityMatch {
+		int task_index; // into m_active_tasks
+		int task_id;
+		int activity_id;
+	};
+
+	/**
+	 * Activities of our active tasks that goal_id counts towards, in slot then activity order,
+	 * looked up through TaskManager's goal index instead of walking every activity
+	 *
+	 * @param activity_type
+	 * @param goal_id
+	 * @param into
+	 */
+	void FindGoalActivities(TaskActivityType activity_type, int goal_id, std::vector<GoalActivityMatch> &into);
+
+	/**
+	 * Updating one activity can complete its task or unlock the next, so every match is checked
+	 * again right before it is updated
+	 *
+	 * @param client
+	 * @param match
+	 * @return
+	 */
+	bool IsGoalActivityActive(Client *client, const GoalActivityMatch &match);
+
 	inline ClientTaskInformation *GetClientTaskInfo(TaskType task_type, int index)
 	{
 		ClientTaskInformation *info = nullptr;
@@ -19,6 +19,7 @@ TaskGoalListManager::~TaskGoalListManager() {}
 bool TaskGoalListManager::LoadLists()
 {
 	m_task_goal_lists.clear();
+	m_list_index.clear();
 	m_goal_lists_count = 0;
 
 	std::string query   = "SELECT `listid`, COUNT(`entry`) FROM `goallists` GROUP by `listid` ORDER BY `listid`";
@@ -38,6 +39,7 @@ bool TaskGoalListManager::LoadLists()
 		int list_size = atoi(row[1]);
 
 		m_task_goal_lists.push_back({list_id, 0, 0});
+		m_list_index[list_id] = list_index;
 
 		m_task_goal_lists[list_index].GoalItemEntries.reserve(list_size);
 
@@ -79,17 +81,12 @@ int TaskGoalListManager::GetListByID(int list_id)
 {
 
 	// Find the list with the specified ListID and return the index
-	auto it = std::find_if(
-		m_task_goal_lists.begin(),
-		m_task_goal_lists.end(),
-		[list_id](const TaskGoalList_Struct &t) { return t.ListID == list_id; }
-	);
-
-	if (it == m_task_goal_lists.end()) {
+	auto it = m_list_index.find(list_id);
+	if (it == m_list_index.end()) {
 		return -1;
 	}
 
-	return std::distance(m_task_goal_lists.begin(), it);
+	return it->second;
 }
 
 int TaskGoalListManager::GetFirstEntry(int list_id)
@@ -135,11 +132,9 @@ bool TaskGoalListManager::IsInList(int list_id, int entry)
 		return false;
 	}
 
-	int  first_entry = 0;
-	auto &task       = m_task_goal_lists[list_index];
-	auto it          = std::find(task.GoalItemEntries.begin(), task.GoalItemEntries.end(), entry);
-
-	if (it == task.GoalItemEntries.end()) {
+	// entries are loaded in ascending order
+	auto &task = m_task_goal_lists[list_index];
+	if (!std::binary_search(task.GoalItemEntries.begin(), task.GoalItemEntries.end(), entry)) {
 		return false;
 	}
 
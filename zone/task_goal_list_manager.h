@@ -7,6 +7,7 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <unordered_map>
 
 struct TaskGoalList_Struct {
 	int              ListID;
@@ -31,6 +32,7 @@ public:
 private:
 	std::vector<TaskGoalList_Struct> m_task_goal_lists;
 	int                              m_goal_lists_count;
+	std::unordered_map<int, int>     m_list_index; // list id -> index into m_task_goal_lists
 };
 
 
@@ -63,6 +63,55 @@ void TaskManager::ReloadGoalLists()
 	if (!m_goal_list_manager.LoadLists()) {
 		Log(Logs::Detail, Logs::Tasks, "TaskManager::LoadTasks LoadLists failed");
 	}
+
+	BuildGoalIndex();
+}
+
+static uint64 GoalIndexKey(TaskActivityType activity_type, int goal_id)
+{
+	return (static_cast<uint64>(static_cast<uint32>(activity_type)) << 32) | static_cast<uint32>(goal_id);
+}
+
+void TaskManager::BuildGoalIndex()
+{
+	m_goal_index.clear();
+
+	for (int task_id = 0; task_id < MAXTASKS; task_id++) {
+		auto task = m_task_data[task_id];
+		if (task == nullptr) {
+			continue;
+		}
+
+		for (int activity_id = 0; activity_id < task->activity_count; activity_id++) {
+			auto &activity = task->activity_information[activity_id];
+
+			switch (activity.goal_method) {
+				case METHODSINGLEID:
+					m_goal_index[GoalIndexKey(activity.activity_type, activity.goal_id)].push_back({task_id, activity_id});
+					break;
+				case METHODLIST:
+					for (auto entry : m_goal_list_manager.GetListContents(activity.goal_id)) {
+						auto &activities = m_goal_index[GoalIndexKey(activity.activity_type, entry)];
+						// a list can name the same entry twice
+						if (activities.empty() || activities.back().task_id != task_id || activities.back().activity_id != activity_id) {
+							activities.push_back({task_id, activity_id});
+						}
+					}
+					break;
+				default:
+					// METHODQUEST activities are only ever updated from quests
+					break;
+			}
+		}
+	}
+
+	LogTasks("[BuildGoalIndex] Indexed [{}] activity goals", m_goal_index.size());
+}
+
+const std::vector<TaskManager::GoalActivity> *TaskManager::GetGoalActivities(TaskActivityType activity_type, int goal_id) const
+{
+	auto iter = m_goal_index.find(GoalIndexKey(activity_type, goal_id));
+	return iter != m_goal_index.end() ? &iter->second : nullptr;
 }
 
 bool TaskManager::LoadTasks(int single_task)
@@ -273,6 +322,8 @@ bool TaskManager::LoadTasks(int single_task)
 
 	LogTasks("Loaded [{}] Task Activities", task_activities.size());
 
+	BuildGoalIndex();
+
 	return true;
 }
 
@@ -1817,6 +1868,13 @@ void TaskManager::SyncClientSharedTaskStateToLocal(
 
 void TaskManager::HandleUpdateTasksOnKill(Client *client, uint32 npc_type_id)
 {
+	// most npcs are nobody's kill target, don't walk the raid for them
+	if (GetGoalActivities(TaskActivityType::Kill, (int) npc_type_id) == nullptr) {
+		return;
+	}
+
+	std::vector<ClientTaskState::GoalActivityMatch> matches;
+
 	for (auto &c: client->GetPartyMembers()) {
 		if (!c->ClientDataLoaded() || !c->HasTaskState()) {
 			continue;
@@ -1824,85 +1882,34 @@ void TaskManager::HandleUpdateTasksOnKill(Client *client, uint32 npc_type_id)
 
 		LogTasksDetail("[HandleUpdateTasksOnKill] Looping through client [{}]", c->GetCleanName());
 
-		// loop over the union of tasks and quests
-		for (auto &active_task : c->GetTaskState()->m_active_tasks) {
-			auto current_task = &active_task;
-			if (current_task->task_id == TASKSLOTEMPTY) {
-				continue;
-			}
-
-			// Check if there are any active kill activities for this p_task_data
-			auto p_task_data = m_task_data[current_task->task_id];
-			if (p_task_data == nullptr) {
-				return;
-			}
-
-			for (int activity_id = 0; activity_id < p_task_data->activity_count; activity_id++) {
-				ClientActivityInformation *client_activity = &current_task->activity[activity_id];
-				ActivityInformation       *activity_info   = &p_task_data->activity_information[activity_id];
+		auto task_state = c->GetTaskState();
 
-				// We are not interested in completed or hidden activities
-				if (client_activity->activity_state != ActivityActive) {
-					continue;
-				}
-
-				// We are only interested in Kill activities
-				if (activity_info->activity_type != TaskActivityType::Kill) {
-					continue;
-				}
+		matches.clear();
+		task_state->FindGoalActivities(TaskActivityType::Kill, (int) npc_type_id, matches);
 
-				// Is there a zone restriction on the activity_information ?
-				if (!activity_info->CheckZone(zone->GetZoneID())) {
-					LogTasks(
-						"[HandleUpdateTasksOnKill] character [{}] task_id [{}] activity_id [{}] activity_type [{}] for NPC [{}] failed zone check",
-						client->GetName(),
-						current_task->task_id,
-						activity_id,
-						static_cast<int32_t>(TaskActivityType::Kill),
-						npc_type_id
-					);
-					continue;
-				}
-				// Is the activity_information to kill this type of NPC ?
-				switch (activity_info->goal_method) {
-					case METHODSINGLEID:
-						if (activity_info->goal_id != npc_type_id) {
-							LogTasksDetail("[HandleUpdateTasksOnKill] Matched single goal");
-							continue;
-						}
-						break;
-
-					case METHODLIST:
-						if (!m_goal_list_manager.IsInList(
-							activity_info->goal_id,
-							(int) npc_type_id
-						)) {
-							LogTasksDetail("[HandleUpdateTasksOnKill] Matched list goal");
-							continue;
-						}
-						break;
+		for (auto &match : matches) {
+			if (!task_state->IsGoalActivityActive(c, match)) {
+				continue;
+			}
 
-					default:
-						// If METHODQUEST, don't updated the activity_information here
-						continue;
-				}
+			LogTasksDetail("[HandleUpdateTasksOnKill] passed checks");
 
-				LogTasksDetail("[HandleUpdateTasksOnKill] passed checks");
+			auto current_task = &task_state->m_active_tasks[match.task_index];
+			auto p_task_data  = m_task_data[match.task_id];
 
-				// handle actual update
-				// legacy eqemu task update logic loops through group on kill of npc to update a single task
-				if (p_task_data->type != TaskType::Shared) {
-					LogTasksDetail("[HandleUpdateTasksOnKill] Non-Shared Update");
-					c->GetTaskState()->IncrementDoneCount(c, p_task_data, current_task->slot, activity_id);
-					continue;
-				}
+			// handle actual update
+			// legacy eqemu task update logic loops through group on kill of npc to update a single task
+			if (p_task_data->type != TaskType::Shared) {
+				LogTasksDetail("[HandleUpdateTasksOnKill] Non-Shared Update");
+				task_state->IncrementDoneCount(c, p_task_data, current_task->slot, match.activity_id);
+				continue;
+			}
 
-				LogTasksDetail("[HandleUpdateTasksOnKill] Shared update");
+			LogTasksDetail("[HandleUpdateTasksOnKill] Shared update");
 
-				// shared tasks only require one client to receive an update to propagate
-				if (c == client) {
-					c->GetTaskState()->IncrementDoneCount(c, p_task_data, current_task->slot, activity_id);
-				}
+			// shared tasks only require one client to receive an update to propagate
+			if (c == client) {
+				task_state->IncrementDoneCount(c, p_task_data, current_task->slot, match.activity_id);
 			}
 		}
 	}
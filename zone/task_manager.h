@@ -11,6 +11,7 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <unordered_map>
 
 class Client;
 
@@ -74,7 +75,27 @@ public:
 
 	void HandleUpdateTasksOnKill(Client *client, uint32 npc_type_id);
 
+	struct GoalActivity {
+		int task_id;
+		int activity_id;
+	};
+
+	/**
+	 * Every task activity of the type whose goal (single id or goal list) includes goal_id,
+	 * so kill, loot and explore events only look at the activities they can advance
+	 *
+	 * @param activity_type
+	 * @param goal_id npc type, item or explore id
+	 * @return nullptr when no task has such an activity
+	 */
+	const std::vector<GoalActivity> *GetGoalActivities(TaskActivityType activity_type, int goal_id) const;
+
 private:
+	void BuildGoalIndex();
+
+	// (activity type, goal id) -> activities, rebuilt whenever tasks or goal lists are loaded
+	std::unordered_map<uint64, std::vector<GoalActivity>> m_goal_index;
+
 	TaskGoalListManager  m_goal_list_manager;
 	TaskProximityManager m_proximity_manager;
 	TaskInformation      *m_task_data[MAXTASKS]{};
@@ -698,6 +698,7 @@ void Mob::SendTo(float new_x, float new_y, float new_z) {
 	m_Position.x = new_x;
 	m_Position.y = new_y;
 	m_Position.z = new_z;
+	entity_list.UpdateMobPosition(this);
 	LogAI("Sent To ({}, {}, {})", new_x, new_y, new_z);
 
 	if (flymode == GravityBehavior::Flying)
@@ -748,6 +749,8 @@ void Mob::SendToFixZ(float new_x, float new_y, float new_z) {
 				m_Position.z = newz + 1;
 		}
 	}
+
+	entity_list.UpdateMobPosition(this);
 }
 
 float Mob::GetFixedZ(const glm::vec3 &destination, int32 z_find_offset) {
@@ -815,6 +818,7 @@ void Mob::FixZ(int32 z_find_offset /*= 5*/, bool fix_client_z /*= false*/) {
 		}
 
 		m_Position.z = new_z;
+		entity_list.UpdateMobPosition(this);
 	}
 	else {
 		if (RuleB(Map, MobZVisualDebug)) {
@@ -55,6 +55,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
 #include "zone_config.h"
 #include "zone_reload.h"
 #include "../common/shared_tasks.h"
+#include "../common/opcode_stats.h"
 #include "shared_task_zone_messaging.h"
 #include "dialogue_window.h"
 
@@ -67,6 +68,8 @@ extern PetitionList petition_list;
 extern uint32 numclients;
 extern volatile bool RunLoops;
 extern QuestParserCollection *parse;
+extern OpcodeStats client_opcode_stats;
+extern OpcodeStats server_opcode_stats;
 
 // QuestParserCollection *parse = 0;
 
@@ -83,21 +86,70 @@ WorldServer::~WorldServer() {
 void WorldServer::Connect()
 {
 	m_connection = std::make_unique<EQ::Net::ServertalkClient>(Config->WorldIP, Config->WorldTCPPort, false, "Zone", Config->SharedKey);
+	m_connection->SetBatching(RuleB(Network, ServertalkBatching));
+	m_connection->SetCompressThreshold(RuleI(Network, ServertalkCompressThreshold));
+
+	// a newer who/location update for the same client supersedes one still waiting to be sent;
+	// removals and first updates (no world id yet) always go out as they are
+	m_connection->SetCoalesce(ServerOP_ClientList, [](const char *data, size_t length, uint64_t &key) {
+		if (length < sizeof(ServerClientList_Struct)) {
+			return false;
+		}
+
+		auto scl = (const ServerClientList_Struct *) data;
+		if (scl->remove != 0 || scl->wid == 0) {
+			return false;
+		}
+
+		key = scl->wid;
+		return true;
+	});
+
 	m_connection->OnConnect([this](EQ::Net::ServertalkClient *client) {
 		OnConnected();
 	});
 
 	m_connection->OnMessage(std::bind(&WorldServer::HandleMessage, this, std::placeholders::_1, std::placeholders::_2));
 
+	if (RuleB(Zone, DirectZoneMessaging)) {
+		m_mesh = std::make_unique<ZoneMesh>(
+			Config->SharedKey,
+			std::bind(&WorldServer::HandleMessage, this, std::placeholders::_1, std::placeholders::_2)
+		);
+	}
+
 	m_keepalive = std::make_unique<EQ::Timer>(1000, true, std::bind(&WorldServer::OnKeepAlive, this, std::placeholders::_1));
 }
 
 bool WorldServer::SendPacket(ServerPacket *pack)
 {
+	if (m_mesh && ZoneMesh::IsBroadcast(pack->opcode) && m_mesh->Broadcast(pack)) {
+		server_opcode_stats.RecordSent(pack->opcode, pack->size);
+		return true;
+	}
+
+	server_opcode_stats.RecordSent(pack->opcode, pack->size);
 	m_connection->SendPacket(pack);
 	return true;
 }
 
+void WorldServer::ListenZoneMesh(uint16 zone_port)
+{
+	if (!m_mesh || zone_port == 0) {
+		return;
+	}
+
+	m_mesh->Listen(zone_port + RuleI(Zone, DirectZoneMessagingPortOffset));
+	if (m_mesh->GetPort() == 0) {
+		return;
+	}
+
+	ServerPacket pack(ServerOP_ZoneMeshListen, sizeof(ServerZoneMeshListen_Struct));
+	auto listen = (ServerZoneMeshListen_Struct *) pack.pBuffer;
+	listen->port = m_mesh->GetPort();
+	SendPacket(&pack);
+}
+
 std::string WorldServer::GetIP() const
 {
 	return m_connection->Handle()->RemoteIP();
@@ -160,6 +212,8 @@ void WorldServer::OnConnected() {
 	SendPacket(pack);
 	safe_delete(pack);
 
+	ListenZoneMesh(ZoneConfig::get()->ZonePort);
+
 	if (is_zone_loaded) {
 		SetZoneData(zone->GetZoneID(), zone->GetInstanceID());
 		entity_list.UpdateWho(true);
@@ -189,6 +243,8 @@ void WorldServer::OnConnected() {
 /* Zone Process Packets from World */
 void WorldServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p)
 {
+	OpcodeStats::Scope stats_scope(server_opcode_stats, opcode, p.Length());
+
 	ServerPacket tpack(opcode, p);
 	ServerPacket *pack = &tpack;
 
@@ -213,9 +269,19 @@ void WorldServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p)
 		else {
 			LogInfo("World assigned Port: [{}] for this zone", sci->port);
 			ZoneConfig::SetZonePort(sci->port);
+			ListenZoneMesh(sci->port);
 		}
 		break;
 	}
+	case ServerOP_ZoneMeshPeers: {
+		if (!m_mesh || pack->size < sizeof(ServerZoneMeshPeers_Struct))
+			break;
+		auto peers = (ServerZoneMeshPeers_Struct *) pack->pBuffer;
+		if (pack->size != sizeof(ServerZoneMeshPeers_Struct) + peers->count * sizeof(ServerZoneMeshPeer_Struct))
+			break;
+		m_mesh->SetPeers(peers);
+		break;
+	}
 	case ServerOP_ChannelMessage: {
 		if (!is_zone_loaded)
 			break;
@@ -1975,6 +2041,8 @@ void WorldServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p)
 			);
 		}
 		RuleManager::Instance()->LoadRules(&database, RuleManager::Instance()->GetActiveRuleset(), true);
+		client_opcode_stats.SetEnabled(RuleB(Zone, OpcodeStatistics));
+		server_opcode_stats.SetEnabled(RuleB(Zone, OpcodeStatistics));
 		break;
 	}
 	case ServerOP_ReloadContentFlags: {
@@ -3177,7 +3245,7 @@ void WorldServer::HandleMessage(uint16 opcode, const EQ::Net::Packet &p)
 		}
 
 		LogInfo("Loading spells");
-		if (!content_db.LoadSpells(hotfix_name, &SPDAT_RECORDS, &spells)) {
+		if (!content_db.LoadSpells(hotfix_name, &SPDAT_RECORDS, &spells, &spell_traits)) {
 			LogError("Loading spells failed!");
 		}
 
@@ -21,6 +21,7 @@
 #include "../common/eq_packet_structs.h"
 #include "../common/net/servertalk_client_connection.h"
 #include "zone_event_scheduler.h"
+#include "zone_mesh.h"
 
 class ServerPacket;
 class EQApplicationPacket;
@@ -74,8 +75,10 @@ private:
 	uint32 last_groupid;
 
 	void OnKeepAlive(EQ::Timer *t);
+	void ListenZoneMesh(uint16 zone_port);
 
 	std::unique_ptr<EQ::Net::ServertalkClient> m_connection;
+	std::unique_ptr<ZoneMesh> m_mesh;
 	std::unique_ptr<EQ::Timer> m_keepalive;
 
 	ZoneEventScheduler *m_zone_scheduler;
@@ -53,6 +53,7 @@
 #include "worldserver.h"
 #include "zone.h"
 #include "zone_config.h"
+#include "zone_benchmark.h"
 #include "mob_movement_manager.h"
 #include "npc_scale_manager.h"
 #include "../common/data_verification.h"
@@ -1585,7 +1586,10 @@ bool Zone::Process() {
 		}
 	}
 
-	mMovementManager->Process();
+	{
+		ZoneBenchmark::Stage stage(ZoneBenchmark::StagePathing);
+		mMovementManager->Process();
+	}
 
 	return true;
 }
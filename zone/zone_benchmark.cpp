@@ -0,0 +1,286 @@
+#include "zone_benchmark.h"
+#include "../common/eq_stream_intf.h"
+#include "../common/eq_packet.h"
+#include "../common/string_util.h"
+#include "client.h"
+#include "entity.h"
+#include "npc.h"
+#include "zone.h"
+#include "zonedb.h"
+
+#include <algorithm>
+#include <cmath>
+#include <list>
+#include <stdio.h>
+#include <string.h>
+
+extern EntityList entity_list;
+extern Zone       *zone;
+
+ZoneBenchmark *ZoneBenchmark::s_active = nullptr;
+
+static const char *stage_names[ZoneBenchmark::StageCount] = {
+	"tick",
+	"mob process",
+	"zone process",
+	"ai",
+	"aggro scan",
+	"buffs",
+	"pathing",
+	"queue close clients"
+};
+
+// the synthetic clients roam this far around the zone's safe point
+static const float population_radius = 400.0f;
+
+/**
+ * Stream for a synthetic client, counts what is sent to it and throws it away
+ */
+class BenchmarkStream : public EQStreamInterface {
+public:
+	virtual void QueuePacket(const EQApplicationPacket *p, bool ack_req = true)
+	{
+		if (p && ZoneBenchmark::Active()) {
+			ZoneBenchmark::Active()->CountSent(p->size);
+		}
+	}
+
+	virtual void FastQueuePacket(EQApplicationPacket **p, bool ack_req = true)
+	{
+		if (p == nullptr || *p == nullptr) {
+			return;
+		}
+
+		QueuePacket(*p, ack_req);
+		safe_delete(*p);
+	}
+
+	virtual EQApplicationPacket *PopPacket() { return nullptr; }
+	virtual void Close() {}
+	virtual void ReleaseFromUse() {}
+	virtual void RemoveData() {}
+	virtual std::string GetRemoteAddr() const { return "127.0.0.1"; }
+	virtual uint32 GetRemoteIP() const { return 0x0100007F; }
+	virtual uint16 GetRemotePort() const { return 0; }
+	virtual bool CheckState(EQStreamState state) { return state == ESTABLISHED; }
+	virtual std::string Describe() const { return "Benchmark stream"; }
+	virtual EQStreamState GetState() { return ESTABLISHED; }
+	virtual void SetOpcodeManager(OpcodeManager **opm) {}
+	virtual const EQ::versions::ClientVersion ClientVersion() const { return EQ::versions::ClientVersion::RoF2; }
+	virtual Stats GetStats() const { return Stats(); }
+	virtual void ResetStats() {}
+	virtual EQStreamManagerInterface *GetManager() const { return nullptr; }
+};
+
+ZoneBenchmark::Stage::Stage(StageType type)
+	: m_benchmark(ZoneBenchmark::Active()),
+	m_type(type)
+{
+	if (m_benchmark) {
+		m_start = Clock::now();
+	}
+}
+
+ZoneBenchmark::Stage::~Stage()
+{
+	if (m_benchmark) {
+		auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_start).count();
+		m_benchmark->Record(m_type, (uint64) elapsed);
+	}
+}
+
+bool ZoneBenchmark::ParseArgs(int argc, char **argv, Options &options)
+{
+	if (argc < 3 || strcasecmp(argv[1], "benchmark") != 0) {
+		return false;
+	}
+
+	options.zone_name = argv[2];
+
+	if (argc > 3) {
+		options.clients = std::max(0, atoi(argv[3]));
+	}
+
+	if (argc > 4) {
+		options.npcs = std::max(0, atoi(argv[4]));
+	}
+
+	if (argc > 5) {
+		options.ticks = std::max(1, atoi(argv[5]));
+	}
+
+	return true;
+}
+
+ZoneBenchmark::ZoneBenchmark(const Options &options)
+	: m_options(options),
+	m_tick(0),
+	m_packets_sent(0),
+	m_bytes_sent(0)
+{
+	s_active = this;
+}
+
+ZoneBenchmark::~ZoneBenchmark()
+{
+	if (s_active == this) {
+		s_active = nullptr;
+	}
+}
+
+bool ZoneBenchmark::Populate()
+{
+	if (!zone) {
+		return false;
+	}
+
+	auto center = zone->GetSafePoint();
+
+	std::list<NPC *> spawned;
+	entity_list.GetNPCList(spawned);
+
+	std::vector<uint32> npc_types;
+	for (auto npc : spawned) {
+		if (npc->GetOwnerID() == 0 && npc->GetNPCTypeID() > 0) {
+			npc_types.push_back(npc->GetNPCTypeID());
+		}
+	}
+
+	if (npc_types.empty() && m_options.npcs > 0) {
+		LogError("Zone [{}] has no spawned NPCs to clone", m_options.zone_name);
+		return false;
+	}
+
+	for (int i = 0; i < m_options.npcs; ++i) {
+		auto npc_type = content_db.LoadNPCTypesData(npc_types[i % npc_types.size()]);
+		if (!npc_type) {
+			continue;
+		}
+
+		glm::vec4 position(
+			center.x + zone->random.Real(-population_radius, population_radius),
+			center.y + zone->random.Real(-population_radius, population_radius),
+			center.z,
+			zone->random.Real(0.0, 512.0)
+		);
+
+		auto npc = new NPC(npc_type, nullptr, position, GravityBehavior::Water);
+		npc->FixZ();
+		entity_list.AddNPC(npc);
+		npc->SetSimpleRoamBox(150.0f);
+	}
+
+	for (int i = 0; i < m_options.clients; ++i) {
+		auto client = new Client(new BenchmarkStream());
+
+		std::string name = StringFormat("Benchmark%04d", i);
+		strn0cpy(client->name, name.c_str(), sizeof(client->name));
+		strn0cpy(client->m_pp.name, name.c_str(), sizeof(client->m_pp.name));
+
+		client->race        = HUMAN;
+		client->base_race   = HUMAN;
+		client->class_      = WARRIOR;
+		client->level       = (uint8) zone->random.Int(1, 60);
+		client->m_pp.race   = HUMAN;
+		client->m_pp.class_ = WARRIOR;
+		client->m_pp.level  = client->level;
+
+		client->SetPosition(
+			center.x + zone->random.Real(-population_radius, population_radius),
+			center.y + zone->random.Real(-population_radius, population_radius),
+			center.z
+		);
+		client->SetHeading(zone->random.Real(0.0, 512.0));
+		client->FixZ(5, true);
+
+		client->CalcBonuses();
+		client->SetHP(client->GetMaxHP());
+
+		// skips the zone-in handshake, there is no one on the other end to do it
+		client->client_state = Client::CLIENT_CONNECTED;
+		client->conn_state   = Client::ClientConnectFinished;
+
+		entity_list.AddClient(client);
+	}
+
+	printf(
+		"Benchmarking [%s] with %d clients, %d extra npcs (%d total) over %d ticks\n",
+		m_options.zone_name.c_str(),
+		m_options.clients,
+		m_options.npcs,
+		(int) (spawned.size() + m_options.npcs),
+		m_options.ticks
+	);
+
+	m_started = Clock::now();
+
+	return true;
+}
+
+void ZoneBenchmark::StartTick()
+{
+	auto center = zone->GetSafePoint();
+
+	for (auto &e : entity_list.GetClientList()) {
+		auto client = e.second;
+
+		// walk forward, turning now and then and back toward the middle at the edge
+		if (zone->random.Roll(5)) {
+			client->SetHeading(zone->random.Real(0.0, 512.0));
+		}
+
+		float heading = client->GetHeading() / 512.0f * 2.0f * 3.14159265f;
+		float x       = client->GetX() + std::sin(heading) * 2.0f;
+		float y       = client->GetY() + std::cos(heading) * 2.0f;
+
+		if (std::abs(x - center.x) > population_radius || std::abs(y - center.y) > population_radius) {
+			client->SetHeading(client->CalculateHeadingToTarget(center.x, center.y));
+			continue;
+		}
+
+		client->SetPosition(x, y, client->GetZ());
+	}
+}
+
+bool ZoneBenchmark::EndTick()
+{
+	return ++m_tick >= m_options.ticks;
+}
+
+void ZoneBenchmark::Record(StageType type, uint64 elapsed_ns)
+{
+	auto &stage = m_stages[type];
+	stage.calls++;
+	stage.total_ns += elapsed_ns;
+	if (elapsed_ns > stage.max_ns) {
+		stage.max_ns = elapsed_ns;
+	}
+}
+
+void ZoneBenchmark::Report()
+{
+	auto wall = std::chrono::duration_cast<std::chrono::duration<double>>(Clock::now() - m_started).count();
+	int  ticks = std::max(1, m_tick);
+
+	printf("\n%d ticks in %.2fs\n", m_tick, wall);
+	printf("%-20s %12s %12s %14s %12s\n", "stage", "calls", "total ms", "us per tick", "max us");
+
+	for (int i = 0; i < StageCount; ++i) {
+		auto &stage = m_stages[i];
+		printf(
+			"%-20s %12llu %12.2f %14.2f %12.2f\n",
+			stage_names[i],
+			(unsigned long long) stage.calls,
+			stage.total_ns / 1000000.0,
+			stage.total_ns / 1000.0 / ticks,
+			stage.max_ns / 1000.0
+		);
+	}
+
+	printf(
+		"\nsent to clients: %llu packets, %llu bytes (%.1f packets per client per tick)\n",
+		(unsigned long long) m_packets_sent,
+		(unsigned long long) m_bytes_sent,
+		m_options.clients > 0 ? (double) m_packets_sent / m_options.clients / ticks : 0.0
+	);
+}
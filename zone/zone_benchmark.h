@@ -0,0 +1,113 @@
+#ifndef EQEMU_ZONE_BENCHMARK_H
+#define EQEMU_ZONE_BENCHMARK_H
+
+#include "../common/types.h"
+#include <chrono>
+#include <string>
+
+/**
+ * Headless zone benchmark
+ *
+ *   zone benchmark <zone_short_name> [clients] [npcs] [ticks]
+ *
+ * Boots the zone without a world connection or network listeners, fills it with synthetic
+ * clients (fake streams that drop everything sent to them) and extra roaming NPCs cloned from
+ * the zone's own spawns, runs the main loop for a fixed number of ticks and prints how long
+ * each stage took. Needs the database and maps, nothing else
+ */
+class ZoneBenchmark {
+public:
+	typedef std::chrono::steady_clock Clock;
+
+	enum StageType {
+		StageTick = 0,
+		StageMobProcess,
+		StageZoneProcess,
+		StageAI,
+		StageAggroScan,
+		StageBuffs,
+		StagePathing,
+		StageQueueCloseClients,
+		StageCount
+	};
+
+	/**
+	 * Adds the time from construction to destruction to a stage while a benchmark runs,
+	 * otherwise does nothing
+	 */
+	class Stage {
+	public:
+		Stage(StageType type);
+		~Stage();
+
+	private:
+		ZoneBenchmark     *m_benchmark;
+		StageType         m_type;
+		Clock::time_point m_start;
+	};
+
+	struct Options {
+		std::string zone_name;
+		int         clients = 50;
+		int         npcs    = 200;
+		int         ticks   = 1000;
+	};
+
+	/**
+	 * @param argc
+	 * @param argv
+	 * @param options filled when argv asks for a benchmark
+	 * @return true when this is a benchmark run
+	 */
+	static bool ParseArgs(int argc, char **argv, Options &options);
+
+	static ZoneBenchmark *Active() { return s_active; }
+
+	ZoneBenchmark(const Options &options);
+	~ZoneBenchmark();
+
+	/**
+	 * Adds the synthetic population, call once the zone is booted
+	 *
+	 * @return false when the zone has nothing to clone NPCs from
+	 */
+	bool Populate();
+
+	/**
+	 * Moves the synthetic clients, call at the start of each tick
+	 */
+	void StartTick();
+
+	/**
+	 * @return true once the requested number of ticks has run
+	 */
+	bool EndTick();
+
+	void Report();
+
+	void CountSent(uint64 bytes)
+	{
+		m_packets_sent++;
+		m_bytes_sent += bytes;
+	}
+
+private:
+	struct StageCounters {
+		uint64 calls    = 0;
+		uint64 total_ns = 0;
+		uint64 max_ns   = 0;
+	};
+
+	void Record(StageType type, uint64 elapsed_ns);
+
+	static ZoneBenchmark *s_active;
+
+	Options           m_options;
+	int               m_tick;
+	Clock::time_point m_started;
+	StageCounters     m_stages[StageCount];
+	uint64            m_packets_sent;
+	uint64            m_bytes_sent;
+};
+
+#endif //EQEMU_ZONE_BENCHMARK_H
@@ -0,0 +1,193 @@
+#include "zone_mesh.h"
+#include "../common/eqemu_logsys.h"
+#include "../common/rulesys.h"
+#include "../common/servertalk.h"
+#include "../common/net/packet.h"
+
+ZoneMesh::ZoneMesh(const std::string &credentials, MessageHandler handler)
+	: m_credentials(credentials),
+	m_handler(handler),
+	m_port(0),
+	m_self_id(0),
+	m_complete(false)
+{
+	m_loopback_timer = std::make_unique<EQ::Timer>(std::bind(&ZoneMesh::OnLoopback, this, std::placeholders::_1));
+}
+
+ZoneMesh::~ZoneMesh()
+{
+}
+
+bool ZoneMesh::Listen(uint16 port)
+{
+	if (m_server || port == 0) {
+		return false;
+	}
+
+	EQ::Net::ServertalkServerOptions opts;
+	opts.port        = port;
+	opts.credentials = m_credentials;
+	opts.batching    = RuleB(Network, ServertalkBatching);
+
+	m_server = std::make_unique<EQ::Net::ServertalkServer>();
+	m_server->Listen(opts);
+	m_server->OnConnectionIdentified(
+		"Zone", [this](std::shared_ptr<EQ::Net::ServertalkServerConnection> connection) {
+			LogInfo("Direct zone connection from [{0}:{1}]", connection->Handle()->RemoteIP(), connection->Handle()->RemotePort());
+			connection->OnMessage([this](uint16_t opcode, EQ::Net::Packet &p) {
+				// peers may only send what world would have relayed for them
+				if (!IsBroadcast(opcode) || !IsValidBroadcastSize(opcode, p.Length())) {
+					LogError("Dropped direct zone packet with opcode [{:#06x}] and size [{}]", opcode, p.Length());
+					return;
+				}
+
+				m_handler(opcode, p);
+			});
+		}
+	);
+
+	m_port = port;
+	LogInfo("Accepting direct zone connections on port [{}]", port);
+	return true;
+}
+
+void ZoneMesh::SetPeers(const ServerZoneMeshPeers_Struct *peers)
+{
+	std::map<uint32, Peer> current;
+	m_self_id  = peers->self_id;
+	m_complete = true;
+
+	for (uint32 i = 0; i < peers->count; ++i) {
+		auto &entry = peers->peers[i];
+		if (entry.zone_server_id == m_self_id) {
+			continue;
+		}
+
+		if (entry.port == 0) {
+			m_complete = false;
+			continue;
+		}
+
+		auto existing = m_peers.find(entry.zone_server_id);
+		if (existing != m_peers.end() && existing->second.address == entry.address && existing->second.port == entry.port) {
+			current[entry.zone_server_id] = std::move(existing->second);
+			continue;
+		}
+
+		Peer peer;
+		peer.address    = entry.address;
+		peer.port       = entry.port;
+		peer.connection = std::make_unique<EQ::Net::ServertalkClient>(peer.address, peer.port, false, "Zone", m_credentials);
+		peer.connection->SetBatching(RuleB(Network, ServertalkBatching));
+		current[entry.zone_server_id] = std::move(peer);
+	}
+
+	m_peers.swap(current);
+}
+
+bool ZoneMesh::IsBroadcast(uint16 opcode)
+{
+	switch (opcode) {
+		case ServerOP_GroupLeave:
+		case ServerOP_GroupJoin:
+		case ServerOP_ForceGroupUpdate:
+		case ServerOP_OOZGroupMessage:
+		case ServerOP_DisbandGroup:
+		case ServerOP_RaidAdd:
+		case ServerOP_RaidRemove:
+		case ServerOP_RaidDisband:
+		case ServerOP_RaidLockFlag:
+		case ServerOP_RaidChangeGroup:
+		case ServerOP_UpdateGroup:
+		case ServerOP_RaidGroupDisband:
+		case ServerOP_RaidGroupAdd:
+		case ServerOP_RaidGroupRemove:
+		case ServerOP_RaidGroupSay:
+		case ServerOP_RaidSay:
+		case ServerOP_RaidGroupLeader:
+		case ServerOP_RaidLeader:
+		case ServerOP_DetailsChange:
+		case ServerOP_RaidMOTD:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/**
+ * The same size checks world/zoneserver.cpp applies before it bounces these to every zone
+ *
+ * @param opcode
+ * @param size
+ * @return
+ */
+bool ZoneMesh::IsValidBroadcastSize(uint16 opcode, size_t size)
+{
+	switch (opcode) {
+		case ServerOP_GroupLeave:
+			return size == sizeof(ServerGroupLeave_Struct);
+		case ServerOP_GroupJoin:
+			return size == sizeof(ServerGroupJoin_Struct);
+		case ServerOP_ForceGroupUpdate:
+			return size == sizeof(ServerForceGroupUpdate_Struct);
+		case ServerOP_DisbandGroup:
+			return size == sizeof(ServerDisbandGroup_Struct);
+		case ServerOP_RaidAdd:
+		case ServerOP_RaidRemove:
+		case ServerOP_RaidDisband:
+		case ServerOP_RaidLockFlag:
+		case ServerOP_RaidChangeGroup:
+		case ServerOP_UpdateGroup:
+		case ServerOP_RaidGroupDisband:
+		case ServerOP_RaidGroupLeader:
+		case ServerOP_RaidLeader:
+		case ServerOP_DetailsChange:
+			return size == sizeof(ServerRaidGeneralAction_Struct);
+		case ServerOP_RaidGroupAdd:
+		case ServerOP_RaidGroupRemove:
+			return size == sizeof(ServerRaidGroupAction_Struct);
+		case ServerOP_RaidMOTD:
+			return size >= sizeof(ServerRaidMOTD_Struct);
+		// world relays the chat messages unchecked, zone still reads the fixed header
+		case ServerOP_OOZGroupMessage:
+			return size >= sizeof(ServerGroupChannelMessage_Struct);
+		case ServerOP_RaidGroupSay:
+		case ServerOP_RaidSay:
+			return size >= sizeof(ServerRaidMessage_Struct);
+		default:
+			return false;
+	}
+}
+
+bool ZoneMesh::Broadcast(ServerPacket *pack)
+{
+	if (!m_complete || m_self_id == 0) {
+		return false;
+	}
+
+	for (auto &peer : m_peers) {
+		if (!peer.second.connection->Handle()) {
+			return false;
+		}
+	}
+
+	for (auto &peer : m_peers) {
+		peer.second.connection->SendPacket(pack);
+	}
+
+	// world bounces these back to the sender as well
+	m_loopback.push_back(std::unique_ptr<ServerPacket>(pack->Copy()));
+	m_loopback_timer->Start(0, false);
+	return true;
+}
+
+void ZoneMesh::OnLoopback(EQ::Timer *t)
+{
+	std::deque<std::unique_ptr<ServerPacket>> pending;
+	pending.swap(m_loopback);
+
+	for (auto &pack : pending) {
+		EQ::Net::StaticPacket p(pack->pBuffer, pack->size);
+		m_handler(pack->opcode, p);
+	}
+}
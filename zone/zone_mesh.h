@@ -0,0 +1,86 @@
+#ifndef EQEMU_ZONE_MESH_H
+#define EQEMU_ZONE_MESH_H
+
+#include "../common/types.h"
+#include "../common/event/timer.h"
+#include "../common/net/servertalk_client_connection.h"
+#include "../common/net/servertalk_server.h"
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+class ServerPacket;
+struct ServerZoneMeshPeers_Struct;
+
+/**
+ * Direct servertalk connections between zone processes
+ *
+ * World brokers the mesh: every zone that accepts direct connections reports its port, and
+ * world hands each zone the full zone list whenever it changes. Messages world would only bounce
+ * to every zone (group and raid updates) are then sent straight to each peer instead, and
+ * handed to our own handler on the next pass of the event loop the way world's bounce would.
+ *
+ * As long as any zone in world's list is not reachable directly, Broadcast declines and the
+ * message goes through world as before
+ */
+class ZoneMesh {
+public:
+	typedef std::function<void(uint16 opcode, const EQ::Net::Packet &p)> MessageHandler;
+
+	ZoneMesh(const std::string &credentials, MessageHandler handler);
+	~ZoneMesh();
+
+	/**
+	 * @param port
+	 * @return false when already listening
+	 */
+	bool Listen(uint16 port);
+	uint16 GetPort() const { return m_port; }
+
+	void SetPeers(const ServerZoneMeshPeers_Struct *peers);
+
+	/**
+	 * Opcodes world relays to every zone without looking at them
+	 *
+	 * @param opcode
+	 * @return
+	 */
+	static bool IsBroadcast(uint16 opcode);
+
+	/**
+	 * @param opcode a broadcast opcode
+	 * @param size
+	 * @return false when a peer's packet is malformed and must not be dispatched
+	 */
+	static bool IsValidBroadcastSize(uint16 opcode, size_t size);
+
+	/**
+	 * @param pack
+	 * @return false when some zone can't be reached directly, the caller sends through world
+	 */
+	bool Broadcast(ServerPacket *pack);
+
+private:
+	struct Peer {
+		std::string                                address;
+		uint16                                     port;
+		std::unique_ptr<EQ::Net::ServertalkClient> connection;
+	};
+
+	void OnLoopback(EQ::Timer *t);
+
+	std::string                                 m_credentials;
+	MessageHandler                              m_handler;
+	std::unique_ptr<EQ::Net::ServertalkServer>  m_server;
+	uint16                                      m_port;
+	uint32                                      m_self_id;
+	std::map<uint32, Peer>                      m_peers;
+	bool                                        m_complete;
+	std::deque<std::unique_ptr<ServerPacket>>   m_loopback;
+	std::unique_ptr<EQ::Timer>                  m_loopback_timer;
+};
+
+#endif //EQEMU_ZONE_MESH_H